@@ -0,0 +1,384 @@
+#include "BatchRunner.h"
+#include "Emulator.h"
+#include "MC68681.h"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+
+#include <glog/logging.h>
+
+
+
+/**
+ * Decodes the escapes in a scenario string: \n, \r, \t, \\ and \xNN.
+ */
+static std::string Unescape(const std::string &str) {
+  std::string out;
+
+  for(size_t i = 0; i < str.size(); i++) {
+    if(str[i] != '\\' || (i + 1) == str.size()) {
+      out.push_back(str[i]);
+      continue;
+    }
+
+    switch(str[++i]) {
+      case 'n':
+        out.push_back('\n');
+        break;
+      case 'r':
+        out.push_back('\r');
+        break;
+      case 't':
+        out.push_back('\t');
+        break;
+      case 'x':
+        out.push_back((char) strtoul(str.substr(i + 1, 2).c_str(), nullptr, 16));
+        i += 2;
+        break;
+      default:
+        out.push_back(str[i]);
+        break;
+    }
+  }
+
+  return out;
+}
+
+/**
+ * Escapes output for printing on a single line.
+ */
+static std::string Escape(const std::string &str) {
+  std::stringstream out;
+
+  for(unsigned char c : str) {
+    if(c == '\n') {
+      out << "\\n";
+    } else if(c == '\r') {
+      out << "\\r";
+    } else if(c == '\\') {
+      out << "\\\\";
+    } else if(c < 0x20 || c >= 0x7F) {
+      out << "\\x" << std::hex << std::setw(2) << std::setfill('0') << (unsigned int) c << std::dec;
+    } else {
+      out << c;
+    }
+  }
+
+  return out.str();
+}
+
+
+
+/**
+ * Sets up a batch run from the given emulator, which should already be booted
+ * as far as all scenarios have in common, and isn't running. At most the given
+ * number of scenarios are run at once.
+ */
+BatchRunner::BatchRunner(Emulator *_emulator, unsigned int _jobs) : emulator(_emulator),
+                                                                    jobs(std::max(_jobs, 1U)) {
+
+}
+
+/**
+ * Reads scenarios from a file. Each line is one scenario, with tab separated
+ * fields:
+ *
+ * - name
+ * - emulated seconds to wait for the expected output
+ * - input to deliver to UART A (may be empty)
+ * - output expected from UART A; the scenario passes as soon as it appears.
+ *   If empty, the scenario passes if it runs for the full time.
+ * - optionally, the time to set the RTC to, as `YYYY-MM-DD HH:MM:SS` (needs
+ *   high level emulation of the loader)
+ *
+ * Input and expected output may contain the escapes \n, \r, \t, \\ and \xNN.
+ * Empty lines and those starting with # are ignored.
+ */
+void BatchRunner::loadScenarios(const std::string &path) {
+  std::ifstream file(path);
+
+  if(!file.is_open()) {
+    throw std::runtime_error("Couldn't open scenario file at " + path);
+  }
+
+  std::string line;
+  size_t lineNo = 0;
+
+  while(std::getline(file, line)) {
+    lineNo++;
+
+    if(line.empty() || line[0] == '#') {
+      continue;
+    }
+
+    // split into fields
+    std::vector<std::string> fields;
+    std::stringstream stream(line);
+    std::string field;
+
+    while(std::getline(stream, field, '\t')) {
+      fields.push_back(field);
+    }
+
+    // an empty expected output at the end of the line gets dropped
+    fields.resize(std::max<size_t>(fields.size(), 4));
+
+    if(fields.size() > 5 || fields[0].empty()) {
+      throw std::runtime_error("Invalid scenario on line " + std::to_string(lineNo) + " of " + path);
+    }
+
+    Scenario scenario = {};
+    scenario.name = fields[0];
+    scenario.seconds = atof(fields[1].c_str());
+    scenario.input = Unescape(fields[2]);
+    scenario.expect = Unescape(fields[3]);
+
+    if(scenario.seconds <= 0) {
+      throw std::runtime_error("Invalid duration on line " + std::to_string(lineNo) + " of " + path);
+    }
+
+    if(fields.size() == 5) {
+      struct tm time = {};
+
+      if(!strptime(fields[4].c_str(), "%Y-%m-%d %H:%M:%S", &time)) {
+        throw std::runtime_error("Invalid RTC time on line " + std::to_string(lineNo) + " of " + path);
+      }
+
+      scenario.setRtc = true;
+      scenario.rtc = timegm(&time);
+    }
+
+    this->scenarios.push_back(scenario);
+  }
+}
+
+/**
+ * Runs all scenarios, and prints a summary. Returns whether all of them
+ * passed.
+ */
+bool BatchRunner::run(void) {
+  std::vector<Result> results(this->scenarios.size());
+  std::vector<Child> children;
+  size_t next = 0;
+
+  // the children's output buffers would otherwise be flushed twice
+  std::cout.flush();
+  std::cerr.flush();
+
+  while(next < this->scenarios.size() || !children.empty()) {
+    while(next < this->scenarios.size() && children.size() < this->jobs) {
+      this->spawn(next++, children);
+    }
+
+    // wait for any child to finish, and pick up its result
+    int status;
+    pid_t pid = waitpid(-1, &status, 0);
+
+    if(pid < 0) {
+      PLOG(FATAL) << "Failed to wait for scenarios";
+    }
+
+    auto child = std::find_if(children.begin(), children.end(), [pid](const Child &c) {
+      return c.pid == pid;
+    });
+
+    if(child == children.end()) {
+      continue;
+    }
+
+    this->collect(*child, status, results[child->scenario]);
+    children.erase(child);
+  }
+
+  this->printSummary(results);
+
+  return std::all_of(results.begin(), results.end(), [](const Result &r) {
+    return r.header.passed;
+  });
+}
+
+/**
+ * Forks a child to run the scenario with the given index.
+ */
+void BatchRunner::spawn(size_t index, std::vector<Child> &children) {
+  int fds[2];
+  PCHECK(pipe(fds) == 0) << "Failed to create pipe";
+
+  pid_t pid = fork();
+  PCHECK(pid >= 0) << "Failed to fork";
+
+  // child: run the scenario and report back; never returns
+  if(pid == 0) {
+    close(fds[0]);
+
+    for(const Child &other : children) {
+      close(other.fd);
+    }
+
+    this->runScenario(this->scenarios[index], fds[1]);
+    _exit(0);
+  }
+
+  close(fds[1]);
+  children.push_back({pid, fds[0], index});
+}
+
+/**
+ * Runs a scenario in a child process, and writes the result to the given
+ * file descriptor.
+ */
+void BatchRunner::runScenario(const Scenario &scenario, int fd) {
+  Emulator *emu = this->emulator;
+  MC68681 *duart = emu->getDuart();
+
+  Scheduler::cycles_t start = emu->now();
+  uint64_t startInstructions = emu->getInstructionCount();
+
+  ResultHeader result = {};
+  Scheduler::cycles_t end = 0;
+  std::string output;
+
+  // watch for the expected output
+  duart->setTransmitHandler(MC68681::kChannelA, [&](uint8_t byte) {
+    output.push_back(byte);
+
+    if(!result.passed && !scenario.expect.empty() &&
+       output.find(scenario.expect) != std::string::npos) {
+      result.passed = true;
+      end = emu->now();
+
+      emu->stop();
+    }
+  });
+
+  // deliver input one byte at a time, as if it came over the wire
+  for(size_t i = 0; i < scenario.input.size(); i++) {
+    uint8_t byte = scenario.input[i];
+
+    emu->scheduleAt(start + (i + 1) * kInputByteCycles, [duart, byte]() {
+      duart->receiveByte(MC68681::kChannelA, byte);
+    });
+  }
+
+  if(scenario.setRtc) {
+    emu->setRtcTime(scenario.rtc);
+  }
+
+  emu->scheduleAt(start + (Scheduler::cycles_t) (scenario.seconds * Emulator::kCpuClock), [&]() {
+    // without any expected output, running until the end is a pass
+    result.passed = scenario.expect.empty();
+    end = emu->now();
+
+    emu->stop();
+  });
+
+  emu->start();
+
+  result.cycles = end - start;
+  result.instructions = emu->getInstructionCount() - startInstructions;
+
+  // report the end of the output
+  if(output.size() > kMaxOutput) {
+    output = output.substr(output.size() - kMaxOutput);
+  }
+
+  result.outputLength = output.size();
+
+  std::string report(reinterpret_cast<const char *>(&result), sizeof(result));
+  report += output;
+
+  for(size_t written = 0; written < report.size(); ) {
+    ssize_t err = write(fd, report.data() + written, report.size() - written);
+
+    if(err < 0 && errno == EINTR) {
+      continue;
+    } else if(err <= 0) {
+      _exit(1);
+    }
+
+    written += err;
+  }
+
+  close(fd);
+}
+
+/**
+ * Reads the result of a child that exited.
+ */
+void BatchRunner::collect(const Child &child, int status, Result &result) {
+  std::string report;
+  char buffer[4096];
+
+  for(;;) {
+    ssize_t err = read(child.fd, buffer, sizeof(buffer));
+
+    if(err < 0 && errno == EINTR) {
+      continue;
+    } else if(err <= 0) {
+      break;
+    }
+
+    report.append(buffer, err);
+  }
+
+  close(child.fd);
+
+  result.header = {};
+
+  if(WIFSIGNALED(status)) {
+    result.error = "killed by signal " + std::to_string(WTERMSIG(status));
+  } else if(!WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+    result.error = "exited with status " + std::to_string(WEXITSTATUS(status));
+  } else if(report.size() < sizeof(ResultHeader)) {
+    result.error = "didn't report a result";
+  } else {
+    memcpy(&result.header, report.data(), sizeof(ResultHeader));
+    result.output = report.substr(sizeof(ResultHeader), result.header.outputLength);
+  }
+}
+
+/**
+ * Prints the outcome of every scenario, and the totals.
+ */
+void BatchRunner::printSummary(const std::vector<Result> &results) const {
+  size_t passed = 0;
+  uint64_t cycles = 0;
+
+  for(size_t i = 0; i < results.size(); i++) {
+    const Scenario &scenario = this->scenarios[i];
+    const Result &result = results[i];
+
+    std::cout << (result.header.passed ? "PASS  " : "FAIL  ") << scenario.name << "  "
+              << result.header.cycles << " cycles, " << result.header.instructions
+              << " instructions";
+
+    if(!result.error.empty()) {
+      std::cout << " (" << result.error << ")";
+    } else if(!result.header.passed) {
+      std::cout << "; output: \"" << Escape(result.output) << "\"";
+    }
+
+    std::cout << std::endl;
+
+    passed += result.header.passed ? 1 : 0;
+    cycles += result.header.cycles;
+  }
+
+  std::cout << passed << " of " << results.size() << " scenarios passed, "
+            << cycles << " cycles emulated in total" << std::endl;
+}
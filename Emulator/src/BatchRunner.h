@@ -0,0 +1,91 @@
+/**
+ * Runs a list of test scenarios in parallel, each starting from the same
+ * booted machine. The emulator is booted once; then a child process is forked
+ * for every scenario, so that the children share the booted state copy on
+ * write. Each child feeds its scenario's input to UART A, watches for the
+ * expected output and reports back over a pipe.
+ */
+#ifndef BATCHRUNNER_H
+#define BATCHRUNNER_H
+
+#include "Emulator.h"
+#include "Scheduler.h"
+
+#include <cstdint>
+#include <ctime>
+#include <string>
+#include <vector>
+
+#include <sys/types.h>
+
+class BatchRunner {
+  public:
+    BatchRunner(Emulator *emulator, unsigned int jobs);
+
+    void loadScenarios(const std::string &path);
+    bool run(void);
+
+  private:
+    /// a single test case
+    typedef struct {
+      /// name, for the summary
+      std::string name;
+      /// emulated seconds to wait for the expected output
+      double seconds;
+      /// bytes received on UART A, and the output expected on it
+      std::string input, expect;
+      /// whether the RTC is set, and to what (UTC)
+      bool setRtc;
+      std::time_t rtc;
+    } Scenario;
+
+    /// what a child reports about its scenario
+    typedef struct {
+      /// whether the expected output appeared
+      bool passed;
+      /// cycles and instructions until then, or until the time ran out
+      uint64_t cycles;
+      uint64_t instructions;
+      /// number of bytes of output that follow
+      uint32_t outputLength;
+    } ResultHeader;
+
+    /// outcome of a scenario, as seen by the parent
+    typedef struct {
+      ResultHeader header;
+      /// the end of the UART output
+      std::string output;
+      /// why the child failed to report, if it did
+      std::string error;
+    } Result;
+
+    /// a child process that's running a scenario
+    typedef struct {
+      pid_t pid;
+      /// read end of the pipe it reports on
+      int fd;
+      /// index of its scenario
+      size_t scenario;
+    } Child;
+
+  private:
+    void spawn(size_t index, std::vector<Child> &children);
+    void runScenario(const Scenario &scenario, int fd);
+    void collect(const Child &child, int status, Result &result);
+
+    void printSummary(const std::vector<Result> &results) const;
+
+  private:
+    /// UART input is delivered at about 9600 baud
+    static const Scheduler::cycles_t kInputByteCycles = (Emulator::kCpuClock / 960);
+    /// at most this much of a scenario's output is reported
+    static const size_t kMaxOutput = 1024;
+
+  private:
+    Emulator *emulator;
+    unsigned int jobs;
+
+    std::vector<Scenario> scenarios;
+};
+
+#endif
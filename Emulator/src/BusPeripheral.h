@@ -9,6 +9,8 @@
 #include <stdexcept>
 
 class Emulator;
+class StateReader;
+class StateWriter;
 
 class BusPeripheral {
   public:
@@ -31,6 +33,23 @@ class BusPeripheral {
     virtual void busWrite(uint32_t addr, uint32_t data, bus_size_t size) = 0;
     virtual uint32_t busRead(uint32_t addr, bus_size_t size) = 0;
 
+    /**
+     * Whether the register at the given address may be polled in a loop
+     * waiting for it to change: reading it must have no side effects, and it
+     * may only change as the result of a scheduled event or host input.
+     */
+    virtual bool isPollable(uint32_t addr) {
+      return false;
+    }
+
+    /**
+     * Writes the peripheral's internal state into a snapshot, and restores it
+     * from one. By the time a snapshot is restored, the emulated time already
+     * is; events that the peripheral had scheduled must be scheduled again.
+     */
+    virtual void saveState(StateWriter &state) {}
+    virtual void loadState(StateReader &state) {}
+
   protected:
     Emulator *emulator = nullptr;
 
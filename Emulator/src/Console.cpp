@@ -0,0 +1,134 @@
+#include "Console.h"
+#include "Emulator.h"
+#include "TimeTravel.h"
+
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include <glog/logging.h>
+
+/**
+ * Sets up a console for the given emulator.
+ */
+Console::Console(Emulator *_emulator) : emulator(_emulator) {
+
+}
+
+/**
+ * Starts reading commands. The reader thread is detached, since it can't be
+ * woken out of a blocking read; it just exits with the process.
+ */
+void Console::start(void) {
+  std::thread reader(&Console::readCommands, this);
+  reader.detach();
+
+  std::cout << "Console ready; type `help` for a list of commands" << std::endl;
+}
+
+/**
+ * Reads commands until the end of the input, and hands each to the emulation
+ * thread.
+ */
+void Console::readCommands(void) {
+  std::string line;
+
+  while(std::getline(std::cin, line)) {
+    this->emulator->post([this, line]() {
+      this->execute(line);
+    });
+  }
+}
+
+/**
+ * Carries out a command. This runs on the emulation thread.
+ */
+void Console::execute(const std::string &line) {
+  std::stringstream stream(line);
+  std::string command, argument;
+
+  stream >> command >> argument;
+
+  TimeTravel *timeTravel = this->emulator->getTimeTravel();
+
+  if(command.empty()) {
+    return;
+  } else if(command == "help" || command == "?") {
+    this->printHelp();
+  } else if(command == "pause" || command == "p") {
+    this->emulator->setPaused(true);
+    this->printState();
+  } else if(command == "continue" || command == "c") {
+    this->emulator->setPaused(false);
+  } else if(command == "regs" || command == "r") {
+    this->printState();
+  } else if(command == "quit" || command == "q") {
+    this->emulator->stop();
+  } else if(!timeTravel) {
+    std::cout << "Unknown command `" << command << "`; time travel is off" << std::endl;
+  }
+  // go back a number of instructions
+  else if(command == "back" || command == "b") {
+    uint64_t instructions = argument.empty() ? 1 : strtoull(argument.c_str(), nullptr, 0);
+
+    if(!timeTravel->stepBack(instructions)) {
+      std::cout << "Can't go back " << instructions << " instructions" << std::endl;
+    }
+
+    this->printState();
+  }
+  // go back to the last write to an address
+  else if(command == "lastwrite" || command == "w") {
+    if(!argument.empty() && argument[0] == '$') {
+      argument.erase(0, 1);
+    }
+
+    char *end = nullptr;
+    uint32_t address = strtoul(argument.c_str(), &end, 16);
+
+    if(argument.empty() || *end) {
+      std::cout << "Usage: lastwrite <hex address>" << std::endl;
+      return;
+    }
+
+    if(!timeTravel->runBackToWrite(address)) {
+      std::cout << "No write to $" << std::hex << address << std::dec
+                << " since the oldest checkpoint" << std::endl;
+    }
+
+    this->printState();
+  } else if(command == "checkpoints") {
+    timeTravel->printCheckpoints(std::cout);
+  } else {
+    std::cout << "Unknown command `" << command << "`" << std::endl;
+  }
+}
+
+/**
+ * Lists the commands.
+ */
+void Console::printHelp(void) {
+  std::cout << "help              Show this list" << std::endl;
+  std::cout << "pause (p)         Pause emulation" << std::endl;
+  std::cout << "continue (c)      Resume emulation" << std::endl;
+  std::cout << "regs (r)          Show the registers, emulated time and instruction count" << std::endl;
+  std::cout << "back (b) [n]      Go back n instructions (default 1), and pause" << std::endl;
+  std::cout << "lastwrite (w) a   Go back to right after the last write to the RAM address a (hex), and pause" << std::endl;
+  std::cout << "checkpoints       Show how far back time travel can go" << std::endl;
+  std::cout << "quit (q)          Stop the emulator" << std::endl;
+}
+
+/**
+ * Prints the registers, emulated time and instruction count.
+ */
+void Console::printState(void) {
+  Emulator::M68kRegs regs;
+  this->emulator->getRegs(regs);
+
+  std::cout << regs << std::endl;
+  std::cout << "cycle " << this->emulator->now() << ", " << this->emulator->getInstructionCount()
+            << " instructions" << (this->emulator->isPaused() ? " (paused)" : "") << std::endl;
+}
@@ -0,0 +1,30 @@
+/**
+ * Debugging console on the standard input. Commands are read on a thread of
+ * their own, and carried out on the emulation thread between time slices;
+ * they can pause the machine, show its registers and step it back in time.
+ */
+#ifndef CONSOLE_H
+#define CONSOLE_H
+
+#include <string>
+
+class Emulator;
+
+class Console {
+  public:
+    Console(Emulator *emulator);
+
+    void start(void);
+
+  private:
+    void readCommands(void);
+    void execute(const std::string &line);
+
+    void printHelp(void);
+    void printState(void);
+
+  private:
+    Emulator *emulator;
+};
+
+#endif
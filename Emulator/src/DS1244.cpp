@@ -1,4 +1,5 @@
 #include "DS1244.h"
+#include "Snapshot.h"
 
 #include <cstdint>
 #include <iostream>
@@ -98,3 +99,22 @@ uint32_t DS1244::busRead(uint32_t addr, bus_size_t size) {
 
   return 0;
 }
+
+
+/**
+ * Writes the phantom clock's state to a snapshot; the NVRAM itself belongs to
+ * the emulator.
+ */
+void DS1244::saveState(StateWriter &state) {
+  state.put(this->magicSeqOffset);
+  state.put(this->activated);
+  state.put(this->bitsToShift);
+}
+/**
+ * Restores the phantom clock's state.
+ */
+void DS1244::loadState(StateReader &state) {
+  state.get(this->magicSeqOffset);
+  state.get(this->activated);
+  state.get(this->bitsToShift);
+}
@@ -22,6 +22,9 @@ class DS1244 : public BusPeripheral {
     virtual void busWrite(uint32_t addr, uint32_t data, bus_size_t size);
     virtual uint32_t busRead(uint32_t addr, bus_size_t size);
 
+    virtual void saveState(StateWriter &state);
+    virtual void loadState(StateReader &state);
+
   private:
     uint8_t getCurrentMagicBit(void) {
       int arrOffset = (this->magicSeqOffset / 8);
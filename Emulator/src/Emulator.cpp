@@ -4,6 +4,11 @@
 #include "TubeDrivers.h"
 #include "VFD.h"
 #include "DS1244.h"
+#include "LoaderServices.h"
+#include "InputLog.h"
+#include "TimeTravel.h"
+#include "Snapshot.h"
+#include "Tracer.h"
 
 #include <string>
 #include <vector>
@@ -13,6 +18,9 @@
 #include <fstream>
 #include <stdexcept>
 #include <cstdint>
+#include <mutex>
+#include <chrono>
+#include <algorithm>
 
 #include <glog/logging.h>
 
@@ -20,19 +28,28 @@ extern "C" {
   #include "musashi/m68k.h"
 }
 
-/// Should all instructions be logged?
-#define LOG_INSTRUCTIONS        0
 /// should we log memory accesses?
 #define LOG_MEM_READ            0
 #define LOG_MEM_WRITE           0
 
 
-static Emulator *gEmulator = nullptr;
+/**
+ * Emulator whose CPU is currently loaded into this thread's CPU core; all bus
+ * accesses the core makes on this thread are routed to it.
+ */
+static thread_local Emulator *gEmulator = nullptr;
+
+/// serializes the one-time setup of the shared opcode tables
+static std::mutex gCpuInitLock;
+
+/// start of every snapshot file; the last character is the format version
+static const char kSnapshotMagic[8] = {'N', 'X', 'S', 'T', 'A', 'T', 'E', '2'};
 
 
 
 extern "C" void m68k_instruction_hook(void);
 extern "C" void m68k_reset_called(void);
+extern "C" int m68k_pc_trap_called(void);
 
 
 
@@ -40,26 +57,43 @@ extern "C" void m68k_reset_called(void);
  * Sets up the emulator.
  */
 Emulator::Emulator(std::string romFilePath, std::string nvramFilePath) {
-  // ensure we haven't already been allocated
-  CHECK(gEmulator == nullptr) << "Already have an allocated emulator";
-  gEmulator = this;
-
   // initialize peripherals
   this->duart = new MC68681(this);
   this->tubes = new TubeDrivers(this);
   this->vfd = new VFD(this);
   this->rtc = new DS1244(this, this->nvram);
 
-  // load ROM
+  this->loader = new LoaderServices(this);
+
+  // load ROM and lay out the address space
   this->loadROM(romFilePath);
+  this->buildMemoryMap();
 
   // set up CPU
-  m68k_init();
+  this->cpuContext.resize(m68k_context_size());
+  this->bindCpu();
+
+  {
+    std::lock_guard<std::mutex> guard(gCpuInitLock);
+    m68k_init();
+
+    // this also builds the disassembler's tables
+    m68k_is_valid_instruction(0, M68K_CPU_TYPE_68000);
+  }
+
 	m68k_set_cpu_type(M68K_CPU_TYPE_68000);
-  m68k_set_instr_hook_callback(m68k_instruction_hook);
+  // it's really a 68008, which has an 8-bit data bus
+  m68k_set_bus_timing(1);
   m68k_set_reset_instr_callback(m68k_reset_called);
+  m68k_set_fast_memory(&this->fastMemory);
+
+  // the ROM never changes, so its instructions only need decoding once
+  this->decodeCache.resize(m68k_decode_cache_size(sizeof(this->memRom)));
+  m68k_set_decode_cache(this->decodeCache.data(), 0, sizeof(this->memRom));
 
   m68k_pulse_reset();
+
+  this->unbindCpu();
 }
 
 
@@ -87,6 +121,29 @@ Emulator::~Emulator() {
     delete this->rtc;
     this->rtc = nullptr;
   }
+
+  if(this->loader) {
+    delete this->loader;
+    this->loader = nullptr;
+  }
+
+  if(this->recorder) {
+    delete this->recorder;
+    this->recorder = nullptr;
+  }
+
+  if(this->replayer) {
+    delete this->replayer;
+    this->replayer = nullptr;
+  }
+
+  if(this->timeTravel) {
+    delete this->timeTravel;
+    this->timeTravel = nullptr;
+  }
+
+  // release translated code
+  m68k_jit_destroy(this->jit);
 }
 
 
@@ -110,8 +167,14 @@ void Emulator::loadROM(const std::string path) {
 
   std::vector<char> rom(size);
   if(romFile.read(rom.data(), size)) {
-    // write it into memory now
-    memcpy(this->memRom, rom.data(), size);
+    // write it into memory now, in the layout the CPU core expects
+    memcpy(this->memRom, rom.data(), std::min<size_t>(size, sizeof(this->memRom)));
+
+#if M68K_BYTE_XOR
+    for(size_t i = 0; i < sizeof(this->memRom); i += 2) {
+      std::swap(this->memRom[i], this->memRom[i + 1]);
+    }
+#endif
 
     // also, extract stack and PC and set that
     this->initialSp = __builtin_bswap32(*((uint32_t *) rom.data()));
@@ -130,6 +193,362 @@ void Emulator::loadROM(const std::string path) {
   romFile.close();
 }
 
+/**
+ * Builds the page table that decodes CPU addresses.
+ *
+ * The board only decodes A16-A18, so the 512K address space is split into
+ * eight 64K pages, which are mirrored throughout the rest of the address space.
+ */
+void Emulator::buildMemoryMap(void) {
+  memset(this->pages, 0, sizeof(this->pages));
+
+  // ROM occupies the first 128K ($00000-$1FFFF)
+  for(size_t i = 0; i < 2; i++) {
+    this->pages[i].read = this->memRom + (i << kPageBits);
+  }
+
+  // peripherals each get a page
+  this->pages[2].periph = this->duart;
+  this->pages[3].periph = this->rtc;
+  this->pages[4].periph = this->tubes;
+  this->pages[5].periph = this->vfd;
+
+  // RAM occupies the last 128K ($60000-$7FFFF)
+  for(size_t i = 0; i < 2; i++) {
+    this->pages[6 + i].read = this->memRam + (i << kPageBits);
+    this->pages[6 + i].write = this->memRam + (i << kPageBits);
+  }
+
+  // let the CPU access memory pages directly, and tell it about wait states
+  for(size_t i = 0; i < kNumPages; i++) {
+    this->fastMemory.pages[i].read = this->pages[i].read;
+    this->fastMemory.pages[i].write = this->pages[i].write;
+    this->fastMemory.pages[i].wait_states = (this->pages[i].periph == this->duart) ? kDuartWaitStates : 0;
+  }
+}
+
+/**
+ * Loads this emulator's CPU into the calling thread's CPU core, so that it can
+ * be executed. Whatever emulator was previously bound to the thread is saved
+ * and restored again by unbindCpu().
+ */
+void Emulator::bindCpu(void) {
+  CHECK(gEmulator != this) << "Emulator is already bound to this thread";
+
+  if(gEmulator) {
+    m68k_get_context(gEmulator->cpuContext.data());
+  }
+
+  this->previousEmulator = gEmulator;
+  gEmulator = this;
+
+  m68k_set_context(this->cpuContext.data());
+}
+
+/**
+ * Saves the CPU state out of the calling thread's CPU core, and restores the
+ * emulator that was bound before.
+ */
+void Emulator::unbindCpu(void) {
+  CHECK(gEmulator == this) << "Emulator isn't bound to this thread";
+
+  m68k_get_context(this->cpuContext.data());
+
+  gEmulator = this->previousEmulator;
+  this->previousEmulator = nullptr;
+
+  if(gEmulator) {
+    m68k_set_context(gEmulator->cpuContext.data());
+  }
+}
+
+/**
+ * Sets the time the loader's RTC service reports, from now on; see
+ * LoaderServices::setClock(). This only has an effect with high level
+ * emulation of the loader enabled.
+ */
+void Emulator::setRtcTime(std::time_t time) {
+  this->loader->setClock(time);
+}
+
+/**
+ * Hashes the ROM (64-bit FNV-1a over its bytes, in 68k order), so snapshots
+ * are only ever restored with the ROM they were taken with.
+ */
+uint64_t Emulator::romHash(void) const {
+  uint64_t hash = 0xCBF29CE484222325ULL;
+
+  for(size_t i = 0; i < sizeof(this->memRom); i++) {
+    hash ^= this->memRom[i ^ M68K_BYTE_XOR];
+    hash *= 0x100000001B3ULL;
+  }
+
+  return hash;
+}
+
+/**
+ * Saves the state of the machine to a snapshot file: the CPU context, RAM,
+ * NVRAM and the state of every peripheral, along with the emulated time.
+ *
+ * This must be called on the thread running the emulator, between time slices
+ * (from a scheduled event, for example), or while it's not running.
+ */
+void Emulator::saveState(const std::string &path) {
+  StateWriter state;
+
+  // CPU context, as of the end of the last time slice
+  std::vector<uint8_t> context(m68k_context_size());
+
+  if(gEmulator == this) {
+    m68k_get_context(context.data());
+  } else {
+    context = this->cpuContext;
+  }
+
+  SnapshotHeader header = {};
+  memcpy(header.magic, kSnapshotMagic, sizeof(header.magic));
+  header.contextSize = context.size();
+  header.flags = M68K_BYTE_XOR;
+  header.romHash = this->romHash();
+
+  state.put(header);
+  state.putBytes(context.data(), context.size());
+
+  // machine state
+  state.put(this->cycles);
+  state.put(this->irqLines);
+  state.put(this->fastMemory.writes);
+
+  state.putBytes(this->memRam, sizeof(this->memRam));
+  state.putBytes(this->nvram, sizeof(this->nvram));
+
+  // each peripheral occupies exactly one page
+  for(const Page &page : this->pages) {
+    if(page.periph) {
+      page.periph->saveState(state);
+    }
+  }
+
+  state.writeToFile(path);
+
+  LOG(INFO) << "Saved state to `" << path << "` at cycle " << this->cycles;
+}
+
+/**
+ * Restores the machine state from a snapshot file written by saveState(),
+ * with the same build of the emulator and the same ROM. The file is mapped
+ * and copied out of directly.
+ *
+ * This must be called before the emulator is started; anything scheduled
+ * before is relative to the old emulated time.
+ */
+void Emulator::loadState(const std::string &path) {
+  StateReader state(path);
+
+  SnapshotHeader header;
+  state.get(header);
+
+  if(memcmp(header.magic, kSnapshotMagic, sizeof(header.magic)) != 0) {
+    throw std::runtime_error("Not a snapshot of this version: " + path);
+  } else if(header.contextSize != m68k_context_size() || header.flags != M68K_BYTE_XOR) {
+    throw std::runtime_error("Snapshot was taken with a different build: " + path);
+  } else if(header.romHash != this->romHash()) {
+    throw std::runtime_error("Snapshot was taken with a different ROM: " + path);
+  }
+
+  // peripherals may change the CPU's interrupt level while being restored
+  this->bindCpu();
+
+  try {
+    m68k_restore_context(state.getBytes(header.contextSize));
+
+    // machine state; time has to be restored before peripherals reschedule
+    state.get(this->cycles);
+    state.get(this->irqLines);
+    state.get(this->fastMemory.writes);
+
+    state.getBytes(this->memRam, sizeof(this->memRam));
+    state.getBytes(this->nvram, sizeof(this->nvram));
+
+    for(const Page &page : this->pages) {
+      if(page.periph) {
+        page.periph->loadState(state);
+      }
+    }
+  } catch(...) {
+    this->unbindCpu();
+    throw;
+  }
+
+  this->unbindCpu();
+
+  // forget about anything seen before
+  this->lastPoll = {};
+  this->lastPollTime = 0;
+  this->pollMatches = 0;
+
+  LOG(INFO) << "Loaded state from `" << path << "` at cycle " << this->cycles;
+}
+
+/**
+ * Starts logging every input from outside the machine to the given file, so
+ * the run can be replayed later; see InputLog. Any snapshot should be loaded
+ * before this is called, since the replay has to start from the same state.
+ */
+void Emulator::startRecording(const std::string &path) {
+  InputLog::Header header = {};
+  memcpy(header.magic, InputLog::kMagic, sizeof(header.magic));
+  header.loaderHle = this->loaderHle;
+  header.loaderHleCycles = this->loaderHleCycles;
+  header.uartUnthrottled = this->duart->isUnthrottled();
+  header.romHash = this->romHash();
+  header.cycles = this->now();
+  header.instructions = this->getInstructionCount();
+
+  this->recorder = new InputRecorder(path, header);
+
+  LOG(INFO) << "Recording inputs to `" << path << "`";
+}
+
+/**
+ * Replays the inputs logged to the given file rather than taking any from the
+ * outside; the emulator stops once the log ends. It must have no UART
+ * backends attached, and have the same ROM and settings, and be in the same state (from the
+ * same snapshot, if any) as when the recording started.
+ */
+void Emulator::startReplay(const std::string &path) {
+  InputReplayer *replayer = new InputReplayer(this, path);
+  const InputLog::Header &header = replayer->getHeader();
+
+  std::string error;
+
+  if(header.romHash != this->romHash()) {
+    error = "Input log was recorded with a different ROM: ";
+  } else if(header.loaderHle != this->loaderHle || header.loaderHleCycles != this->loaderHleCycles) {
+    error = "Input log was recorded with different loader emulation settings: ";
+  } else if(header.uartUnthrottled != this->duart->isUnthrottled()) {
+    error = "Input log was recorded with different UART pacing: ";
+  } else if(header.cycles != this->now() || header.instructions != this->getInstructionCount()) {
+    error = "Input log was recorded from a different starting state: ";
+  } else if(replayer->nextEventTime() == Scheduler::kNever) {
+    error = "Input log is empty: ";
+  }
+
+  if(!error.empty()) {
+    delete replayer;
+    throw std::runtime_error(error + path);
+  }
+
+  this->replayer = replayer;
+}
+
+/**
+ * Starts taking checkpoints every given number of cycles, so that execution
+ * can be wound back; see TimeTravel. This can be combined with a replay, but
+ * not with recording, since going back in time rewrites the inputs.
+ */
+void Emulator::enableTimeTravel(Scheduler::cycles_t interval) {
+  if(this->recorder) {
+    throw std::runtime_error("Time travel can't be used while recording inputs");
+  }
+
+  this->timeTravel = new TimeTravel(this, interval);
+}
+
+/**
+ * Pauses or resumes emulation. This must be called on the emulation thread;
+ * work posted from other threads is still run while paused.
+ */
+void Emulator::setPaused(bool paused) {
+  this->paused = paused;
+
+  if(!paused) {
+    this->resetPacing();
+  }
+}
+
+/**
+ * Hashes the machine state that the CPU can see: its registers, RAM and NVRAM,
+ * so two runs can be compared cheaply.
+ */
+uint64_t Emulator::stateHash(void) {
+  M68kRegs regs;
+  this->getRegs(regs);
+
+  uint64_t hash = 0xCBF29CE484222325ULL;
+
+  auto add = [&hash](const void *data, size_t length) {
+    const uint8_t *bytes = static_cast<const uint8_t *>(data);
+
+    for(size_t i = 0; i < length; i++) {
+      hash ^= bytes[i];
+      hash *= 0x100000001B3ULL;
+    }
+  };
+
+  const uint32_t values[18] = {
+    regs.d0, regs.d1, regs.d2, regs.d3, regs.d4, regs.d5, regs.d6, regs.d7,
+    regs.a0, regs.a1, regs.a2, regs.a3, regs.a4, regs.a5, regs.a6, regs.a7,
+    regs.pc, regs.sr
+  };
+
+  add(values, sizeof(values));
+  add(this->memRam, sizeof(this->memRam));
+  add(this->nvram, sizeof(this->nvram));
+
+  return hash;
+}
+
+/**
+ * Logs an input, as of the current time, if recording.
+ */
+void Emulator::recordInput(unsigned int type, uint32_t data, uint64_t value) {
+  if(!this->recorder && !this->timeTravel) {
+    return;
+  }
+
+  InputLog::Event event = {};
+  event.cycles = this->now();
+  event.instructions = this->getInstructionCount();
+  event.type = (InputLog::EventType) type;
+  event.data = data;
+  event.value = value;
+
+  if(this->recorder) {
+    this->recorder->record(event);
+  }
+  if(this->timeTravel && !this->reexecuting) {
+    this->timeTravel->noteInput(event);
+  }
+}
+
+/**
+ * Called on the emulation thread when a byte from the outside is about to be
+ * received by the DUART, so that it can be recorded.
+ */
+void Emulator::noteUartInput(unsigned int channel, uint8_t byte) {
+  this->recordInput(InputLog::kUartRx, channel, byte);
+}
+
+/**
+ * Reads the host's wall clock, for emulated hardware that follows it. This is
+ * an input from the outside, so it's recorded; during a replay, the recorded
+ * reading is returned instead.
+ */
+void Emulator::readHostClock(std::time_t &seconds, unsigned int &millis) {
+  if(this->replayer &&
+     this->replayer->readHostClock(this->now(), this->getInstructionCount(), seconds, millis)) {
+    return;
+  }
+
+  auto now = std::chrono::system_clock::now();
+
+  seconds = std::chrono::system_clock::to_time_t(now);
+  millis = std::chrono::duration_cast<std::chrono::milliseconds>(now.time_since_epoch()).count() % 1000;
+
+  this->recordInput(InputLog::kHostClock, millis, seconds);
+}
+
 /**
  * Loads NVRAM from disk.
  */
@@ -140,8 +559,13 @@ void Emulator::loadNVRAM(const std::string path) {
 
 /**
  * Dumps the registers from the CPU.
+ *
+ * If the emulator is currently running on another thread, this reflects the
+ * state of the CPU when it was last stopped.
  */
 void Emulator::getRegs(M68kRegs &regs) {
+  void *context = (gEmulator == this) ? nullptr : this->cpuContext.data();
+
   // dump registers
   const size_t numRegs = 18;
 
@@ -166,26 +590,447 @@ void Emulator::getRegs(M68kRegs &regs) {
 
   for(int i = 0; i < numRegs; i++) {
     // read reg
-    *regVals[i] = m68k_get_reg(nullptr, regIds[i]);
+    *regVals[i] = m68k_get_reg(context, regIds[i]);
   }
 }
 
 
 /**
- * Starts emulation.
+ * Starts emulation on the calling thread; this returns once stop() is called.
+ *
+ * Any number of emulators may run at the same time, as long as each is
+ * started on its own thread.
+ *
+ * The CPU is run in slices that end at the next scheduled event, so events
+ * happen on the exact instruction boundary they're due at. Whenever the CPU
+ * can't make any progress until the next event, emulated time skips ahead to
+ * it instead.
+ *
+ * Once this returns, the emulator may be started again to carry on from where
+ * it stopped.
  */
 void Emulator::start(void) {
+  this->bindCpu();
+
+  m68k_set_compact_dispatch(this->compactDispatch);
+  m68k_set_dbcc_fast_forward(this->dbccFastForward);
+  m68k_set_pc_trap(LoaderServices::kApiEntry, this->loaderHle ? m68k_pc_trap_called : nullptr);
+
+  if(!this->useDecodeCache) {
+    m68k_set_decode_cache(nullptr, 0, 0);
+  }
+
+  // set up the translator if needed
+  if(this->useJit && !this->jit) {
+    this->jit = m68k_jit_create(kJitCodeSize);
+    LOG_IF(WARNING, !this->jit) << "JIT unavailable on this host; interpreting all code";
+
+    m68k_set_jit(this->jit);
+  }
+
+  this->resetPacing();
+
   while(this->run) {
-    // run weed processor
-    m68k_execute(100000);
+    // handle work from other threads, then everything that's now due
+    if(this->mailboxPending) {
+      this->runMailbox();
+    }
+
+    if(this->paused) {
+      this->waitForWork(std::chrono::steady_clock::time_point::max());
+      continue;
+    }
+
+    this->deliverDue();
+
+    if(this->timeTravel) {
+      this->timeTravel->maybeCheckpoint();
+    }
+
+    this->runSlice();
+
+    // wait for the next event if we're idle; otherwise, keep to real time
+    if(this->idleDetected || this->cpuIsIdle()) {
+      this->idleDetected = false;
+      this->idle();
+    } else if(this->realtime) {
+      this->pace();
+    }
   }
+
+  this->recordInput(InputLog::kEnd, 0, this->stateHash());
+
+  // allow starting again
+  this->run = true;
+
+  this->unbindCpu();
+}
+
+/**
+ * Delivers replayed inputs and fires scheduled events that are due.
+ */
+void Emulator::deliverDue(void) {
+  if(this->replayer) {
+    this->replayer->runUntil(this->cycles, this->getInstructionCount());
+  }
+
+  this->scheduler.runUntil(this->cycles);
+}
+
+/**
+ * Runs the CPU until the next event is due, or for the longest time slice.
+ */
+void Emulator::runSlice(void) {
+  Scheduler::cycles_t next = this->nextEventTime();
+  int slice = kMaxSliceCycles;
+
+  if(next != Scheduler::kNever && (next - this->cycles) < kMaxSliceCycles) {
+    slice = (next - this->cycles);
+  }
+
+  // run weed processor
+  this->sliceEnd = this->cycles + slice;
+  this->inSlice = true;
+
+  this->cycles += m68k_execute(slice);
+
+  this->inSlice = false;
+
+  // send off whatever was transmitted during the slice
+  this->duart->flushTransmitted();
 }
 
 /**
  * Stops emulation.
  */
 void Emulator::stop(void) {
+  std::lock_guard<std::mutex> guard(this->mailboxLock);
+
   this->run = false;
+  this->mailboxSignal.notify_all();
+}
+
+
+
+/**
+ * Returns the number of instructions the CPU has executed.
+ */
+uint64_t Emulator::getInstructionCount(void) const {
+  void *context = (gEmulator == this) ? nullptr : (void *) this->cpuContext.data();
+  return m68k_get_instruction_count(context);
+}
+
+/**
+ * Returns the current emulated time.
+ *
+ * While the CPU is executing, this is the time at which the instruction that
+ * is currently executing started.
+ */
+Scheduler::cycles_t Emulator::now(void) const {
+  if(this->inSlice) {
+    return this->cycles + m68k_cycles_run();
+  }
+
+  return this->cycles;
+}
+
+/**
+ * Schedules a callback to run on the emulation thread at the given emulated
+ * time. If that falls within the time slice that's currently executing, the
+ * slice is cut short so the event isn't late.
+ */
+Scheduler::event_id_t Emulator::scheduleAt(Scheduler::cycles_t when,
+                                           Scheduler::callback_t callback) {
+  Scheduler::event_id_t id = this->scheduler.schedule(when, callback);
+
+  if(this->inSlice && when < this->sliceEnd) {
+    m68k_end_timeslice();
+    this->sliceEnd = this->now();
+  }
+
+  return id;
+}
+
+/**
+ * Schedules a callback to run the given number of cycles from now.
+ */
+Scheduler::event_id_t Emulator::scheduleIn(Scheduler::cycles_t delay,
+                                           Scheduler::callback_t callback) {
+  return this->scheduleAt(this->now() + delay, callback);
+}
+
+/**
+ * Cancels a scheduled event.
+ */
+void Emulator::cancelEvent(Scheduler::event_id_t event) {
+  this->scheduler.cancel(event);
+}
+
+/**
+ * Queues work to be run on the emulation thread. This may be called from any
+ * thread; the work is performed before the next time slice starts.
+ */
+void Emulator::post(std::function<void(void)> callback) {
+  std::lock_guard<std::mutex> guard(this->mailboxLock);
+
+  this->mailbox.push_back(callback);
+  this->mailboxPending = true;
+
+  this->mailboxSignal.notify_all();
+}
+
+/**
+ * Runs all work that was posted from other threads.
+ */
+void Emulator::runMailbox(void) {
+  std::vector<std::function<void(void)>> work;
+
+  {
+    std::lock_guard<std::mutex> guard(this->mailboxLock);
+
+    work.swap(this->mailbox);
+    this->mailboxPending = false;
+  }
+
+  for(auto &callback : work) {
+    callback();
+  }
+}
+
+/**
+ * Returns the time of the next scheduled event or replayed input, whichever
+ * comes first.
+ */
+Scheduler::cycles_t Emulator::nextEventTime(void) {
+  Scheduler::cycles_t next = this->scheduler.nextEventTime();
+
+  if(this->replayer) {
+    next = std::min(next, this->replayer->nextEventTime());
+  }
+
+  return next;
+}
+
+/**
+ * Blocks until work is posted from another thread, the emulator is stopped or
+ * the deadline passes. A deadline of time_point::max() waits indefinitely.
+ */
+void Emulator::waitForWork(std::chrono::steady_clock::time_point deadline) {
+  std::unique_lock<std::mutex> lock(this->mailboxLock);
+
+  auto haveWork = [this]() {
+    return this->mailboxPending || !this->run;
+  };
+
+  if(deadline == std::chrono::steady_clock::time_point::max()) {
+    this->mailboxSignal.wait(lock, haveWork);
+  } else {
+    this->mailboxSignal.wait_until(lock, deadline, haveWork);
+  }
+}
+
+/**
+ * Gets the wall clock time at which the given emulated time is reached, when
+ * running in real time.
+ */
+std::chrono::steady_clock::time_point Emulator::wallTimeFor(Scheduler::cycles_t cycles) const {
+  uint64_t elapsed = (cycles - this->realtimeStartCycles);
+  uint64_t nanos = (elapsed / kCpuClock) * 1000000000ULL +
+                   ((elapsed % kCpuClock) * 1000000000ULL) / kCpuClock;
+
+  return this->realtimeStart + std::chrono::nanoseconds(nanos);
+}
+
+/**
+ * Gets the emulated time corresponding to a wall clock time, when running in
+ * real time.
+ */
+Scheduler::cycles_t Emulator::cyclesAtWallTime(std::chrono::steady_clock::time_point time) const {
+  uint64_t nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(time - this->realtimeStart).count();
+
+  return this->realtimeStartCycles + (nanos / 1000000000ULL) * kCpuClock +
+         ((nanos % 1000000000ULL) * kCpuClock) / 1000000000ULL;
+}
+
+/**
+ * Determines whether the CPU can't make progress on its own: it's either
+ * stopped, or branching to itself.
+ */
+bool Emulator::cpuIsIdle(void) {
+  if(m68k_is_stopped()) {
+    return true;
+  }
+
+  uint32_t pc = m68k_get_reg(nullptr, M68K_REG_PC);
+
+  if(this->pageFor(pc).read) {
+    return (m68k_read_memory_16(pc) == kBranchToSelf);
+  }
+
+  return false;
+}
+
+/**
+ * Called when the CPU reads a peripheral register that may be polled.
+ *
+ * If the same instruction keeps reading the same value in a short loop, and
+ * neither registers nor memory change in between, the loop can't end until
+ * an event changes the value. The rest of the time until then is skipped.
+ */
+void Emulator::notePeripheralPoll(uint32_t address, uint32_t value) {
+  PollSample sample;
+
+  sample.pc = m68k_get_reg(nullptr, M68K_REG_PPC);
+  sample.address = address;
+  sample.value = value;
+  sample.writes = this->fastMemory.writes;
+
+  for(int i = 0; i < 16; i++) {
+    sample.regs[i] = m68k_get_reg(nullptr, (m68k_register_t) (M68K_REG_D0 + i));
+  }
+  sample.regs[16] = m68k_get_reg(nullptr, M68K_REG_SR);
+
+  // compare against the previous poll
+  Scheduler::cycles_t time = this->now();
+  const PollSample &last = this->lastPoll;
+
+  bool same = (sample.pc == last.pc) && (sample.address == last.address) &&
+              (sample.value == last.value) && (sample.writes == last.writes) &&
+              std::equal(sample.regs, sample.regs + 17, last.regs);
+
+  if(same && (time - this->lastPollTime) <= kIdleLoopMaxCycles) {
+    if(++this->pollMatches >= kIdleLoopMatches) {
+      this->pollMatches = 0;
+      this->idleDetected = true;
+
+      m68k_end_timeslice();
+    }
+  } else {
+    this->pollMatches = 0;
+  }
+
+  this->lastPoll = sample;
+  this->lastPollTime = time;
+}
+
+/**
+ * The CPU can't make progress until the next event: skip ahead to it, or in
+ * real time mode, sleep until it's due. If nothing is scheduled, this waits
+ * for input from another thread.
+ */
+void Emulator::idle(void) {
+  Scheduler::cycles_t next = this->nextEventTime();
+
+  if(this->realtime) {
+    auto deadline = std::chrono::steady_clock::time_point::max();
+
+    if(next != Scheduler::kNever) {
+      deadline = this->wallTimeFor(next);
+    }
+
+    this->waitForWork(deadline);
+
+    // account for the time spent asleep, up to the event
+    Scheduler::cycles_t elapsed = this->cyclesAtWallTime(std::chrono::steady_clock::now());
+    this->cycles = std::min(next, std::max(this->cycles, elapsed));
+  } else {
+    if(next != Scheduler::kNever) {
+      this->cycles = std::max(this->cycles, next);
+    } else {
+      this->waitForWork(std::chrono::steady_clock::time_point::max());
+    }
+  }
+
+  // a replay would skip straight to the event
+  if(this->cycles != next) {
+    this->recordInput(InputLog::kWake, 0, 0);
+  }
+}
+
+/**
+ * Starts pacing to the wall clock afresh from the current emulated time, after
+ * emulation was paused or went back in time.
+ */
+void Emulator::resetPacing(void) {
+  this->realtimeStart = std::chrono::steady_clock::now();
+  this->realtimeStartCycles = this->cycles;
+}
+
+/**
+ * Starts watching CPU writes to the given RAM address. Writes to its page go
+ * through the memory callbacks, rather than inline, until unwatchWrites().
+ * This must be called on the emulation thread, between time slices.
+ */
+void Emulator::watchWrites(uint32_t address) {
+  this->unwatchWrites();
+
+  this->watching = true;
+  this->watchAddress = (address & kAddressMask);
+  this->lastWatchedWrite = 0;
+
+  this->fastMemory.pages[this->watchAddress >> kPageBits].write = nullptr;
+  m68k_set_fast_memory(&this->fastMemory);
+}
+
+/**
+ * Stops watching writes, and lets the CPU write the page inline again.
+ */
+void Emulator::unwatchWrites(void) {
+  if(!this->watching) {
+    return;
+  }
+
+  this->watching = false;
+
+  size_t page = (this->watchAddress >> kPageBits);
+  this->fastMemory.pages[page].write = this->pages[page].write;
+  m68k_set_fast_memory(&this->fastMemory);
+}
+
+/**
+ * In real time mode, sleeps if emulated time has gotten ahead of the wall
+ * clock.
+ */
+void Emulator::pace(void) {
+  auto deadline = this->wallTimeFor(this->cycles);
+
+  if(deadline - std::chrono::steady_clock::now() > std::chrono::milliseconds(1)) {
+    this->waitForWork(deadline);
+  }
+}
+
+/**
+ * Asserts or deasserts an interrupt request at the given level (1-7). The CPU
+ * sees the highest level that is asserted.
+ */
+void Emulator::setIrq(unsigned int level, bool asserted) {
+  CHECK(level >= 1 && level <= 7) << "Invalid interrupt level " << level;
+
+  uint8_t lines = this->irqLines;
+
+  if(asserted) {
+    lines |= (1 << level);
+  } else {
+    lines &= ~(1 << level);
+  }
+
+  if(lines == this->irqLines) {
+    return;
+  }
+
+  this->irqLines = lines;
+
+  // figure out the highest asserted level
+  unsigned int highest = 0;
+
+  for(unsigned int i = 7; i >= 1; i--) {
+    if(lines & (1 << i)) {
+      highest = i;
+      break;
+    }
+  }
+
+  m68k_set_irq(highest);
 }
 
 
@@ -194,19 +1039,51 @@ void Emulator::stop(void) {
  * Instruction executed hook
  */
 void Emulator::cpuExecutedInstruction(uint64_t address) {
-#if LOG_INSTRUCTIONS
-  // disassemble
-  char instrBuffer[48];
-  memset(&instrBuffer, 0, sizeof(instrBuffer));
+  for(Tracer *tracer : this->tracers) {
+    tracer->instructionExecuted(this, address);
+  }
+}
 
-  int count = m68k_disassemble(instrBuffer, address, M68K_CPU_TYPE_68000);
+/**
+ * Attaches a tracer, which is then called before every instruction. This must
+ * be called on the thread running the emulator (use post() otherwise), or
+ * before it's started. The tracer is owned by the caller.
+ */
+void Emulator::addTracer(Tracer *tracer) {
+  this->tracers.push_back(tracer);
+  this->updateInstructionHook();
+}
 
-  // log instruction and registers
-  Emulator::M68kRegs regs;
-  this->getRegs(regs);
+/**
+ * Detaches a tracer; the same threading rules as for addTracer() apply.
+ */
+void Emulator::removeTracer(Tracer *tracer) {
+  this->tracers.erase(std::remove(this->tracers.begin(), this->tracers.end(), tracer),
+                      this->tracers.end());
+  this->updateInstructionHook();
+}
 
-  VLOG(2) << "TRACE: address = $" << std::hex << address << ": " << std::string(instrBuffer) << std::endl << regs;
-#endif
+/**
+ * Hooks the CPU's instructions if any tracers are attached, and unhooks them
+ * otherwise, so that the CPU runs its loop without the hook.
+ */
+void Emulator::updateInstructionHook(void) {
+  bool bound = (gEmulator == this);
+
+  if(!bound) {
+    this->bindCpu();
+  }
+
+  m68k_set_instr_hook_callback(this->tracers.empty() ? nullptr : m68k_instruction_hook);
+
+  // the CPU picks which loop to run at the start of a slice
+  if(this->inSlice) {
+    m68k_end_timeslice();
+  }
+
+  if(!bound) {
+    this->unbindCpu();
+  }
 }
 
 /**
@@ -228,6 +1105,14 @@ void Emulator::cpuInt(uint32_t intno) {
   LOG(INFO) << "Interrupt: " << intno;
 }
 
+/**
+ * The CPU reached the loader's API entry point, with high level emulation of
+ * the loader enabled; service the call. Returns the cycles it took.
+ */
+int Emulator::cpuTrapped(void) {
+  return this->loader->call(this->loaderHleCycles);
+}
+
 
 
 
@@ -266,101 +1151,65 @@ std::ostream& operator<<(std::ostream& os, const Emulator::M68kRegs& regs) {
 
 
 /**
- * Returns the address of read/write buffers for fixed memories like ROM and
- * RAM.
+ * Determines what to do for an unhandled bus transaction.
  */
-void *Get68kBuffer(bool isRead, uint32_t addr) {
-  // limit address to 512K
-  addr &= 0x07FFFF;
+static void Unhandled68kTransaction(bool isRead, uint32_t address, uint32_t data, int width) {
+  std::stringstream message;
 
-  // is this read access?
   if(isRead) {
-    // ROM
-    if(addr < 0x020000) {
-      return &gEmulator->memRom[addr];
-    }
-    // RAM?
-    else if(addr >= 0x060000 && addr < 0x07FFFF) {
-      return &gEmulator->memRam[(addr - 0x060000)];
-    }
-  }
-  // otherwise, it's a write
-  else {
-    // RAM?
-    if(addr >= 0x060000 && addr < 0x07FFFF) {
-      return &gEmulator->memRam[(addr - 0x060000)];
-    }
+    message << "Unhandled " << width << "-bit read from $" << std::hex
+            << address << std::endl;
+  } else {
+    message << "Unhandled " << width << "-bit write to $" << std::hex
+            << address << " = $" << data << std::endl;
   }
 
-  // no success
-  return nullptr;
+  // dump state
+  Emulator::M68kRegs regs;
+  gEmulator->getRegs(regs);
+
+  message << regs;
+
+  // print message
+  LOG(WARNING) << message.str();
+
+  // infinite loop
+  while(1) {}
 }
 
 /**
- * Handles peripheral accesses.
+ * Forwards an access to the peripheral that owns the given page.
  *
  * For reads, *data will deposit data in an uint32_t; for writes, it is read for
  * the data to write.
  *
  * Return negative number to abort memory access.
  */
-int Handle68kPeriph(bool isRead, uint8_t width, uint32_t address, uint32_t *data) {
-  // get width
-  BusPeripheral::bus_size_t size;
-  BusPeripheral *periph = nullptr;
-  uint32_t offset;
-
-  switch(width) {
-    case 8:
-      size = BusPeripheral::kBusSize8Bits;
-      break;
-    case 16:
-      size = BusPeripheral::kBusSize16Bits;
-      break;
-    case 32:
-      size = BusPeripheral::kBusSize32Bits;
-      break;
-
-    // should never get here
-    default:
-      LOG(FATAL) << "Invalid bus widthL " << width;
-  }
-
-  // DUART
-  if(address >= 0x020000 && address <= 0x02FFFF) {
-    offset = (address - 0x020000);
-    periph = gEmulator->duart;
-  }
-  // tube drivers
-  else if(address >= 0x040000 && address <= 0x04FFFF) {
-    offset = (address - 0x040000);
-    periph = gEmulator->tubes;
-  }
-  // VFD
-  else if(address >= 0x050000 && address <= 0x05FFFF) {
-    offset = (address - 0x050000);
-    periph = gEmulator->vfd;
-  }
-  // RTC
-  else if(address >= 0x030000 && address <= 0x03FFFF) {
-    offset = (address - 0x030000);
-    periph = gEmulator->rtc;
-  }
-
-  // if no peripheral found, abort
-  if(!periph) {
+static int Handle68kPeriph(const Emulator::Page &page, bool isRead,
+                           BusPeripheral::bus_size_t size, uint32_t address,
+                           uint32_t *data) {
+  // if no peripheral is mapped here, abort
+  if(!page.periph) {
     return -1;
   }
 
+  // peripherals are addressed relative to the start of their page
+  uint32_t offset = (address & ((1 << Emulator::kPageBits) - 1));
+
   // attempt bus operation
   try {
     // handle reads
     if(isRead) {
-      *data = periph->busRead(offset, size);
+      *data = page.periph->busRead(offset, size);
+
+      if(page.periph->isPollable(offset)) {
+        gEmulator->notePeripheralPoll(address, *data);
+      }
     }
     // it's a write
     else {
-      periph->busWrite(offset, *data, size);
+      gEmulator->noteBusWrite();
+      page.periph->busWrite(offset, *data, size);
     }
   } catch(BusPeripheral::BusError e) {
     LOG(ERROR) << "Bus error accessing peripheral at $" << std::hex << address
@@ -372,30 +1221,51 @@ int Handle68kPeriph(bool isRead, uint8_t width, uint32_t address, uint32_t *data
 }
 
 /**
- * Determines what to do for an unhandled bus transaction.
+ * Accessors for ROM and RAM pages. These hold 16-bit words in host byte order
+ * (see M68K_HOST_ORDER_WORDS) so the CPU core can access them directly; on a
+ * little endian host, the two bytes of each word are thus swapped.
  */
-void Unhandled68kTransaction(bool isRead, uint32_t address, uint32_t data, int width) {
-  std::stringstream message;
+static inline uint8_t PageRead8(const uint8_t *page, uint32_t offset) {
+  return page[offset ^ M68K_BYTE_XOR];
+}
 
-  if(isRead) {
-    message << "Unhandled " << width << "-bit read from $" << std::hex
-            << address << std::endl;
-  } else {
-    message << "Unhandled " << width << "-bit write to $" << std::hex
-            << address << " = $" << data << std::endl;
+static inline uint16_t PageRead16(const uint8_t *page, uint32_t offset) {
+  if(offset & 1) {
+    return (PageRead8(page, offset) << 8) | PageRead8(page, offset + 1);
   }
 
-  // dump state
-  Emulator::M68kRegs regs;
-  gEmulator->getRegs(regs);
+#if M68K_HOST_ORDER_WORDS
+  return *((const uint16_t *) (page + offset));
+#else
+  return __builtin_bswap16(*((const uint16_t *) (page + offset)));
+#endif
+}
 
-  message << regs;
+static inline uint32_t PageRead32(const uint8_t *page, uint32_t offset) {
+  return (PageRead16(page, offset) << 16) | PageRead16(page, offset + 2);
+}
 
-  // print message
-  LOG(WARNING) << message.str();
+static inline void PageWrite8(uint8_t *page, uint32_t offset, uint8_t value) {
+  page[offset ^ M68K_BYTE_XOR] = value;
+}
 
-  // infinite loop
-  while(1) {}
+static inline void PageWrite16(uint8_t *page, uint32_t offset, uint16_t value) {
+  if(offset & 1) {
+    PageWrite8(page, offset, (value >> 8));
+    PageWrite8(page, offset + 1, (value & 0xFF));
+    return;
+  }
+
+#if M68K_HOST_ORDER_WORDS
+  *((uint16_t *) (page + offset)) = value;
+#else
+  *((uint16_t *) (page + offset)) = __builtin_bswap16(value);
+#endif
+}
+
+static inline void PageWrite32(uint8_t *page, uint32_t offset, uint32_t value) {
+  PageWrite16(page, offset, (value >> 16));
+  PageWrite16(page, offset + 2, (value & 0xFFFF));
 }
 
 /**
@@ -406,17 +1276,17 @@ extern "C" unsigned int m68k_read_memory_8(unsigned int address) {
   VLOG(2) << "Read (8 bit) from $" << std::hex << address;
 #endif
 
-  // handle simple reads
-  void *buf = Get68kBuffer(true, address);
+  const Emulator::Page &page = gEmulator->pageFor(address);
 
-  if(buf) {
-    return *((uint8_t *) buf);
+  // handle simple reads
+  if(page.read) {
+    return PageRead8(page.read, address & 0xFFFF);
   }
 
   // handle peripherals
   uint32_t tmp;
 
-  if(Handle68kPeriph(true, 8, address, &tmp) >= 0) {
+  if(Handle68kPeriph(page, true, BusPeripheral::kBusSize8Bits, address, &tmp) >= 0) {
     return tmp;
   }
 
@@ -430,18 +1300,18 @@ extern "C" unsigned int m68k_read_memory_16(unsigned int address) {
   VLOG(2) << "Read (16 bit) from $" << std::hex << address;
 #endif
 
-  // handle simple reads
-  void *buf = Get68kBuffer(true, address);
+  const Emulator::Page &page = gEmulator->pageFor(address);
 
-  if(buf) {
-    return __builtin_bswap16(*((uint16_t *) buf));
+  // handle simple reads
+  if(page.read) {
+    return PageRead16(page.read, address & 0xFFFF);
   }
 
   // handle peripherals
   uint32_t tmp;
 
-  if(Handle68kPeriph(true, 16, address, &tmp) >= 0) {
-    return __builtin_bswap16(tmp);
+  if(Handle68kPeriph(page, true, BusPeripheral::kBusSize16Bits, address, &tmp) >= 0) {
+    return tmp;
   }
 
   // we need to handle it elsehow
@@ -454,18 +1324,20 @@ extern "C" unsigned int m68k_read_memory_32(unsigned int address) {
   VLOG(2) << "Read (32 bit) from $" << std::hex << address;
 #endif
 
-  // handle simple reads
-  void *buf = Get68kBuffer(true, address);
+  const Emulator::Page &page = gEmulator->pageFor(address);
 
-  if(buf) {
-    return __builtin_bswap32(*((uint32_t *) buf));
+  // handle simple reads; longwords may straddle two pages
+  if(page.read && (address & 0xFFFF) <= 0xFFFC) {
+    return PageRead32(page.read, address & 0xFFFF);
+  } else if(page.read) {
+    return (m68k_read_memory_16(address) << 16) | m68k_read_memory_16(address + 2);
   }
 
   // handle peripherals
   uint32_t tmp;
 
-  if(Handle68kPeriph(true, 32, address, &tmp) >= 0) {
-    return __builtin_bswap32(tmp);
+  if(Handle68kPeriph(page, true, BusPeripheral::kBusSize32Bits, address, &tmp) >= 0) {
+    return tmp;
   }
 
   // we need to handle it elsehow
@@ -491,16 +1363,17 @@ extern "C" void m68k_write_memory_8(unsigned int address, unsigned int _value) {
   VLOG(2) << "Write (8 bit) to $" << std::hex << address << " = $" << value;
 #endif
 
-  // handle simple writes
-  void *buf = Get68kBuffer(false, address);
+  const Emulator::Page &page = gEmulator->pageFor(address);
 
-  if(buf) {
-    *((uint8_t *) buf) = value;
+  // handle simple writes
+  if(page.write) {
+    PageWrite8(page.write, address & 0xFFFF, value);
+    gEmulator->noteMemoryWrite(address, 1);
     return;
   }
 
   // handle peripherals
-  if(Handle68kPeriph(false, 8, address, &value) >= 0) {
+  if(Handle68kPeriph(page, false, BusPeripheral::kBusSize8Bits, address, &value) >= 0) {
     return;
   }
 
@@ -509,22 +1382,23 @@ extern "C" void m68k_write_memory_8(unsigned int address, unsigned int _value) {
 }
 
 extern "C" void m68k_write_memory_16(unsigned int address, unsigned int _value) {
-  uint32_t value = __builtin_bswap16(_value & 0xFFFF);
+  uint32_t value = (_value & 0xFFFF);
 
 #if LOG_MEM_WRITE
   VLOG(2) << "Write (16 bit) to $" << std::hex << address << " = $" << value;
 #endif
 
-  // handle simple writes
-  void *buf = Get68kBuffer(false, address);
+  const Emulator::Page &page = gEmulator->pageFor(address);
 
-  if(buf) {
-    *((uint16_t *) buf) = value;
+  // handle simple writes
+  if(page.write) {
+    PageWrite16(page.write, address & 0xFFFF, value);
+    gEmulator->noteMemoryWrite(address, 2);
     return;
   }
 
   // handle peripherals
-  if(Handle68kPeriph(false, 16, address, &value) >= 0) {
+  if(Handle68kPeriph(page, false, BusPeripheral::kBusSize16Bits, address, &value) >= 0) {
     return;
   }
 
@@ -533,22 +1407,27 @@ extern "C" void m68k_write_memory_16(unsigned int address, unsigned int _value)
 }
 
 extern "C" void m68k_write_memory_32(unsigned int address, unsigned int _value) {
-  uint32_t value = __builtin_bswap32(_value & 0xFFFFFFFF);
+  uint32_t value = (_value & 0xFFFFFFFF);
 
 #if LOG_MEM_WRITE
   VLOG(2) << "Write (32 bit) to $" << std::hex << address << " = $" << value;
 #endif
 
-  // handle simple writes
-  void *buf = Get68kBuffer(false, address);
+  const Emulator::Page &page = gEmulator->pageFor(address);
 
-  if(buf) {
-    *((uint32_t *) buf) = value;
+  // handle simple writes; longwords may straddle two pages
+  if(page.write && (address & 0xFFFF) <= 0xFFFC) {
+    PageWrite32(page.write, address & 0xFFFF, value);
+    gEmulator->noteMemoryWrite(address, 4);
+    return;
+  } else if(page.write) {
+    m68k_write_memory_16(address, (value >> 16));
+    m68k_write_memory_16(address + 2, (value & 0xFFFF));
     return;
   }
 
   // handle peripherals
-  if(Handle68kPeriph(false, 32, address, &value) >= 0) {
+  if(Handle68kPeriph(page, false, BusPeripheral::kBusSize32Bits, address, &value) >= 0) {
     return;
   }
 
@@ -588,6 +1467,13 @@ extern "C" void m68k_reset_called(void) {
   while(1) {}
 }
 
+/**
+ * Called instead of the instruction at the trap address
+ */
+extern "C" int m68k_pc_trap_called(void) {
+  return gEmulator->cpuTrapped();
+}
+
 /**
  * Called before each instruction
  */
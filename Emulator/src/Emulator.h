@@ -1,15 +1,33 @@
 #ifndef EMULATOR_H
 #define EMULATOR_H
 
+#include "Scheduler.h"
+
 #include <string>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <ctime>
+#include <functional>
 #include <iostream>
+#include <mutex>
+#include <vector>
+
+extern "C" {
+  #include "musashi/m68k.h"
+}
 
+class BusPeripheral;
+class Tracer;
 class MC68681;
 class TubeDrivers;
 class VFD;
 class DS1244;
+class LoaderServices;
+class InputRecorder;
+class InputReplayer;
+class TimeTravel;
 
 class Emulator {
   public:
@@ -27,6 +45,9 @@ class Emulator {
       friend std::ostream& operator<<(std::ostream& os, const M68kRegs& dt);
     };
 
+    /// CPU clock frequency, in Hz; the DUART is clocked from the same source
+    static const uint32_t kCpuClock = 3686400;
+
   public:
     Emulator(std::string romFilePath, std::string nvramFilePath);
     ~Emulator();
@@ -34,36 +55,313 @@ class Emulator {
     void start(void);
     void stop(void);
 
+    void saveState(const std::string &path);
+    void loadState(const std::string &path);
+
+    void startRecording(const std::string &path);
+    void startReplay(const std::string &path);
+
+    uint64_t stateHash(void);
+
+    void enableTimeTravel(Scheduler::cycles_t interval);
+
+    TimeTravel *getTimeTravel(void) const {
+      return this->timeTravel;
+    }
+
+    void setPaused(bool paused);
+
+    bool isPaused(void) const {
+      return this->paused;
+    }
+
+    /// whether the past is being run again for time travel; anything the
+    /// machine sends out then was already sent
+    bool isReexecuting(void) const {
+      return this->reexecuting;
+    }
+
+    void setRealtime(bool realtime) {
+      this->realtime = realtime;
+    }
+
+    void setJit(bool jit) {
+      this->useJit = jit;
+    }
+
+    void setDecodeCache(bool decodeCache) {
+      this->useDecodeCache = decodeCache;
+    }
+
+    void setCompactDispatch(bool compact) {
+      this->compactDispatch = compact;
+    }
+
+    void setDbccFastForward(bool fastForward) {
+      this->dbccFastForward = fastForward;
+    }
+
+    void setLoaderHle(bool hle) {
+      this->loaderHle = hle;
+    }
+
+    void setLoaderHleCycles(unsigned int cycles) {
+      this->loaderHleCycles = cycles;
+    }
+
+    void setRtcTime(std::time_t time);
+
+    void addTracer(Tracer *tracer);
+    void removeTracer(Tracer *tracer);
+
+    uint64_t getInstructionCount(void) const;
+
     void getRegs(M68kRegs &regs);
 
+    Scheduler::cycles_t now(void) const;
+    Scheduler::event_id_t scheduleAt(Scheduler::cycles_t when, Scheduler::callback_t callback);
+    Scheduler::event_id_t scheduleIn(Scheduler::cycles_t delay, Scheduler::callback_t callback);
+    void cancelEvent(Scheduler::event_id_t event);
+
+    void post(std::function<void(void)> callback);
+
+    void setIrq(unsigned int level, bool asserted);
+
+    MC68681 *getDuart(void) const {
+      return this->duart;
+    }
+
+    void notePeripheralPoll(uint32_t address, uint32_t value);
+
+    void noteUartInput(unsigned int channel, uint8_t byte);
+    void readHostClock(std::time_t &seconds, unsigned int &millis);
+
+    /// records that the CPU wrote to memory or a peripheral
+    inline void noteBusWrite(void) {
+      this->fastMemory.writes++;
+    }
+
+    /// records that the CPU wrote the given number of bytes to memory that
+    /// isn't accessed inline, and whether it hit the watched address
+    inline void noteMemoryWrite(uint32_t address, unsigned int bytes) {
+      this->fastMemory.writes++;
+
+      if(this->watching && ((this->watchAddress - address) & kAddressMask) < bytes) {
+        this->lastWatchedWrite = m68k_get_instruction_count(nullptr);
+      }
+    }
+
+    /**
+     * A single page of the CPU's address space. Accesses that hit a page with
+     * a host buffer are serviced directly out of that buffer; everything else
+     * is forwarded to the page's peripheral, if any.
+     */
+    typedef struct {
+      /// host memory to read from, or nullptr if reads aren't direct
+      uint8_t *read;
+      /// host memory to write to, or nullptr if writes aren't direct
+      uint8_t *write;
+      /// peripheral to forward non-direct accesses to
+      BusPeripheral *periph;
+    } Page;
+
+    /// number of address bits that are decoded
+    static const unsigned int kAddressBits = 19;
+    /// number of bits of the address to use as the offset into a page
+    static const unsigned int kPageBits = 16;
+    /// number of pages
+    static const size_t kNumPages = (1 << (kAddressBits - kPageBits));
+    /// mask for the address bits that are decoded
+    static const uint32_t kAddressMask = ((1 << kAddressBits) - 1);
+
+    /// wait states (in clocks per bus cycle) for the DUART, which drives DTACK
+    /// itself; everything else is acknowledged right away by the DTACK
+    /// generator. This is an estimate from the 68681 bus timing.
+    static const unsigned int kDuartWaitStates = 2;
+
+    /// gets the page covering the given address
+    inline const Page &pageFor(uint32_t address) const {
+      return this->pages[(address >> kPageBits) & (kNumPages - 1)];
+    }
+
   private:
     void loadROM(const std::string path);
     void loadNVRAM(const std::string path);
 
+    void buildMemoryMap(void);
+
+    uint64_t romHash(void) const;
+
+    void bindCpu(void);
+    void unbindCpu(void);
+
+    void runMailbox(void);
+    void deliverDue(void);
+    void runSlice(void);
+    Scheduler::cycles_t nextEventTime(void);
+    void recordInput(unsigned int type, uint32_t data, uint64_t value);
+    void waitForWork(std::chrono::steady_clock::time_point deadline);
+
+    bool cpuIsIdle(void);
+    void idle(void);
+    void pace(void);
+    void resetPacing(void);
+
+    void watchWrites(uint32_t address);
+    void unwatchWrites(void);
+
+    std::chrono::steady_clock::time_point wallTimeFor(Scheduler::cycles_t cycles) const;
+    Scheduler::cycles_t cyclesAtWallTime(std::chrono::steady_clock::time_point time) const;
+
   public:
     void cpuExecutedInstruction(uint64_t address);
     void cpuHookMem(bool read, uint64_t addr, int size, int64_t value);
     void cpuInt(uint32_t intno);
+    int cpuTrapped(void);
+
+  private:
+    void updateInstructionHook(void);
 
   private:
     uint32_t initialPc = 0, initialSp = 0;
 
+    /// observers of executed instructions; the CPU is only hooked if any
+    std::vector<Tracer *> tracers;
+
     std::atomic_bool run = true;
 
+    /// CPU state, while this emulator isn't bound to a thread
+    std::vector<uint8_t> cpuContext;
+    /// emulator that was bound to the thread before we were
+    Emulator *previousEmulator = nullptr;
+    /// predecoded instructions for the ROM; referenced by the CPU state
+    std::vector<uint8_t> decodeCache;
+    /// whether ROM instructions are dispatched from the decode cache
+    bool useDecodeCache = true;
+    /// whether opcodes are looked up in the compact dispatch tables
+    bool compactDispatch = false;
+    /// whether simple DBcc loops may skip ahead several iterations at once
+    bool dbccFastForward = true;
+
+    /// whether calls to the loader's API are serviced natively
+    bool loaderHle = false;
+    /// cycles charged for a natively serviced loader call; about what the
+    /// `rts` alone takes on the 68008
+    unsigned int loaderHleCycles = 32;
+
+    /// amount of memory for translated code
+    static const unsigned int kJitCodeSize = (4 * 1024 * 1024);
+
+    /// whether hot code should be translated to native code
+    bool useJit = false;
+    /// translator attached to the CPU, if any
+    void *jit = nullptr;
+
+    /// maximum number of cycles to run the CPU for without checking for events
+    static const int kMaxSliceCycles = 100000;
+
+    /// events that happen at a particular emulated time
+    Scheduler scheduler;
+    /// cycles executed before the current time slice
+    Scheduler::cycles_t cycles = 0;
+    /// whether the CPU is executing a time slice
+    bool inSlice = false;
+    /// time at which the current time slice ends
+    Scheduler::cycles_t sliceEnd = 0;
+
+    /// work posted by other threads, to be run on the emulation thread
+    std::vector<std::function<void(void)>> mailbox;
+    std::mutex mailboxLock;
+    std::atomic_bool mailboxPending = false;
+    /// signalled when work is posted, or the emulator is stopped
+    std::condition_variable mailboxSignal;
+
+    /// whether emulated time is paced to match the wall clock
+    bool realtime = false;
+    /// wall clock time and emulated time when pacing started
+    std::chrono::steady_clock::time_point realtimeStart;
+    Scheduler::cycles_t realtimeStartCycles = 0;
+
+    /// a peripheral poll can be idle if it repeats within this many cycles
+    static const Scheduler::cycles_t kIdleLoopMaxCycles = 256;
+    /// number of identical polls in a row before the CPU is considered idle
+    static const unsigned int kIdleLoopMatches = 3;
+    /// opcode of `bra.s *`
+    static const uint16_t kBranchToSelf = 0x60FE;
+
+    /// machine state at a peripheral poll
+    typedef struct {
+      /// address of the polling instruction
+      uint32_t pc;
+      /// register that was read, and its value
+      uint32_t address, value;
+      /// bus write count
+      uint64_t writes;
+      /// data and address registers, and the status register
+      uint32_t regs[17];
+    } PollSample;
+
+    /// most recent peripheral poll, and when it happened
+    PollSample lastPoll = {};
+    Scheduler::cycles_t lastPollTime = 0;
+    /// how many polls in a row were identical
+    unsigned int pollMatches = 0;
+    /// set when an idle loop was detected during the current time slice
+    bool idleDetected = false;
+
+    /// bitmask of interrupt levels that are currently asserted
+    uint8_t irqLines = 0;
+
     MC68681 *duart = nullptr;
     TubeDrivers *tubes = nullptr;
     VFD *vfd = nullptr;
     DS1244 *rtc = nullptr;
 
+    LoaderServices *loader = nullptr;
+
+    /// where external inputs are logged to, or replayed from, if anywhere
+    InputRecorder *recorder = nullptr;
+    InputReplayer *replayer = nullptr;
+
+    /// checkpoints of the past, if time travel is enabled
+    TimeTravel *timeTravel = nullptr;
+    /// whether emulation is paused (for time travel, say) until resumed
+    bool paused = false;
+    /// whether the past is being executed again
+    bool reexecuting = false;
+
+    /// whether CPU writes to an address are watched, which address, and the
+    /// instruction count at the last write to it
+    bool watching = false;
+    uint32_t watchAddress = 0;
+    uint64_t lastWatchedWrite = 0;
+
+    /// start of a snapshot file
+    typedef struct {
+      /// identifies the file as a snapshot, and its format version
+      char magic[8];
+      /// size of the CPU context that follows; differs between builds
+      uint32_t contextSize;
+      /// whether RAM words were stored in host byte order
+      uint32_t flags;
+      /// hash of the ROM the snapshot was taken with
+      uint64_t romHash;
+    } SnapshotHeader;
+
     uint8_t memRom[0x20000];
     uint8_t memRam[0x20000];
 
     uint8_t nvram[0x8000];
 
-  private:
-    friend void *Get68kBuffer(bool, uint32_t);
-    friend int Handle68kPeriph(bool, uint8_t, uint32_t, uint32_t *);
-    friend void Unhandled68kTransaction(bool, uint32_t, uint32_t, int);
+    Page pages[kNumPages];
+    /// host memory of the pages that the CPU accesses inline; its write count
+    /// includes all other writes as well
+    m68k_fast_memory fastMemory = {};
+
+    friend class TimeTravel;
+
+    static_assert(kPageBits == M68K_FAST_PAGE_BITS && kAddressBits == M68K_FAST_ADDRESS_BITS,
+                  "CPU and emulator page sizes differ");
 };
 
 #endif
@@ -0,0 +1,180 @@
+#include "InputLog.h"
+#include "Emulator.h"
+#include "MC68681.h"
+#include "Snapshot.h"
+
+#include <cstdint>
+#include <cstring>
+#include <ctime>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <glog/logging.h>
+
+/// the last character is the format version
+const char InputLog::kMagic[8] = {'N', 'X', 'I', 'N', 'P', 'U', 'T', '2'};
+
+
+
+/**
+ * Creates the log file, replacing any existing one, and writes its header.
+ */
+InputRecorder::InputRecorder(const std::string &path, const InputLog::Header &header) {
+  this->file.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+  if(!this->file.is_open()) {
+    throw std::runtime_error("Couldn't open input log at " + path);
+  }
+
+  this->file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  this->file.flush();
+}
+
+/**
+ * Appends an input to the log.
+ */
+void InputRecorder::record(const InputLog::Event &event) {
+  this->file.write(reinterpret_cast<const char *>(&event), sizeof(event));
+  this->file.flush();
+
+  LOG_IF(ERROR, !this->file) << "Failed to write to input log";
+}
+
+
+
+/**
+ * Reads the log at the given path. If the recording was cut short, the inputs
+ * up to that point are still replayed.
+ */
+InputReplayer::InputReplayer(Emulator *_emulator, const std::string &path) : emulator(_emulator) {
+  StateReader log(path);
+
+  log.get(this->header);
+
+  if(memcmp(this->header.magic, InputLog::kMagic, sizeof(this->header.magic)) != 0) {
+    throw std::runtime_error("Not an input log of this version: " + path);
+  }
+
+  // a partially written event at the end is ignored
+  this->log.resize(log.remaining() / sizeof(InputLog::Event));
+  log.getBytes(this->log.data(), this->log.size() * sizeof(InputLog::Event));
+
+  this->rewind(0);
+
+  LOG(INFO) << "Replaying " << this->log.size() << " inputs from `" << path << "`";
+}
+
+/**
+ * Sets up to replay inputs that were kept in memory; the emulator keeps going
+ * once they run out.
+ */
+InputReplayer::InputReplayer(Emulator *_emulator, const std::vector<InputLog::Event> &events) :
+                             emulator(_emulator), log(events), stopAtEnd(false) {
+  this->rewind(0);
+}
+
+/**
+ * Goes back to the given position in the log, so the inputs from there on are
+ * delivered again.
+ */
+void InputReplayer::rewind(size_t position) {
+  this->nextInput = this->skipTo(position, false);
+  this->nextClock = this->skipTo(position, true);
+}
+
+/**
+ * Finds the first clock read, or other input, at or after the given index.
+ */
+size_t InputReplayer::skipTo(size_t index, bool clock) const {
+  while(index < this->log.size() && (this->log[index].type == InputLog::kHostClock) != clock) {
+    index++;
+  }
+
+  return index;
+}
+
+/**
+ * Delivers all inputs that were observed at or before the given time. This is
+ * called between time slices, at the same point as work from other threads
+ * would be run.
+ */
+void InputReplayer::runUntil(Scheduler::cycles_t now, uint64_t instructions) {
+  while(this->nextInput < this->log.size() && this->log[this->nextInput].cycles <= now) {
+    const InputLog::Event &event = this->log[this->nextInput];
+    this->nextInput = this->skipTo(this->nextInput + 1, false);
+
+    this->check(event, now, instructions);
+
+    switch(event.type) {
+      case InputLog::kUartRx:
+        this->emulator->getDuart()->receiveByte((MC68681::ChannelType) event.data, event.value);
+        break;
+
+      // nothing to do; the emulator just needed to stop skipping ahead here
+      case InputLog::kWake:
+        break;
+
+      case InputLog::kEnd:
+        this->complete = true;
+
+        if(this->emulator->stateHash() != event.value) {
+          LOG(ERROR) << "Replay ended in a different machine state than the recording";
+          this->diverged = true;
+        }
+        break;
+
+      default:
+        LOG(ERROR) << "Unknown input type " << event.type << " at cycle " << event.cycles;
+        break;
+    }
+
+    if(this->stopAtEnd && this->nextInput == this->log.size()) {
+      LOG_IF(WARNING, !this->complete) << "Input log ends before the recording was stopped";
+
+      LOG(INFO) << "Replay finished at cycle " << now << ", " << instructions << " instructions; "
+                << (this->diverged ? "it DIVERGED from the recording" : "identical to the recording");
+
+      this->emulator->stop();
+    }
+  }
+}
+
+/**
+ * Gets the host clock reading that was recorded for a read at the given time.
+ * Returns false if there are none left, in which case the caller should read
+ * the host's clock itself.
+ */
+bool InputReplayer::readHostClock(Scheduler::cycles_t now, uint64_t instructions,
+                                  std::time_t &seconds, unsigned int &millis) {
+  if(this->nextClock == this->log.size()) {
+    return false;
+  }
+
+  const InputLog::Event &event = this->log[this->nextClock];
+  this->nextClock = this->skipTo(this->nextClock + 1, true);
+
+  this->check(event, now, instructions);
+
+  seconds = event.value;
+  millis = event.data;
+
+  return true;
+}
+
+/**
+ * Makes sure an input is observed at the same point as during the recording;
+ * the first time it isn't, this is reported.
+ */
+void InputReplayer::check(const InputLog::Event &event, Scheduler::cycles_t now,
+                          uint64_t instructions) {
+  if(this->diverged || (event.cycles == now && event.instructions == instructions)) {
+    return;
+  }
+
+  LOG(ERROR) << "Replay diverged: input recorded at cycle " << event.cycles << " ("
+             << event.instructions << " instructions) observed at cycle " << now << " ("
+             << instructions << " instructions)";
+
+  this->diverged = true;
+}
@@ -0,0 +1,137 @@
+/**
+ * Recording and replay of everything that enters the emulated machine from the
+ * outside: bytes received on the UARTs, reads of the host's clock, and, in
+ * real time mode, the points at which the emulator woke up from idling.
+ *
+ * Inputs are logged with the emulated cycle (and instruction count) at which
+ * the CPU observed them. Replaying the log injects them at exactly the same
+ * points, without any sockets or threads, so the run is reproduced exactly and
+ * as fast as the CPU can go; the recorded instruction counts and a hash of the
+ * final machine state show whether it was.
+ */
+#ifndef INPUTLOG_H
+#define INPUTLOG_H
+
+#include "Scheduler.h"
+
+#include <cstdint>
+#include <algorithm>
+#include <ctime>
+#include <fstream>
+#include <string>
+#include <vector>
+
+class Emulator;
+
+class InputLog {
+  public:
+    /// start of a log file
+    typedef struct {
+      /// identifies the file as an input log, and its format version
+      char magic[8];
+      /// whether loader calls were serviced natively, and what they cost
+      uint32_t loaderHle;
+      uint32_t loaderHleCycles;
+      /// whether UART characters moved instantly, rather than at the baud rate
+      uint32_t uartUnthrottled;
+      /// hash of the ROM
+      uint64_t romHash;
+      /// emulated time and instruction count when recording started
+      uint64_t cycles;
+      uint64_t instructions;
+    } Header;
+
+    typedef enum: uint32_t {
+      /// a byte was received: data is the channel, value the byte
+      kUartRx = 1,
+      /// the host's clock was read: data is milliseconds, value the seconds
+      kHostClock = 2,
+      /// the emulator woke up while idle in real time mode
+      kWake = 3,
+      /// the emulator was stopped: value is a hash of the machine state
+      kEnd = 4,
+    } EventType;
+
+    /// a single input
+    typedef struct {
+      /// emulated time and instruction count at which it was observed
+      uint64_t cycles;
+      uint64_t instructions;
+
+      EventType type;
+      uint32_t data;
+      uint64_t value;
+    } Event;
+
+    static const char kMagic[8];
+};
+
+/**
+ * Writes inputs to a log file as they happen; the file is flushed after every
+ * event, so it stays usable if the emulator is killed.
+ */
+class InputRecorder {
+  public:
+    InputRecorder(const std::string &path, const InputLog::Header &header);
+
+    void record(const InputLog::Event &event);
+
+  private:
+    std::fstream file;
+};
+
+/**
+ * Feeds the inputs from a log back into the emulator. A replay of a log file
+ * stops the emulator at the end; one of inputs kept in memory doesn't.
+ */
+class InputReplayer {
+  public:
+    InputReplayer(Emulator *emulator, const std::string &path);
+    InputReplayer(Emulator *emulator, const std::vector<InputLog::Event> &events);
+
+    const InputLog::Header &getHeader(void) const {
+      return this->header;
+    }
+
+    /// time of the next input delivered between time slices
+    Scheduler::cycles_t nextEventTime(void) const {
+      return (this->nextInput < this->log.size()) ? this->log[this->nextInput].cycles : Scheduler::kNever;
+    }
+
+    /// number of inputs from the start of the log that have been delivered
+    size_t position(void) const {
+      return std::min(this->nextInput, this->nextClock);
+    }
+
+    void rewind(size_t position);
+
+    void runUntil(Scheduler::cycles_t now, uint64_t instructions);
+    bool readHostClock(Scheduler::cycles_t now, uint64_t instructions, std::time_t &seconds,
+                       unsigned int &millis);
+
+  private:
+    size_t skipTo(size_t index, bool clock) const;
+    void check(const InputLog::Event &event, Scheduler::cycles_t now, uint64_t instructions);
+
+  private:
+    Emulator *emulator;
+
+    InputLog::Header header = {};
+
+    /// all inputs, in the order they were observed
+    std::vector<InputLog::Event> log;
+    /// next input delivered between time slices (UART bytes, wakeups, the
+    /// end), and next read of the host's clock, which happens while
+    /// instructions execute
+    size_t nextInput = 0, nextClock = 0;
+
+    /// whether the emulator is stopped at the end of the log
+    bool stopAtEnd = true;
+
+    /// whether the replay went differently from the recording
+    bool diverged = false;
+    /// whether the log ended with the emulator being stopped
+    bool complete = false;
+};
+
+#endif
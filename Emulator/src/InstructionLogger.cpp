@@ -0,0 +1,25 @@
+#include "InstructionLogger.h"
+
+#include "Emulator.h"
+
+#include <cstring>
+#include <string>
+
+#include <glog/logging.h>
+
+/**
+ * Disassembles the instruction, and logs it with the current registers.
+ */
+void InstructionLogger::instructionExecuted(Emulator *emu, uint32_t address) {
+  // disassemble
+  char instrBuffer[48];
+  memset(&instrBuffer, 0, sizeof(instrBuffer));
+
+  m68k_disassemble(instrBuffer, address, M68K_CPU_TYPE_68000);
+
+  // log instruction and registers
+  Emulator::M68kRegs regs;
+  emu->getRegs(regs);
+
+  LOG(INFO) << "TRACE: address = $" << std::hex << address << ": " << std::string(instrBuffer) << std::endl << regs;
+}
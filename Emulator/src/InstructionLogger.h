@@ -0,0 +1,14 @@
+/**
+ * Tracer that logs every instruction executed, along with the registers.
+ */
+#ifndef INSTRUCTIONLOGGER_H
+#define INSTRUCTIONLOGGER_H
+
+#include "Tracer.h"
+
+class InstructionLogger : public Tracer {
+  public:
+    void instructionExecuted(Emulator *emu, uint32_t address);
+};
+
+#endif
@@ -0,0 +1,292 @@
+#include "IoReactor.h"
+
+#include <cerrno>
+#include <csignal>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+#ifdef __linux__
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#endif
+
+#include <glog/logging.h>
+
+/**
+ * Sets up the wakeup descriptor, and starts the reactor thread.
+ */
+IoReactor::IoReactor() {
+  // a client going away shouldn't kill the emulator while writing to it
+  signal(SIGPIPE, SIG_IGN);
+
+#ifdef __linux__
+  this->epollFd = epoll_create1(EPOLL_CLOEXEC);
+  PCHECK(this->epollFd != -1) << "Error creating epoll instance";
+
+  this->wakeFd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+  PCHECK(this->wakeFd != -1) << "Error creating eventfd";
+
+  this->wakeWriteFd = this->wakeFd;
+
+  struct epoll_event event = {};
+  event.events = EPOLLIN;
+  event.data.fd = this->wakeFd;
+
+  PCHECK(epoll_ctl(this->epollFd, EPOLL_CTL_ADD, this->wakeFd, &event) == 0)
+      << "Error registering eventfd";
+#else
+  int fds[2];
+  PCHECK(pipe(fds) == 0) << "Error creating wakeup pipe";
+
+  for(int fd : fds) {
+    fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+    fcntl(fd, F_SETFD, FD_CLOEXEC);
+  }
+
+  this->wakeFd = fds[0];
+  this->wakeWriteFd = fds[1];
+#endif
+
+  this->thread = new std::thread(&IoReactor::loop, this);
+}
+
+/**
+ * Stops the reactor thread. Registered descriptors aren't closed; they belong
+ * to whoever registered them.
+ */
+IoReactor::~IoReactor() {
+  this->run = false;
+  this->wake();
+
+  this->thread->join();
+  delete this->thread;
+
+  close(this->wakeFd);
+
+  if(this->wakeWriteFd != this->wakeFd) {
+    close(this->wakeWriteFd);
+  }
+
+#ifdef __linux__
+  close(this->epollFd);
+#endif
+}
+
+
+
+/**
+ * Starts watching a descriptor for the given events (kReadable, kWritable);
+ * errors and hangups are always reported. The descriptor should be non
+ * blocking. Returns false if it can't be watched because it's always ready,
+ * like a regular file.
+ */
+bool IoReactor::add(int fd, unsigned int interest, handler_t handler) {
+#ifdef __linux__
+  struct epoll_event event = {};
+  event.events = ((interest & kReadable) ? EPOLLIN : 0) | ((interest & kWritable) ? EPOLLOUT : 0);
+  event.data.fd = fd;
+
+  if(epoll_ctl(this->epollFd, EPOLL_CTL_ADD, fd, &event) != 0) {
+    PCHECK(errno == EPERM) << "Error registering fd " << fd;
+    return false;
+  }
+#else
+  struct stat info;
+
+  if(fstat(fd, &info) == 0 && S_ISREG(info.st_mode)) {
+    return false;
+  }
+#endif
+
+  this->handlers[fd] = {interest, handler};
+  return true;
+}
+
+/**
+ * Changes the events a registered descriptor is watched for.
+ */
+void IoReactor::setInterest(int fd, unsigned int interest) {
+  auto it = this->handlers.find(fd);
+
+  if(it == this->handlers.end() || it->second.interest == interest) {
+    return;
+  }
+
+  it->second.interest = interest;
+
+#ifdef __linux__
+  struct epoll_event event = {};
+  event.events = ((interest & kReadable) ? EPOLLIN : 0) | ((interest & kWritable) ? EPOLLOUT : 0);
+  event.data.fd = fd;
+
+  PCHECK(epoll_ctl(this->epollFd, EPOLL_CTL_MOD, fd, &event) == 0) << "Error updating fd " << fd;
+#endif
+}
+
+/**
+ * Stops watching a descriptor. This must be done before it's closed.
+ */
+void IoReactor::remove(int fd) {
+  if(!this->handlers.erase(fd)) {
+    return;
+  }
+
+#ifdef __linux__
+  PLOG_IF(ERROR, epoll_ctl(this->epollFd, EPOLL_CTL_DEL, fd, nullptr) != 0)
+      << "Error unregistering fd " << fd;
+#endif
+}
+
+/**
+ * Sets work that runs on the reactor thread every time it's woken up. This
+ * must be called before anything wakes it.
+ */
+void IoReactor::setWakeHandler(work_t handler) {
+  this->wakeHandler = handler;
+}
+
+/**
+ * Queues work to run on the reactor thread. This may be called from any
+ * thread.
+ */
+void IoReactor::post(work_t work) {
+  {
+    std::lock_guard<std::mutex> guard(this->postLock);
+    this->posted.push_back(work);
+  }
+
+  this->wake();
+}
+
+/**
+ * Wakes up the reactor thread, so it runs posted work and the wake handler.
+ * This may be called from any thread; wakeups that come in before the thread
+ * gets around to them are coalesced.
+ */
+void IoReactor::wake(void) {
+#ifdef __linux__
+  uint64_t value = 1;
+#else
+  uint8_t value = 1;
+#endif
+
+  ssize_t err = write(this->wakeWriteFd, &value, sizeof(value));
+  PLOG_IF(ERROR, err == -1 && errno != EAGAIN) << "Error waking I/O thread";
+}
+
+
+
+/**
+ * Main loop of the reactor thread.
+ */
+void IoReactor::loop(void) {
+  while(this->run) {
+    this->waitForEvents();
+  }
+}
+
+/**
+ * Waits for any descriptor to become ready, and calls the handlers of those
+ * that did.
+ */
+void IoReactor::waitForEvents(void) {
+#ifdef __linux__
+  struct epoll_event events[kMaxEvents];
+
+  int count = epoll_wait(this->epollFd, events, kMaxEvents, -1);
+
+  if(count == -1) {
+    PLOG_IF(ERROR, errno != EINTR) << "Error waiting for I/O";
+    return;
+  }
+
+  for(int i = 0; i < count; i++) {
+    unsigned int ready = 0;
+
+    ready |= (events[i].events & EPOLLIN) ? kReadable : 0;
+    ready |= (events[i].events & EPOLLOUT) ? kWritable : 0;
+    ready |= (events[i].events & (EPOLLERR | EPOLLHUP)) ? kHangup : 0;
+
+    this->dispatch(events[i].data.fd, ready);
+  }
+#else
+  std::vector<struct pollfd> fds;
+  fds.push_back({this->wakeFd, POLLIN, 0});
+
+  for(const auto &it : this->handlers) {
+    short interest = ((it.second.interest & kReadable) ? POLLIN : 0) |
+                     ((it.second.interest & kWritable) ? POLLOUT : 0);
+    fds.push_back({it.first, interest, 0});
+  }
+
+  if(poll(fds.data(), fds.size(), -1) == -1) {
+    PLOG_IF(ERROR, errno != EINTR) << "Error waiting for I/O";
+    return;
+  }
+
+  for(const struct pollfd &fd : fds) {
+    unsigned int ready = 0;
+
+    ready |= (fd.revents & POLLIN) ? kReadable : 0;
+    ready |= (fd.revents & POLLOUT) ? kWritable : 0;
+    ready |= (fd.revents & (POLLERR | POLLHUP | POLLNVAL)) ? kHangup : 0;
+
+    if(ready) {
+      this->dispatch(fd.fd, ready);
+    }
+  }
+#endif
+}
+
+/**
+ * Handles events on a descriptor.
+ */
+void IoReactor::dispatch(int fd, unsigned int events) {
+  if(fd == this->wakeFd) {
+    this->woken();
+    return;
+  }
+
+  // an earlier handler may have removed it
+  auto it = this->handlers.find(fd);
+
+  if(it != this->handlers.end()) {
+    // the handler may remove itself, so don't call it through the map
+    handler_t handler = it->second.handler;
+    handler(events);
+  }
+}
+
+/**
+ * Clears the wakeup, then runs posted work and the wake handler.
+ */
+void IoReactor::woken(void) {
+  uint8_t buffer[64];
+
+  while(read(this->wakeFd, buffer, sizeof(buffer)) > 0) {
+    // a pipe may hold several wakeups
+  }
+
+  std::vector<work_t> work;
+
+  {
+    std::lock_guard<std::mutex> guard(this->postLock);
+    work.swap(this->posted);
+  }
+
+  for(auto &callback : work) {
+    callback();
+  }
+
+  if(this->wakeHandler) {
+    this->wakeHandler();
+  }
+}
@@ -0,0 +1,84 @@
+/**
+ * Event loop for the emulator's host I/O. A single thread waits for any of the
+ * registered file descriptors to become ready (with epoll on Linux, poll()
+ * elsewhere) and calls their handlers. Other threads wake it through an
+ * eventfd (or a pipe) to hand it work.
+ *
+ * Descriptors may only be registered and changed on the reactor's thread,
+ * i.e. from a handler or from work posted to it.
+ */
+#ifndef IOREACTOR_H
+#define IOREACTOR_H
+
+#include <atomic>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+class IoReactor {
+  public:
+    /// readiness of a file descriptor, and interest in it
+    typedef enum {
+      kReadable = (1 << 0),
+      kWritable = (1 << 1),
+      /// error or hangup; always reported
+      kHangup = (1 << 2),
+    } Events;
+
+    /// called on the reactor thread with the events that occurred
+    typedef std::function<void(unsigned int events)> handler_t;
+    /// work to run on the reactor thread
+    typedef std::function<void(void)> work_t;
+
+  public:
+    IoReactor();
+    ~IoReactor();
+
+    bool add(int fd, unsigned int interest, handler_t handler);
+    void setInterest(int fd, unsigned int interest);
+    void remove(int fd);
+
+    void setWakeHandler(work_t handler);
+
+    void post(work_t work);
+    void wake(void);
+
+  private:
+    void loop(void);
+    void waitForEvents(void);
+    void dispatch(int fd, unsigned int events);
+    void woken(void);
+
+  private:
+    /// most events handled per wait
+    static const size_t kMaxEvents = 16;
+
+  private:
+    typedef struct {
+      unsigned int interest;
+      handler_t handler;
+    } Registration;
+
+    std::atomic_bool run = true;
+    std::thread *thread = nullptr;
+
+    /// descriptor that wakes the reactor when written to, and the other end
+    /// of the pipe it is on platforms without eventfd
+    int wakeFd = -1, wakeWriteFd = -1;
+#ifdef __linux__
+    int epollFd = -1;
+#endif
+
+    /// registered descriptors; only accessed on the reactor thread
+    std::unordered_map<int, Registration> handlers;
+    /// called on every wakeup
+    work_t wakeHandler;
+
+    /// work posted from other threads
+    std::mutex postLock;
+    std::vector<work_t> posted;
+};
+
+#endif
@@ -0,0 +1,289 @@
+#include "LoaderServices.h"
+#include "Emulator.h"
+#include "MC68681.h"
+
+#include <cstdint>
+#include <ctime>
+
+#include <glog/logging.h>
+
+extern "C" {
+  #include "musashi/m68k.h"
+}
+
+/// log every service call
+#define LOG_CALLS               0
+
+
+
+/**
+ * Converts a binary value (0-99) to BCD, as the RTC stores it.
+ */
+static uint8_t ToBcd(unsigned int value) {
+  return ((value / 10) << 4) | (value % 10);
+}
+
+
+
+/**
+ * Sets up the service emulation for the given emulator.
+ */
+LoaderServices::LoaderServices(Emulator *_emulator) : emulator(_emulator) {
+
+}
+
+/**
+ * Sets the RTC to the given time, from which it then advances with emulated
+ * time, rather than following the host's clock. The time is broken down as if
+ * it were UTC; no time zone is applied.
+ */
+void LoaderServices::setClock(std::time_t time) {
+  this->fixedClock = true;
+  this->clockTime = time;
+  this->clockSetAt = this->emulator->now();
+}
+
+/**
+ * Services a call to the API entry point, as if the loader had run it, then
+ * returns to the caller. The given number of cycles is charged for the call;
+ * this is the return value, as the CPU's trap callback expects.
+ *
+ * Like the loader, the function number is in the low byte of d0, and the
+ * result is returned in d0; all other registers are preserved.
+ *
+ * While the UARTs send and receive at their baud rate, UART transfers are
+ * declined (by returning -1, without touching any registers) so the loader's
+ * own code runs instead: it waits for the transmitter, and for input up to its
+ * timeout, for as long as the hardware actually takes.
+ */
+int LoaderServices::call(unsigned int cycles) {
+  uint32_t function = (m68k_get_reg(nullptr, M68K_REG_D0) & 0xFF);
+  int32_t result;
+
+  if((function == 0x01 || function == 0x02) &&
+     !this->emulator->getDuart()->isUnthrottled()) {
+    return -1;
+  }
+
+  switch(function) {
+    case 0x00:
+      result = this->noOp();
+      break;
+    case 0x01:
+      result = this->uartOut();
+      break;
+    case 0x02:
+      result = this->uartIn();
+      break;
+    case 0x03:
+      result = this->delay();
+      break;
+    case 0x04:
+      result = this->readIO();
+      break;
+    case 0x05:
+      result = this->writeIO();
+      break;
+    case 0x06:
+      result = this->readRtc();
+      break;
+    case 0x07:
+      result = this->writeRtc();
+      break;
+
+    // out of range of the service table
+    default:
+      result = -1;
+      break;
+  }
+
+#if LOG_CALLS
+  VLOG(1) << "Loader service $" << std::hex << function << " = " << std::dec << result;
+#endif
+
+  m68k_set_reg(M68K_REG_D0, (uint32_t) result);
+
+  // rts
+  uint32_t sp = m68k_get_reg(nullptr, M68K_REG_A7);
+
+  m68k_set_reg(M68K_REG_PC, m68k_read_memory_32(sp));
+  m68k_set_reg(M68K_REG_A7, sp + 4);
+
+  return cycles;
+}
+
+
+
+/**
+ * $00: Does nothing.
+ */
+int32_t LoaderServices::noOp(void) {
+  return 0;
+}
+
+/**
+ * $01: Writes the buffer at a1 to a UART. The high word of d1 is the number of
+ * bytes, the low word the UART. Only serviced with the UARTs unthrottled, when
+ * the transmitter takes any number of bytes right away.
+ */
+int32_t LoaderServices::uartOut(void) {
+  uint32_t d1 = m68k_get_reg(nullptr, M68K_REG_D1);
+  uint32_t buffer = m68k_get_reg(nullptr, M68K_REG_A1);
+
+  uint16_t uart = (d1 & 0xFFFF), length = (d1 >> 16);
+
+  if(uart >= 2) {
+    return -2;
+  } else if(length == 0) {
+    return -1;
+  }
+
+  MC68681 *duart = this->emulator->getDuart();
+  uint32_t regs = (uart * kDuartChannelStride);
+
+  for(uint16_t i = 0; i < length; i++) {
+    // the loader gives up if the transmitter never becomes ready
+    if((duart->busRead(regs + kDuartStatus, BusPeripheral::kBusSize8Bits) & 0x0C) == 0) {
+      return -1;
+    }
+
+    uint8_t byte = m68k_read_memory_8(buffer + i);
+    duart->busWrite(regs + kDuartData, byte, BusPeripheral::kBusSize8Bits);
+  }
+
+  return 0;
+}
+
+/**
+ * $02: Reads up to as many bytes from a UART into the buffer at a1 as there
+ * are received, with the same d1 as for uartOut(). Returns the number of bytes
+ * read, or -1 if there were none. Like uartOut(), this is only serviced with
+ * the UARTs unthrottled.
+ */
+int32_t LoaderServices::uartIn(void) {
+  uint32_t d1 = m68k_get_reg(nullptr, M68K_REG_D1);
+  uint32_t buffer = m68k_get_reg(nullptr, M68K_REG_A1);
+
+  uint16_t uart = (d1 & 0xFFFF), length = (d1 >> 16);
+
+  if(uart >= 2) {
+    return -2;
+  } else if(length == 0) {
+    return -1;
+  }
+
+  MC68681 *duart = this->emulator->getDuart();
+  uint32_t regs = (uart * kDuartChannelStride);
+  int32_t read = 0;
+
+  while(read < length &&
+        (duart->busRead(regs + kDuartStatus, BusPeripheral::kBusSize8Bits) & 0x01)) {
+    uint8_t byte = duart->busRead(regs + kDuartData, BusPeripheral::kBusSize8Bits);
+    m68k_write_memory_8(buffer + read++, byte);
+  }
+
+  // the loader times out if nothing arrives
+  return (read > 0) ? read : -1;
+}
+
+/**
+ * $03: Waits for d1 hundredths of a second. The loader doesn't implement this
+ * either, so it returns right away.
+ */
+int32_t LoaderServices::delay(void) {
+  return 0;
+}
+
+/**
+ * $04: Reads the DUART's input port into Loader_68681In, and returns it.
+ */
+int32_t LoaderServices::readIO(void) {
+  MC68681 *duart = this->emulator->getDuart();
+  uint8_t pins = duart->busRead(kDuartInputPort, BusPeripheral::kBusSize8Bits);
+
+  m68k_write_memory_8(kInputPort, pins);
+
+  return pins;
+}
+
+/**
+ * $05: Changes the DUART's output pins: those in the high word of d1 are set
+ * low, those in the low word high. Naming a pin in both is an error.
+ */
+int32_t LoaderServices::writeIO(void) {
+  uint32_t d1 = m68k_get_reg(nullptr, M68K_REG_D1);
+  uint16_t low = (d1 >> 16), high = (d1 & 0xFFFF);
+
+  if(low & high) {
+    return -1;
+  }
+
+  uint8_t out = m68k_read_memory_8(kOutputPort);
+  out = (out & ~low) | (high & 0xFF);
+  m68k_write_memory_8(kOutputPort, out);
+
+  // the output port pins are inverted: set bits are written to the clear area
+  MC68681 *duart = this->emulator->getDuart();
+
+  duart->busWrite(kDuartClearOutput, out, BusPeripheral::kBusSize8Bits);
+  duart->busWrite(kDuartSetOutput, (uint8_t) ~out, BusPeripheral::kBusSize8Bits);
+
+  return 0;
+}
+
+/**
+ * $06: Fills in the date/time variables (and the raw RTC buffer, in the order
+ * the DS1244 shifts its registers out) from the host's local time, or the time
+ * the clock was set to, in BCD.
+ */
+int32_t LoaderServices::readRtc(void) {
+  struct tm time;
+  std::time_t seconds;
+  unsigned int millis;
+
+  if(this->fixedClock) {
+    Scheduler::cycles_t elapsed = (this->emulator->now() - this->clockSetAt);
+
+    seconds = this->clockTime + (elapsed / Emulator::kCpuClock);
+    millis = ((elapsed % Emulator::kCpuClock) * 1000) / Emulator::kCpuClock;
+
+    gmtime_r(&seconds, &time);
+  } else {
+    this->emulator->readHostClock(seconds, millis);
+    localtime_r(&seconds, &time);
+  }
+
+  const uint8_t regs[8] = {
+    ToBcd((millis % 1000) / 10),
+    ToBcd(time.tm_sec),
+    ToBcd(time.tm_min),
+    ToBcd(time.tm_hour),
+    ToBcd(time.tm_wday + 1),
+    ToBcd(time.tm_mday),
+    ToBcd(time.tm_mon + 1),
+    ToBcd(time.tm_year % 100)
+  };
+
+  for(size_t i = 0; i < sizeof(regs); i++) {
+    m68k_write_memory_8(kRtcBuffer + i, regs[i]);
+  }
+
+  // Year, Month, Day, DayOfWeek, Hours, Minutes, Seconds, MSeconds
+  const uint8_t vars[8] = {
+    regs[7], regs[6], regs[5], regs[4], regs[3], regs[2], regs[1], regs[0]
+  };
+
+  for(size_t i = 0; i < sizeof(vars); i++) {
+    m68k_write_memory_8(kDateTimeBase + i, vars[i]);
+  }
+
+  return 0;
+}
+
+/**
+ * $07: Writes the date/time variables to the RTC. The emulated clock can only
+ * be set from the host, so there's nothing to do.
+ */
+int32_t LoaderServices::writeRtc(void) {
+  return 0;
+}
@@ -0,0 +1,66 @@
+/**
+ * High level emulation of the bootloader's service API. Applications call
+ * into the loader with `jsr Loader_API_Entry`; when this is enabled, the CPU
+ * traps at the entry point, and the call is serviced natively according to
+ * the register contract in `Software/docs/Loader API.md`, rather than by the
+ * loader polling the hardware a bit or byte at a time.
+ */
+#ifndef LOADERSERVICES_H
+#define LOADERSERVICES_H
+
+#include "Scheduler.h"
+
+#include <cstdint>
+#include <ctime>
+
+class Emulator;
+
+class LoaderServices {
+  public:
+    /// address of Loader_API_Entry in ROM
+    static const uint32_t kApiEntry = 0x7F80;
+
+  public:
+    LoaderServices(Emulator *emulator);
+
+    int call(unsigned int cycles);
+
+    void setClock(std::time_t time);
+
+  private:
+    int32_t noOp(void);
+    int32_t uartOut(void);
+    int32_t uartIn(void);
+    int32_t delay(void);
+    int32_t readIO(void);
+    int32_t writeIO(void);
+    int32_t readRtc(void);
+    int32_t writeRtc(void);
+
+  private:
+    /// loader variables (RAM_Loader = $60000)
+    static const uint32_t kDateTimeBase = 0x60030;
+    static const uint32_t kRtcBuffer = (kDateTimeBase + 0x08);
+    static const uint32_t kOutputPort = 0x60040;
+    static const uint32_t kInputPort = 0x60041;
+
+    /// DUART registers, relative to its page
+    static const uint32_t kDuartStatus = 0x01;
+    static const uint32_t kDuartData = 0x03;
+    static const uint32_t kDuartInputPort = 0x0D;
+    static const uint32_t kDuartSetOutput = 0x0E;
+    static const uint32_t kDuartClearOutput = 0x0F;
+    /// offset between channel A and B registers
+    static const uint32_t kDuartChannelStride = 0x08;
+
+  private:
+    Emulator *emulator;
+
+    /// whether the RTC follows a set time rather than the host's clock
+    bool fixedClock = false;
+    /// time the RTC was set to (as UTC), and the emulated time it was set at
+    std::time_t clockTime = 0;
+    Scheduler::cycles_t clockSetAt = 0;
+};
+
+#endif
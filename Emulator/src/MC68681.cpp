@@ -1,19 +1,17 @@
 #include "MC68681.h"
+#include "Emulator.h"
+#include "IoReactor.h"
+#include "Snapshot.h"
+#include "UartBackend.h"
 
 #include <iostream>
 #include <iomanip>
+#include <atomic>
+#include <cerrno>
 #include <cstdint>
 #include <queue>
-#include <mutex>
 #include <thread>
 
-#include <unistd.h>
-#include <netdb.h>
-#include <netinet/in.h>
-#include <netinet/tcp.h>
-#include <sys/socket.h>
-#include <sys/types.h>
-
 #include <glog/logging.h>
 
 extern "C" {
@@ -22,8 +20,6 @@ extern "C" {
 
 #define CHANNEL_NAME(x) ((x == kChannelA) ? "Channel A" : "Channel B")
 
-void MC68681_ReaderThreadEntry(void *_ctx, MC68681::ChannelType channel);
-
 /// log all register writes
 #define LOG_REG_WRITE     0
 /// log all register reads
@@ -32,36 +28,22 @@ void MC68681_ReaderThreadEntry(void *_ctx, MC68681::ChannelType channel);
 
 
 /**
- * Initializes the controller.
+ * Initializes the controller. Both channels start out without a backend;
+ * anything they transmit is discarded until one is attached.
  */
 MC68681::MC68681(Emulator *emulator) : BusPeripheral(emulator) {
-  // open listening sockets
-  this->openSocket(kChannelA, MC68681::uartAPort);
+
 }
 
 /**
- * Cleans up sockets and associated resources.
+ * Cleans up the backends and the reactor.
  */
 MC68681::~MC68681() {
-  // clear run flag
-  this->run = false;
+  // stop the reactor first, so nothing touches the backends as they go away
+  delete this->reactor;
 
-  // close sockets and delete threads
   for(int i = 0; i < 2; i++) {
-    // close regular socket
-    if(this->channelState[i].socket) {
-      close(this->channelState[i].socket);
-    }
-
-    // close listening socket
-    if(this->channelState[i].listenSocket) {
-      close(this->channelState[i].listenSocket);
-    }
-
-    // delete thread
-    if(this->channelState[i].readerThread) {
-      delete this->channelState[i].readerThread;
-    }
+    delete this->channelState[i].backend;
   }
 }
 
@@ -120,10 +102,17 @@ void MC68681::busWrite(uint32_t addr, uint32_t data, bus_size_t size) {
 
     // Aux control register
     case 0x04:
+      this->auxControl = (data & 0xFF);
+
+      // pick up the new clock source
+      if(this->timerRunning) {
+        this->startTimer();
+      }
       break;
 
     // interrupt mask register
     case 0x05:
+      this->irqMask = (data & 0xFF);
       break;
 
     // counter/timer upper byte
@@ -159,6 +148,9 @@ void MC68681::busWrite(uint32_t addr, uint32_t data, bus_size_t size) {
       LOG(FATAL) << "Invalid register: $" << std::hex << reg;
       break;
   }
+
+  // the write may have changed the interrupt state
+  this->updateIrq();
 }
 
 /**
@@ -212,6 +204,7 @@ uint32_t MC68681::busRead(uint32_t addr, bus_size_t size) {
 
     // interrupt status register
     case 0x05:
+      outData = this->interruptStatus();
       break;
 
     // counter/timer upper byte
@@ -231,8 +224,7 @@ uint32_t MC68681::busRead(uint32_t addr, bus_size_t size) {
 
     // input port data
     case 0x0D:
-      // just have VFD BUSY low all the time
-      outData = 0;
+      outData = this->inputPort;
       break;
 
     // start timer/counter
@@ -255,6 +247,9 @@ uint32_t MC68681::busRead(uint32_t addr, bus_size_t size) {
   VLOG(1) << "read reg $" << std::hex << ((unsigned int) reg) << std::setw(2) << ": $" << ((unsigned int) outData);
 #endif
 
+  // the read may have changed the interrupt state
+  this->updateIrq();
+
   return outData;
 }
 
@@ -269,7 +264,15 @@ void MC68681::modeRegWrite(ChannelType type, uint8_t data) {
           << ((unsigned int) data);
 #endif
 
-  // XXX: we don't really care about what's written to this register
+  // MR1 first, then MR2 until the pointer is reset
+  auto &channel = this->channelState[type];
+
+  if(channel.modeRegPtr == 0) {
+    channel.mode1 = data;
+    channel.modeRegPtr = 1;
+  } else {
+    channel.mode2 = data;
+  }
 }
 
 /**
@@ -281,7 +284,11 @@ void MC68681::clockSelWrite(ChannelType type, uint8_t data) {
           << ((unsigned int) data);
 #endif
 
-  // TODO: implement
+  // the receiver's clock is in the upper nibble, the transmitter's in the lower
+  this->channelState[type].clockSel = data;
+
+  LOG_IF(WARNING, ((data >> 4) >= 0xE || (data & 0x0F) >= 0xE) && !this->unthrottled)
+      << CHANNEL_NAME(type) << ": external clocks aren't supported; characters will move instantly";
 }
 
 /**
@@ -312,6 +319,11 @@ void MC68681::commandWrite(ChannelType type, uint8_t data) {
 
         this->channelState[type].rxOn = false;
         std::queue<uint8_t>().swap(this->channelState[type].rxFifo);
+        this->channelState[type].overrunErr = false;
+
+        if(this->unthrottled) {
+          this->scheduleHostRx(type);
+        }
         break;
       // reset transmitter
       case 0b0011:
@@ -319,6 +331,9 @@ void MC68681::commandWrite(ChannelType type, uint8_t data) {
 
         this->channelState[type].txOn = false;
         std::queue<uint8_t>().swap(this->channelState[type].txFifo);
+
+        this->emulator->cancelEvent(this->channelState[type].txEvent);
+        this->channelState[type].txEvent = Scheduler::kInvalidEvent;
         break;
       // reset error flags
       case 0b0100:
@@ -426,16 +441,16 @@ uint8_t MC68681::statusRead(ChannelType type) {
     status |= (1 << 4);
   }
 
-  // tx fifo empty AND tx enabled?
+  // TXEMT: holding and shift register both empty, and tx enabled
   if(this->channelState[type].txFifo.empty() && this->channelState[type].txOn) {
     status |= (1 << 3);
   }
-  // tx ready when tx fifo has less than 2 characters
-  if(this->channelState[type].txFifo.size() < 3 && this->channelState[type].txOn) {
+  // TXRDY: holding register empty, i.e. at most the shift register is busy
+  if(this->channelState[type].txFifo.size() < 2 && this->channelState[type].txOn) {
     status |= (1 << 2);
   }
-  // FFULL set if if there are 3 bytes in the RX fifo
-  if(this->channelState[type].rxFifo.size() <= 3) {
+  // FFULL set if the RX fifo is full
+  if(this->channelState[type].rxFifo.size() >= kRxFifoSize) {
     status |= (1 << 1);
   }
   // receiver ready bit (at least one byte ready)
@@ -448,22 +463,33 @@ uint8_t MC68681::statusRead(ChannelType type) {
 
 
 /**
- * Writes a byte out to the UART TX FIFO.
+ * Writes a byte into the transmit holding register. It's shifted out once the
+ * transmitter gets to it, and only reaches the host once it's been sent.
+ * Bytes written while the transmitter is disabled are ignored.
  */
 void MC68681::uartWrite(ChannelType type, uint8_t write) {
-  int err;
+  auto &channel = this->channelState[type];
 
-  // push onto queue
-  this->channelState[type].txFifo.push(write);
+  if(!channel.txOn) {
+    VLOG(1) << CHANNEL_NAME(type) << ": transmitter disabled, dropping $"
+            << std::hex << ((unsigned int) write);
+    return;
+  }
 
-  // pop from queue and transmit lol
-  CHECK(this->channelState[type].socket != 0) << "No output socket";
+  if(this->unthrottled) {
+    this->transmitted(type, write);
+    return;
+  }
 
-  uint8_t data = this->channelState[type].txFifo.front();
-  this->channelState[type].txFifo.pop();
+  // a byte written while the holding register is full is lost
+  if(channel.txFifo.size() >= 2) {
+    VLOG(1) << CHANNEL_NAME(type) << ": TX holding register overrun, dropping $"
+            << std::hex << ((unsigned int) write);
+    return;
+  }
 
-  err = ::write(this->channelState[type].socket, &data, sizeof(data));
-  PCHECK(err > 0) << "Error writing to socket";
+  channel.txFifo.push(write);
+  this->startTransmit(type);
 }
 /**
  * Fetches a byte out of the UART holding register.
@@ -474,6 +500,11 @@ uint8_t MC68681::uartRead(ChannelType type) {
     uint8_t byte = this->channelState[type].rxFifo.front();
     this->channelState[type].rxFifo.pop();
 
+    // unthrottled, the host's bytes go straight into the FIFO as it empties
+    if(this->unthrottled) {
+      this->scheduleHostRx(type);
+    }
+
     return byte;
   }
 
@@ -485,112 +516,612 @@ uint8_t MC68681::uartRead(ChannelType type) {
 
 
 /**
- * Starts the timer.
+ * The status registers, interrupt status register and input port may all be
+ * polled safely.
+ */
+bool MC68681::isPollable(uint32_t addr) {
+  switch(addr & 0x0F) {
+    case 0x01:
+    case 0x05:
+    case 0x09:
+    case 0x0D:
+      return true;
+
+    default:
+      return false;
+  }
+}
+
+/**
+ * Writes the register, timer and channel state to a snapshot. Host
+ * connections aren't part of it.
+ */
+void MC68681::saveState(StateWriter &state) {
+  state.put(this->timerPeriod);
+  state.put(this->irqVector);
+  state.put(this->auxControl);
+  state.put(this->irqMask);
+  state.put(this->inputPort);
+
+  state.put(this->timerRunning);
+  state.put(this->counterReady);
+  state.put(this->timerDivider);
+  state.put(this->timerReload);
+  state.put(this->timerDue);
+  state.put(this->timerExpirations);
+
+  for(int i = 0; i < 2; i++) {
+    auto &channel = this->channelState[i];
+
+    state.put(channel.txOn);
+    state.put(channel.rxOn);
+    state.put(channel.breakRx);
+    state.put(channel.parityErr);
+    state.put(channel.framingErr);
+    state.put(channel.overrunErr);
+    state.put(channel.breakChangeIrq);
+    state.put(channel.baudExtendRx);
+    state.put(channel.baudExtendTx);
+    state.put(channel.modeRegPtr);
+    state.put(channel.mode1);
+    state.put(channel.mode2);
+    state.put(channel.clockSel);
+
+    state.put(channel.rxEvent != Scheduler::kInvalidEvent);
+    state.put(channel.rxDue);
+    state.put(channel.txEvent != Scheduler::kInvalidEvent);
+    state.put(channel.txDue);
+
+    // copy the FIFOs, since queues can't be iterated
+    for(std::queue<uint8_t> fifo : {channel.rxFifo, channel.txFifo, channel.rxLine}) {
+      state.put((uint32_t) fifo.size());
+
+      for(; !fifo.empty(); fifo.pop()) {
+        state.put(fifo.front());
+      }
+    }
+  }
+}
+
+/**
+ * Restores the state written by saveState(), and picks the timer and the
+ * transmitters and receivers back up.
+ */
+void MC68681::loadState(StateReader &state) {
+  state.get(this->timerPeriod);
+  state.get(this->irqVector);
+  state.get(this->auxControl);
+  state.get(this->irqMask);
+  state.get(this->inputPort);
+
+  state.get(this->timerRunning);
+  state.get(this->counterReady);
+  state.get(this->timerDivider);
+  state.get(this->timerReload);
+  state.get(this->timerDue);
+  state.get(this->timerExpirations);
+
+  for(int i = 0; i < 2; i++) {
+    auto &channel = this->channelState[i];
+
+    state.get(channel.txOn);
+    state.get(channel.rxOn);
+    state.get(channel.breakRx);
+    state.get(channel.parityErr);
+    state.get(channel.framingErr);
+    state.get(channel.overrunErr);
+    state.get(channel.breakChangeIrq);
+    state.get(channel.baudExtendRx);
+    state.get(channel.baudExtendTx);
+    state.get(channel.modeRegPtr);
+    state.get(channel.mode1);
+    state.get(channel.mode2);
+    state.get(channel.clockSel);
+
+    bool receiving, transmitting;
+
+    state.get(receiving);
+    state.get(channel.rxDue);
+    state.get(transmitting);
+    state.get(channel.txDue);
+
+    for(std::queue<uint8_t> *fifo : {&channel.rxFifo, &channel.txFifo, &channel.rxLine}) {
+      uint32_t size;
+      state.get(size);
+
+      *fifo = std::queue<uint8_t>();
+
+      for(uint32_t j = 0; j < size; j++) {
+        uint8_t byte;
+        state.get(byte);
+
+        fifo->push(byte);
+      }
+    }
+
+    // characters being shifted in and out are still done at the same time
+    this->emulator->cancelEvent(channel.rxEvent);
+    this->emulator->cancelEvent(channel.txEvent);
+    this->emulator->cancelEvent(channel.hostRxEvent);
+    channel.rxEvent = channel.txEvent = channel.hostRxEvent = Scheduler::kInvalidEvent;
+
+    ChannelType type = (i == 0) ? kChannelA : kChannelB;
+
+    // whatever the backend holds arrives in the restored machine
+    this->scheduleHostRx(type);
+
+    if(receiving) {
+      channel.rxEvent = this->emulator->scheduleAt(channel.rxDue, [this, type]() {
+        this->receiveDone(type);
+      });
+    }
+    if(transmitting) {
+      channel.txEvent = this->emulator->scheduleAt(channel.txDue, [this, type]() {
+        this->transmitDone(type);
+      });
+    }
+  }
+
+  // terminal count is still due at the same time
+  this->emulator->cancelEvent(this->timerEvent);
+  this->timerEvent = Scheduler::kInvalidEvent;
+
+  if(this->timerRunning) {
+    this->timerEvent = this->emulator->scheduleAt(this->timerDue, [this]() {
+      this->timerExpired();
+    });
+  }
+
+  this->updateIrq();
+}
+
+/**
+ * Updates the state of an input pin.
+ */
+void MC68681::setInputPin(unsigned int pin, bool high) {
+  CHECK(pin < 6) << "Invalid input pin " << pin;
+
+  if(high) {
+    this->inputPort |= (1 << pin);
+  } else {
+    this->inputPort &= ~(1 << pin);
+  }
+}
+
+
+
+/**
+ * Starts the counter/timer, loading it with the contents of CTUR/CTLR. In
+ * timer mode, this restarts the current cycle.
  */
 void MC68681::startTimer(void) {
-  LOG(INFO) << "Timer started";
+  // figure out the clock source
+  switch((this->auxControl & 0x70) >> 4) {
+    // timer mode, X1/CLK
+    case 0b110:
+      this->timerDivider = 1;
+      break;
+    // counter or timer mode, X1/CLK divided by 16
+    case 0b011:
+    case 0b111:
+      this->timerDivider = 16;
+      break;
+
+    // IP2 and the transmitter clocks aren't supported
+    default:
+      LOG(WARNING) << "Unsupported counter/timer clock source: ACR = $"
+                   << std::hex << ((unsigned int) this->auxControl);
+      return;
+  }
+
+  VLOG(1) << "Timer started: period $" << std::hex << this->timerPeriod
+          << ", divider " << std::dec << this->timerDivider;
+
+  // (re)load the counter
+  this->emulator->cancelEvent(this->timerEvent);
+
+  this->timerRunning = true;
+  this->timerReload = this->emulator->now();
+  this->timerExpirations = 0;
+
+  this->scheduleTimer();
 }
+
 /**
- * Stops the timer.
+ * Handles the stop counter command. This always clears the counter ready
+ * flag; only in counter mode does it actually stop counting.
  */
 void MC68681::stopTimer(void) {
-  LOG(INFO) << "Timer stopped";
+  this->counterReady = false;
+
+  if(!(this->auxControl & 0x40) && this->timerRunning) {
+    VLOG(1) << "Counter stopped";
+
+    this->emulator->cancelEvent(this->timerEvent);
+    this->timerEvent = Scheduler::kInvalidEvent;
+    this->timerRunning = false;
+  }
 }
 
+/**
+ * Schedules an event for when the counter next reaches terminal count.
+ *
+ * In timer mode, the counter generates a square wave whose period is twice
+ * the preload value, and sets counter ready once per period. In counter mode,
+ * it counts down from the preload value once, then keeps counting down from
+ * $FFFF.
+ */
+void MC68681::scheduleTimer(void) {
+  uint64_t preload = this->timerPeriod ? this->timerPeriod : 0x10000;
+  uint64_t ticks;
+
+  if(this->auxControl & 0x40) {
+    ticks = (2 * preload);
+  } else {
+    ticks = (this->timerExpirations == 0) ? preload : 0x10000;
+  }
+
+  // convert from counter clocks to CPU cycles
+  Scheduler::cycles_t cycles = (ticks * this->timerDivider * Emulator::kCpuClock) / kClockFrequency;
 
+  this->timerDue = this->timerReload + cycles;
+  this->timerEvent = this->emulator->scheduleAt(this->timerDue, [this]() {
+    this->timerExpired();
+  });
+}
 
 /**
- * Opens the listening socket for the given UART.
+ * The counter reached terminal count.
  */
-void MC68681::openSocket(ChannelType channel, unsigned int port) {
-  int sockfd, connfd, err;
-  socklen_t cliLen;
-  struct sockaddr_in servaddr, cli;
+void MC68681::timerExpired(void) {
+  this->timerEvent = Scheduler::kInvalidEvent;
+  this->timerExpirations++;
 
-  int yes = 1;
+  this->counterReady = true;
+  this->updateIrq();
 
-  LOG(INFO) << CHANNEL_NAME(channel) << ": listening on port " << port;
+  // it keeps counting from here
+  this->timerReload = this->timerDue;
+  this->scheduleTimer();
+}
 
-  // create socket
-  sockfd = socket(AF_INET, SOCK_STREAM, 0);
-  PCHECK(sockfd != -1) << "Error creating socket";
 
-  this->channelState[channel].listenSocket = sockfd;
 
-  // enable the SO_REUSEADDR option
-  err = setsockopt(sockfd, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
-  PCHECK(err == 0) << "Error setting SO_REUSEADDR";
+/**
+ * Builds the interrupt status register.
+ */
+uint8_t MC68681::interruptStatus(void) {
+  uint8_t isr = 0;
 
-  // enable the TCP_NODELAY option
-  err = setsockopt(sockfd, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
-  PCHECK(err == 0) << "Error setting TCP_NODELAY";
+  for(int i = 0; i < 2; i++) {
+    ChannelType channel = (i == 0) ? kChannelA : kChannelB;
+    uint8_t status = this->statusRead(channel);
+    int shift = (i == 0) ? 0 : 4;
 
-  // assign address
-  servaddr.sin_family = AF_INET;
-  servaddr.sin_addr.s_addr = htonl(INADDR_ANY);
-  servaddr.sin_port = htons(port);
+    // TxRDY
+    if(status & (1 << 2)) {
+      isr |= (1 << (shift + 0));
+    }
+    // RxRDY
+    if(status & (1 << 0)) {
+      isr |= (1 << (shift + 1));
+    }
+    // delta break
+    if(this->channelState[channel].breakChangeIrq) {
+      isr |= (1 << (shift + 2));
+    }
+  }
 
-  err = bind(sockfd, (struct sockaddr *) &servaddr, sizeof(servaddr));
-  PCHECK(err == 0) << "Error binding socket";
+  // counter ready
+  if(this->counterReady) {
+    isr |= (1 << 3);
+  }
 
-  // listen
-  err = listen(sockfd, 5);
-  PCHECK(err == 0) << "Error listening socket";
+  return isr;
+}
 
-  // wait for a connection
-  LOG(WARNING) << "Waiting for connection at port " << port;
+/**
+ * Drives the IRQ output based on the unmasked interrupt sources.
+ */
+void MC68681::updateIrq(void) {
+  bool asserted = (this->interruptStatus() & this->irqMask) != 0;
+  this->emulator->setIrq(kIrqLevel, asserted);
+}
 
-  connfd = accept(sockfd, (struct sockaddr *) &cli, &cliLen);
-  PCHECK(connfd != -1) << "Error accepting connection";
 
-  // assign it
-  this->channelState[channel].socket = connfd;
-  VLOG(1) << "Accepted socket: " << connfd;
 
-  // start a worker thread
-  this->channelState[channel].readerThread = new std::thread(MC68681_ReaderThreadEntry, this, channel);
+/**
+ * Installs a handler that's called with every byte the channel transmits, on
+ * the emulation thread; pass nullptr to remove it.
+ */
+void MC68681::setTransmitHandler(ChannelType channel, tx_handler_t handler) {
+  this->channelState[channel].txHandler = handler;
 }
 
 /**
- * Entry point for the reader thread.
- *
- * ctx contains a pointer to the MC68681 instance.
+ * A byte arrived on the channel's receive line from the host; it's in the RX
+ * FIFO once it's been shifted in. This must be called on the emulation
+ * thread.
  */
-void MC68681_ReaderThreadEntry(void *_ctx, MC68681::ChannelType channel) {
-  // TODO: actually figure out what channel is being used
-  MC68681 *ctx = static_cast<MC68681 *>(_ctx);
+void MC68681::receiveByte(ChannelType channel, uint8_t byte) {
+  if(this->unthrottled) {
+    this->channelState[channel].rxFifo.push(byte);
+    this->updateIrq();
+    return;
+  }
 
-  // call into handler
-  ctx->readerThread(channel);
+  this->channelState[channel].rxLine.push(byte);
+  this->startReceive(channel);
 }
 
+
+
 /**
- * Main loop for the reader thread
+ * Works out how many cycles it takes to shift a single character in or out of
+ * the channel: start bit, data bits, parity bit and stop bits, at the baud
+ * rate picked by the clock select register, ACR bit 7 and the BRG extend bit.
+ * Returns 0 if the clock source isn't supported.
  */
-void MC68681::readerThread(ChannelType channel) {
-  int err;
+Scheduler::cycles_t MC68681::characterTime(ChannelType type, bool receiver) {
+  // baud rates in tenths of a baud, indexed by [BRG extend][ACR bit 7][CSR]
+  static const uint32_t kBaudRates[2][2][13] = {
+    {
+      {500, 1100, 1345, 2000, 3000, 6000, 12000, 10500, 24000, 48000, 72000, 96000, 384000},
+      {750, 1100, 1345, 1500, 3000, 6000, 12000, 20000, 24000, 48000, 18000, 96000, 192000},
+    },
+    {
+      {750, 1100, 1345, 1500, 36000, 144000, 288000, 576000, 1152000, 48000, 18000, 96000, 192000},
+      {500, 1100, 1345, 2000, 36000, 144000, 288000, 576000, 1152000, 48000, 72000, 96000, 384000},
+    },
+  };
+
+  const auto &channel = this->channelState[type];
+
+  // character length, in sixteenths of a bit
+  unsigned int dataBits = 5 + (channel.mode1 & 0x03);
+  unsigned int parityBits = (((channel.mode1 & 0x18) >> 3) == 0b10) ? 0 : 1;
+  unsigned int stopSel = (channel.mode2 & 0x0F);
+
+  // stop bits go from 9/16 (or 17/16 for 5 bit characters) in steps of 1/16,
+  // then jump to 25/16 from the eighth setting on
+  unsigned int stop = (stopSel < 8 && dataBits != 5) ? (9 + stopSel) : (17 + stopSel);
+  uint64_t length = (16 * (1 + dataBits + parityBits)) + stop;
+
+  unsigned int select = receiver ? (channel.clockSel >> 4) : (channel.clockSel & 0x0F);
+  bool extend = receiver ? channel.baudExtendRx : channel.baudExtendTx;
+
+  if(select < 13) {
+    uint32_t baud = kBaudRates[extend][(this->auxControl & 0x80) ? 1 : 0][select];
+    return (length * Emulator::kCpuClock * 10) / (16 * baud);
+  }
+  // the timer's output is the 16x clock, in timer mode
+  else if(select == 0xD && (this->auxControl & 0x40)) {
+    uint64_t preload = this->timerPeriod ? this->timerPeriod : 0x10000;
+    uint64_t bit = (2 * preload * 16 * this->timerDivider * Emulator::kCpuClock) / kClockFrequency;
 
-  int sock = this->channelState[channel].socket;
-  CHECK(sock != 0) << "Error getting read socket for " << CHANNEL_NAME(channel);
+    return (length * bit) / 16;
+  }
 
-  while(this->run) {
-    uint8_t byte = 0;
+  return 0;
+}
 
-    // read from socket
-    err = ::read(sock, &byte, sizeof(byte));
-    PLOG_IF(ERROR, (err == -1)) << "Error reading from socket for " << CHANNEL_NAME(channel);
+/**
+ * Starts shifting out the next byte, if the transmitter is idle and there is
+ * one.
+ */
+void MC68681::startTransmit(ChannelType type) {
+  auto &channel = this->channelState[type];
+
+  if(channel.txEvent != Scheduler::kInvalidEvent || channel.txFifo.empty()) {
+    return;
+  }
 
-    VLOG(2) << "Received byte: $" << std::hex << ((unsigned int) byte);
+  channel.txDue = this->emulator->now() + this->characterTime(type, false);
+  channel.txEvent = this->emulator->scheduleAt(channel.txDue, [this, type]() {
+    this->transmitDone(type);
+  });
+}
 
-    // if not an error, push it
-    if(err == 1) {
-      // push into queue
-      {
-        std::lock_guard<std::mutex> guard(this->channelState[channel].rxFifoLock);
-        this->channelState[channel].rxFifo.push(byte);
-      }
+/**
+ * The byte in the shift register has been sent; the one in the holding
+ * register, if any, goes next.
+ */
+void MC68681::transmitDone(ChannelType type) {
+  auto &channel = this->channelState[type];
+
+  channel.txEvent = Scheduler::kInvalidEvent;
+
+  uint8_t byte = channel.txFifo.front();
+  channel.txFifo.pop();
+
+  this->transmitted(type, byte);
+
+  this->startTransmit(type);
+  this->updateIrq();
+}
+
+/**
+ * Hands a byte that was sent to the host.
+ */
+void MC68681::transmitted(ChannelType type, uint8_t byte) {
+  // the byte was sent the first time this part of the past was run
+  if(this->emulator->isReexecuting()) {
+    return;
+  }
+
+  if(this->channelState[type].txHandler) {
+    this->channelState[type].txHandler(byte);
+  }
+
+  UartBackend *backend = this->channelState[type].backend;
+
+  if(!backend || !backend->isConnected()) {
+    return;
+  }
+
+  // queue it for the host side, which is told about it at the end of the time
+  // slice; if it's behind, wait for it as a blocking write would have, unless
+  // the backend would rather drop bytes
+  while(!backend->transmit(byte)) {
+    if(backend->isLossy() || !backend->isConnected()) {
+      return;
+    }
+
+    backend->flush();
+    std::this_thread::yield();
+  }
+}
+
+/**
+ * Starts shifting in the next byte on the receive line, if the receiver is
+ * idle and there is one.
+ */
+void MC68681::startReceive(ChannelType type) {
+  auto &channel = this->channelState[type];
+
+  if(channel.rxEvent != Scheduler::kInvalidEvent || channel.rxLine.empty()) {
+    return;
+  }
+
+  channel.rxDue = this->emulator->now() + this->characterTime(type, true);
+  channel.rxEvent = this->emulator->scheduleAt(channel.rxDue, [this, type]() {
+    this->receiveDone(type);
+  });
+}
+
+/**
+ * A byte has been shifted in; it goes into the RX FIFO, unless that's full,
+ * in which case it's lost and the overrun flag is set. The next byte from the
+ * backend, if any, then starts arriving.
+ */
+void MC68681::receiveDone(ChannelType type) {
+  auto &channel = this->channelState[type];
+
+  channel.rxEvent = Scheduler::kInvalidEvent;
+
+  uint8_t byte = channel.rxLine.front();
+  channel.rxLine.pop();
+
+  if(channel.rxFifo.size() >= kRxFifoSize) {
+    VLOG(1) << CHANNEL_NAME(type) << ": RX overrun, dropping $" << std::hex
+            << ((unsigned int) byte);
+    channel.overrunErr = true;
+  } else {
+    channel.rxFifo.push(byte);
+  }
+
+  if(channel.backend) {
+    this->drainHostRx(type);
+  }
+
+  this->startReceive(type);
+  this->updateIrq();
+}
+
+
+
+/**
+ * Connects a channel to a host backend, and takes ownership of it. This must
+ * be done before the emulation starts, and at most once per channel.
+ */
+void MC68681::setBackend(ChannelType channel, UartBackend *backend) {
+  CHECK(!this->channelState[channel].backend) << CHANNEL_NAME(channel) << " already has a backend";
+
+  this->channelState[channel].backend = backend;
+
+  if(!backend) {
+    return;
+  }
+
+  // have the emulation thread pick up received bytes
+  backend->setReceiveHandler([this, channel]() {
+    this->emulator->post([this, channel]() {
+      this->drainHostRx(channel);
+    });
+  });
+
+  if(backend->needsReactor() && !this->reactor) {
+    this->reactor = new IoReactor;
+    this->reactor->setWakeHandler([this]() {
+      this->hostWoken();
+    });
+  }
+
+  backend->start(backend->needsReactor() ? this->reactor : nullptr);
+}
+
+/**
+ * The reactor was woken up; let the backends on it pick up whatever the
+ * emulation thread asked for. This runs on the reactor thread.
+ */
+void MC68681::hostWoken(void) {
+  for(int i = 0; i < 2; i++) {
+    UartBackend *backend = this->channelState[i].backend;
 
-      // TODO: handle irq's, etc
+    if(backend && backend->needsReactor()) {
+      backend->woken();
+    }
+  }
+}
+
+/**
+ * Delivers as many of the bytes the backend received to the channel as its
+ * receiver takes right now: when paced, one to shift in once the receive line
+ * is idle, otherwise enough to fill the RX FIFO. The rest stay in the
+ * backend's ring, which stops reading from the host once it's full. This runs
+ * on the emulation thread.
+ */
+void MC68681::drainHostRx(ChannelType channel) {
+  auto &state = this->channelState[channel];
+  size_t room;
+
+  if(this->unthrottled) {
+    room = (state.rxFifo.size() < kRxFifoSize) ? (kRxFifoSize - state.rxFifo.size()) : 0;
+  } else {
+    room = (state.rxEvent == Scheduler::kInvalidEvent && state.rxLine.empty()) ? 1 : 0;
+  }
+
+  if(room == 0) {
+    return;
+  }
+
+  uint8_t buffer[kRxFifoSize];
+  size_t count = state.backend->receive(buffer, room);
+
+  for(size_t i = 0; i < count; i++) {
+    this->emulator->noteUartInput(channel, buffer[i]);
+    this->receiveByte(channel, buffer[i]);
+  }
+}
+
+/**
+ * Picks up bytes from the channel's backend as soon as the current instruction
+ * is done, if it has any; this is for when the receiver made room in the
+ * middle of one.
+ */
+void MC68681::scheduleHostRx(ChannelType channel) {
+  auto &state = this->channelState[channel];
+
+  if(!state.backend || state.hostRxEvent != Scheduler::kInvalidEvent ||
+     !state.backend->isReceivePending()) {
+    return;
+  }
+
+  state.hostRxEvent = this->emulator->scheduleAt(this->emulator->now(), [this, channel]() {
+    this->channelState[channel].hostRxEvent = Scheduler::kInvalidEvent;
+    this->drainHostRx(channel);
+  });
+}
+
+/**
+ * Hands everything transmitted since the last call to the backends, so it's
+ * sent in as few writes as possible. The emulator calls this after every time
+ * slice.
+ */
+void MC68681::flushTransmitted(void) {
+  for(int i = 0; i < 2; i++) {
+    if(this->channelState[i].backend) {
+      this->channelState[i].backend->flush();
     }
   }
 }
@@ -1,19 +1,22 @@
 /**
- * Emulation of the 68681 DUART. Timings are not correctly emulated, but the
- * general functionality is there.
+ * Emulation of the 68681 DUART. Characters take as long to shift in and out as
+ * the programmed baud rate and character format say, in emulated time, as does
+ * the counter/timer; unthrottled, they move instantly instead.
  */
 #ifndef MC68681_H
 #define MC68681_H
 
 #include "BusPeripheral.h"
+#include "Scheduler.h"
 
 #include <cstdint>
 #include <queue>
-#include <mutex>
-#include <thread>
 #include <atomic>
+#include <functional>
 
 class Emulator;
+class IoReactor;
+class UartBackend;
 
 class MC68681 : public BusPeripheral {
   public:
@@ -22,9 +25,16 @@ class MC68681 : public BusPeripheral {
       kChannelB = 1
     } ChannelType;
 
+    /// receives every byte a channel transmits
+    typedef std::function<void(uint8_t)> tx_handler_t;
+
   private:
-    static const unsigned int uartAPort = 4200;
-    static const unsigned int uartBPort = 4201;
+    /// frequency of the clock on X1/CLK, in Hz
+    static const uint32_t kClockFrequency = 3686400;
+    /// interrupt level the IRQ output is wired to
+    static const unsigned int kIrqLevel = 2;
+    /// depth of the receive FIFO
+    static const size_t kRxFifoSize = 3;
 
   public:
     MC68681(Emulator *emulator);
@@ -32,6 +42,30 @@ class MC68681 : public BusPeripheral {
 
     virtual void busWrite(uint32_t addr, uint32_t data, bus_size_t size);
     virtual uint32_t busRead(uint32_t addr, bus_size_t size);
+    virtual bool isPollable(uint32_t addr);
+
+    virtual void saveState(StateWriter &state);
+    virtual void loadState(StateReader &state);
+
+    void setInputPin(unsigned int pin, bool high);
+
+    void setBackend(ChannelType channel, UartBackend *backend);
+    UartBackend *getBackend(ChannelType channel) const {
+      return this->channelState[channel].backend;
+    }
+
+    /// whether characters move instantly, rather than at the baud rate
+    void setUnthrottled(bool unthrottled) {
+      this->unthrottled = unthrottled;
+    }
+    bool isUnthrottled(void) const {
+      return this->unthrottled;
+    }
+
+    void setTransmitHandler(ChannelType channel, tx_handler_t handler);
+    void receiveByte(ChannelType channel, uint8_t byte);
+
+    void flushTransmitted(void);
 
   private:
     void modeRegWrite(ChannelType type, uint8_t data);
@@ -42,33 +76,82 @@ class MC68681 : public BusPeripheral {
     void uartWrite(ChannelType type, uint8_t write);
     uint8_t uartRead(ChannelType type);
 
+    Scheduler::cycles_t characterTime(ChannelType type, bool receiver);
+
+    void startTransmit(ChannelType type);
+    void transmitDone(ChannelType type);
+    void transmitted(ChannelType type, uint8_t byte);
+    void startReceive(ChannelType type);
+    void receiveDone(ChannelType type);
+
     void startTimer(void);
     void stopTimer(void);
+    void scheduleTimer(void);
+    void timerExpired(void);
 
-    void openSocket(ChannelType channel, unsigned int port);
-    void readerThread(ChannelType channel);
+    uint8_t interruptStatus(void);
+    void updateIrq(void);
+
+    void hostWoken(void);
+    void drainHostRx(ChannelType channel);
+    void scheduleHostRx(ChannelType channel);
 
   private:
-    std::atomic_bool run = true;
+    /// whether characters move instantly, rather than at the baud rate
+    bool unthrottled = false;
+
+    /// event loop for the backends' host I/O; created once the first backend
+    /// that needs it is attached
+    IoReactor *reactor = nullptr;
 
     uint16_t timerPeriod = 0;
     uint8_t irqVector = 0;
 
+    /// auxiliary control register
+    uint8_t auxControl = 0;
+    /// interrupt mask register
+    uint8_t irqMask = 0;
+    /// state of the input pins
+    uint8_t inputPort = 0;
+
+    /// whether the counter/timer is running
+    bool timerRunning = false;
+    /// counter ready flag (ISR bit 3)
+    bool counterReady = false;
+    /// divider between X1/CLK and the counter's clock
+    uint32_t timerDivider = 1;
+    /// time at which the counter was last (re)loaded
+    Scheduler::cycles_t timerReload = 0;
+    /// time at which the counter next reaches terminal count
+    Scheduler::cycles_t timerDue = 0;
+    /// number of times the counter reached terminal count since it was started
+    uint64_t timerExpirations = 0;
+    /// event for the next terminal count
+    Scheduler::event_id_t timerEvent = Scheduler::kInvalidEvent;
+
     class {
       public:
-        // listening socket
-        int listenSocket = 0;
-        // connection to client
-        int socket = 0;
-
-        // thread to read from socket
-        std::thread *readerThread = nullptr;
+        // what the channel is connected to on the host, if anything
+        UartBackend *backend = nullptr;
 
         // are the receiver/transmitter on?
         bool txOn = false, rxOn = false;
-        // receive and transmit FIFOs
+        // receive FIFO, and the transmit holding and shift registers (front is
+        // the byte being shifted out); only accessed on the emulation thread
         std::queue<uint8_t> rxFifo, txFifo;
-        std::mutex rxFifoLock, txFifoLock;
+        // bytes arriving on the receive line, to be shifted in one at a time
+        std::queue<uint8_t> rxLine;
+
+        // when the bytes being shifted in and out are done, and the events
+        // for it (invalid while idle)
+        Scheduler::cycles_t rxDue = 0, txDue = 0;
+        Scheduler::event_id_t rxEvent = Scheduler::kInvalidEvent,
+                              txEvent = Scheduler::kInvalidEvent;
+        // picks up more bytes from the backend after a read made room in the
+        // RX FIFO (invalid if none is pending)
+        Scheduler::event_id_t hostRxEvent = Scheduler::kInvalidEvent;
+        // gets transmitted bytes as well, if set
+        tx_handler_t txHandler;
 
         // error flags
         bool breakRx = false, parityErr = false, framingErr = false,
@@ -82,9 +165,11 @@ class MC68681 : public BusPeripheral {
 
         // mode register pointer and data
         int modeRegPtr = 0;
+        uint8_t mode1 = 0x13, mode2 = 0x07;
+        // clock select register; until programmed, 9600 baud (as is the
+        // character format: 8N1)
+        uint8_t clockSel = 0xBB;
     } channelState[2];
-
-    friend void MC68681_ReaderThreadEntry(void *ctx, ChannelType channel);
 };
 
 #endif
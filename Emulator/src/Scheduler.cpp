@@ -0,0 +1,64 @@
+#include "Scheduler.h"
+
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <unordered_set>
+
+#include <glog/logging.h>
+
+/**
+ * Schedules the callback to be invoked once emulated time reaches the given
+ * cycle count. Events for the same cycle fire in the order they were
+ * scheduled.
+ */
+Scheduler::event_id_t Scheduler::schedule(cycles_t when, callback_t callback) {
+  event_id_t id = this->nextId++;
+
+  this->events.push({when, id, callback});
+  this->pending.insert(id);
+
+  return id;
+}
+
+/**
+ * Cancels a previously scheduled event. Cancelling an event that has already
+ * fired, or kInvalidEvent, has no effect.
+ */
+void Scheduler::cancel(event_id_t event) {
+  this->pending.erase(event);
+}
+
+/**
+ * Returns the time of the earliest pending event, or kNever if there aren't
+ * any.
+ */
+Scheduler::cycles_t Scheduler::nextEventTime(void) {
+  // discard any cancelled events at the top of the heap
+  while(!this->events.empty()) {
+    if(this->pending.count(this->events.top().id)) {
+      return this->events.top().when;
+    }
+
+    this->events.pop();
+  }
+
+  return kNever;
+}
+
+/**
+ * Fires all events that are due at or before the given time. Events may
+ * schedule further events; those fire as well if they're due.
+ */
+void Scheduler::runUntil(cycles_t now) {
+  while(this->nextEventTime() <= now) {
+    Event event = this->events.top();
+    this->events.pop();
+    this->pending.erase(event.id);
+
+    VLOG(3) << "Firing event " << event.id << " (due " << event.when
+            << ") at " << now;
+
+    event.callback();
+  }
+}
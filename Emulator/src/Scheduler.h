@@ -0,0 +1,62 @@
+/**
+ * Keeps track of work that needs to happen at a particular point in emulated
+ * time, such as a timer expiring.
+ */
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <cstdint>
+#include <functional>
+#include <queue>
+#include <unordered_set>
+#include <vector>
+
+class Scheduler {
+  public:
+    /// emulated time, in CPU clock cycles since the emulator was created
+    typedef uint64_t cycles_t;
+    /// identifies a scheduled event, so that it may be cancelled
+    typedef uint64_t event_id_t;
+    /// function invoked when an event fires
+    typedef std::function<void(void)> callback_t;
+
+    /// returned by nextEventTime() when nothing is scheduled
+    static const cycles_t kNever = UINT64_MAX;
+    /// event id that is never handed out
+    static const event_id_t kInvalidEvent = 0;
+
+  public:
+    event_id_t schedule(cycles_t when, callback_t callback);
+    void cancel(event_id_t event);
+
+    cycles_t nextEventTime(void);
+    void runUntil(cycles_t now);
+
+  private:
+    typedef struct {
+      /// time at which the event fires
+      cycles_t when;
+      /// identifier of the event; also orders events for the same cycle
+      event_id_t id;
+      /// function to invoke
+      callback_t callback;
+    } Event;
+
+    /// orders the heap so the earliest event is at the top
+    struct EventCompare {
+      bool operator()(const Event &a, const Event &b) const {
+        return (a.when > b.when) || (a.when == b.when && a.id > b.id);
+      }
+    };
+
+  private:
+    /// min-heap of pending events
+    std::priority_queue<Event, std::vector<Event>, EventCompare> events;
+    /// events that have neither fired nor been cancelled
+    std::unordered_set<event_id_t> pending;
+
+    /// id to assign to the next event
+    event_id_t nextId = 1;
+};
+
+#endif
@@ -0,0 +1,110 @@
+#include "Snapshot.h"
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+
+
+/**
+ * Appends raw bytes to the snapshot.
+ */
+void StateWriter::putBytes(const void *data, size_t length) {
+  const uint8_t *bytes = static_cast<const uint8_t *>(data);
+  this->buffer.insert(this->buffer.end(), bytes, bytes + length);
+}
+
+/**
+ * Writes the snapshot out to the given file, replacing it.
+ */
+void StateWriter::writeToFile(const std::string &path) const {
+  std::fstream file(path, std::ios::out | std::ios::binary | std::ios::trunc);
+
+  if(!file.is_open()) {
+    throw std::runtime_error("Couldn't open snapshot file at " + path);
+  }
+
+  file.write(reinterpret_cast<const char *>(this->buffer.data()), this->buffer.size());
+
+  if(!file) {
+    throw std::runtime_error("Couldn't write snapshot to " + path);
+  }
+}
+
+
+
+/**
+ * Maps the given snapshot file for reading.
+ */
+StateReader::StateReader(const std::string &path) {
+  int fd = open(path.c_str(), O_RDONLY);
+
+  if(fd < 0) {
+    throw std::runtime_error("Couldn't open snapshot file at " + path);
+  }
+
+  struct stat info;
+
+  if(fstat(fd, &info) != 0 || info.st_size == 0) {
+    close(fd);
+    throw std::runtime_error("Couldn't read snapshot file at " + path);
+  }
+
+  void *mapping = mmap(nullptr, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+
+  if(mapping == MAP_FAILED) {
+    throw std::runtime_error("Couldn't map snapshot file at " + path);
+  }
+
+  this->data = static_cast<const uint8_t *>(mapping);
+  this->size = info.st_size;
+  this->mapped = true;
+}
+
+/**
+ * Reads a snapshot that's already in memory, such as one written to a
+ * StateWriter; the buffer must outlive the reader.
+ */
+StateReader::StateReader(const std::vector<uint8_t> &buffer) : data(buffer.data()),
+                                                               size(buffer.size()) {
+
+}
+
+/**
+ * Unmaps the snapshot.
+ */
+StateReader::~StateReader() {
+  if(this->mapped) {
+    munmap(const_cast<uint8_t *>(this->data), this->size);
+  }
+}
+
+/**
+ * Copies the next bytes out of the snapshot.
+ */
+void StateReader::getBytes(void *data, size_t length) {
+  memcpy(data, this->getBytes(length), length);
+}
+
+/**
+ * Returns the next bytes of the snapshot, in place; they're valid for as long
+ * as the reader is.
+ */
+const uint8_t *StateReader::getBytes(size_t length) {
+  if(length > (this->size - this->offset)) {
+    throw std::runtime_error("Snapshot is truncated");
+  }
+
+  const uint8_t *bytes = this->data + this->offset;
+  this->offset += length;
+
+  return bytes;
+}
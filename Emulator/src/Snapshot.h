@@ -0,0 +1,70 @@
+/**
+ * Reading and writing of save state snapshots. A snapshot is a flat stream of
+ * plain values, written and read back in the same order; there are no tags or
+ * lengths in between. Snapshots are read straight out of a memory mapping of
+ * the file, so loading one costs little more than the copies out of it.
+ */
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+class StateWriter {
+  public:
+    /// appends a value that can be copied byte for byte
+    template<typename T> void put(const T &value) {
+      static_assert(std::is_trivially_copyable<T>::value, "value can't be copied bytewise");
+      this->putBytes(&value, sizeof(T));
+    }
+
+    void putBytes(const void *data, size_t length);
+
+    void writeToFile(const std::string &path) const;
+
+    /// everything written so far
+    const std::vector<uint8_t> &getData(void) const {
+      return this->buffer;
+    }
+
+  private:
+    std::vector<uint8_t> buffer;
+};
+
+class StateReader {
+  public:
+    StateReader(const std::string &path);
+    StateReader(const std::vector<uint8_t> &buffer);
+    ~StateReader();
+
+    StateReader(const StateReader &) = delete;
+    StateReader &operator=(const StateReader &) = delete;
+
+    /// reads a value written with StateWriter::put()
+    template<typename T> void get(T &value) {
+      static_assert(std::is_trivially_copyable<T>::value, "value can't be copied bytewise");
+      this->getBytes(&value, sizeof(T));
+    }
+
+    void getBytes(void *data, size_t length);
+    const uint8_t *getBytes(size_t length);
+
+    /// number of bytes that haven't been read yet
+    size_t remaining(void) const {
+      return this->size - this->offset;
+    }
+
+  private:
+    /// mapping of the snapshot file, or the buffer that's read from
+    const uint8_t *data = nullptr;
+    size_t size = 0;
+    bool mapped = false;
+    /// offset of the next value to read
+    size_t offset = 0;
+};
+
+#endif
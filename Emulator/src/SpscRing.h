@@ -0,0 +1,167 @@
+/**
+ * Fixed size, lock free ring buffer between exactly one producer thread and
+ * one consumer thread. Neither side ever blocks or allocates; pushing into a
+ * full ring or popping from an empty one just moves fewer elements.
+ *
+ * The producer publishes elements with a release store of the head index,
+ * which the consumer loads with acquire semantics before reading them, and
+ * vice versa for the tail once they've been read. Each side also keeps its
+ * last view of the other's index, so it only has to touch the other side's
+ * cache line when the ring looks full (or empty).
+ */
+#ifndef SPSCRING_H
+#define SPSCRING_H
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+
+template<typename T, size_t Capacity>
+class SpscRing {
+  static_assert(Capacity && !(Capacity & (Capacity - 1)), "Ring capacity must be a power of two");
+
+  public:
+    /// number of elements the ring holds
+    static const size_t kCapacity = Capacity;
+
+  public:
+    /**
+     * Copies up to count elements into the ring, and returns how many fit.
+     * Only the producer may call this.
+     */
+    size_t push(const T *data, size_t count) {
+      size_t head = this->head.load(std::memory_order_relaxed);
+
+      if((head - this->cachedTail) + count > Capacity) {
+        this->cachedTail = this->tail.load(std::memory_order_acquire);
+      }
+
+      count = std::min(count, Capacity - (head - this->cachedTail));
+
+      // copy up to the end of the buffer, then the rest from its start
+      size_t offset = (head & (Capacity - 1));
+      size_t first = std::min(count, Capacity - offset);
+
+      std::copy(data, data + first, this->buffer + offset);
+      std::copy(data + first, data + count, this->buffer);
+
+      this->head.store(head + count, std::memory_order_release);
+      return count;
+    }
+
+    /// pushes a single element; returns false if the ring is full
+    bool push(const T &value) {
+      return (this->push(&value, 1) == 1);
+    }
+
+    /**
+     * Copies up to count elements out of the ring, and returns how many there
+     * were. Only the consumer may call this.
+     */
+    size_t pop(T *data, size_t count) {
+      size_t tail = this->tail.load(std::memory_order_relaxed);
+
+      if((this->cachedHead - tail) < count) {
+        this->cachedHead = this->head.load(std::memory_order_acquire);
+      }
+
+      count = std::min(count, this->cachedHead - tail);
+
+      size_t offset = (tail & (Capacity - 1));
+      size_t first = std::min(count, Capacity - offset);
+
+      std::copy(this->buffer + offset, this->buffer + offset + first, data);
+      std::copy(this->buffer, this->buffer + (count - first), data + first);
+
+      this->tail.store(tail + count, std::memory_order_release);
+      return count;
+    }
+
+    /// pops a single element; returns false if the ring is empty
+    bool pop(T &value) {
+      return (this->pop(&value, 1) == 1);
+    }
+
+    /**
+     * Gets the free space in the ring, as up to two runs of elements that the
+     * producer may fill in place before publishing them with commit(); the
+     * second run is empty unless the space wraps around. Returns the total.
+     */
+    size_t reserve(T *data[2], size_t counts[2]) {
+      size_t head = this->head.load(std::memory_order_relaxed);
+      this->cachedTail = this->tail.load(std::memory_order_acquire);
+
+      size_t count = Capacity - (head - this->cachedTail);
+      this->split(head, count, data, counts);
+
+      return count;
+    }
+
+    /// publishes elements written into space returned by reserve()
+    void commit(size_t count) {
+      this->head.store(this->head.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    /**
+     * Gets the elements in the ring, as up to two runs that the consumer may
+     * read in place before releasing them with consume(). Returns the total.
+     */
+    size_t peek(const T *data[2], size_t counts[2]) {
+      size_t tail = this->tail.load(std::memory_order_relaxed);
+      this->cachedHead = this->head.load(std::memory_order_acquire);
+
+      size_t count = this->cachedHead - tail;
+      this->split(tail, count, const_cast<T **>(data), counts);
+
+      return count;
+    }
+
+    /// releases elements read in place after peek()
+    void consume(size_t count) {
+      this->tail.store(this->tail.load(std::memory_order_relaxed) + count, std::memory_order_release);
+    }
+
+    /**
+     * Number of elements in the ring. While the other side is active, this
+     * may be out of date by the time it returns: the producer may see more
+     * elements than there are, the consumer fewer.
+     */
+    size_t size(void) const {
+      size_t tail = this->tail.load(std::memory_order_acquire);
+      return (this->head.load(std::memory_order_acquire) - tail);
+    }
+
+    bool empty(void) const {
+      return (this->size() == 0);
+    }
+
+  private:
+    /// splits count elements starting at the given index into the runs before
+    /// and after the end of the buffer
+    void split(size_t index, size_t count, T *data[2], size_t counts[2]) {
+      size_t offset = (index & (Capacity - 1));
+
+      counts[0] = std::min(count, Capacity - offset);
+      counts[1] = (count - counts[0]);
+
+      data[0] = this->buffer + offset;
+      data[1] = this->buffer;
+    }
+
+  private:
+    /// size of a cache line; the two sides' indices live on separate ones
+    static const size_t kCacheLine = 64;
+
+    /// index past the last element pushed, and the producer's view of tail;
+    /// both only ever increase, and are wrapped when indexing
+    alignas(kCacheLine) std::atomic<size_t> head = {0};
+    size_t cachedTail = 0;
+
+    /// index of the next element to pop, and the consumer's view of head
+    alignas(kCacheLine) std::atomic<size_t> tail = {0};
+    size_t cachedHead = 0;
+
+    alignas(kCacheLine) T buffer[Capacity];
+};
+
+#endif
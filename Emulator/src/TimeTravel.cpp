@@ -0,0 +1,438 @@
+#include "TimeTravel.h"
+#include "BusPeripheral.h"
+#include "Emulator.h"
+#include "InputLog.h"
+#include "Snapshot.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <iostream>
+#include <vector>
+
+#include <glog/logging.h>
+
+extern "C" {
+  #include "musashi/m68k.h"
+}
+
+/// returned by checkpointBefore() if there's no such checkpoint
+static const size_t kNoCheckpoint = SIZE_MAX;
+
+
+
+/**
+ * Sets up time travel for the given emulator, with a checkpoint every given
+ * number of cycles.
+ */
+TimeTravel::TimeTravel(Emulator *_emulator, Scheduler::cycles_t _interval) : emulator(_emulator),
+                                                                             interval(_interval) {
+
+}
+
+/**
+ * Takes a checkpoint if it's been long enough since the last one. This is
+ * called between time slices, once everything that's due has been delivered.
+ */
+void TimeTravel::maybeCheckpoint(void) {
+  if(this->checkpoints.empty() ||
+     this->emulator->cycles >= (this->checkpoints.back().cycles + this->interval)) {
+    this->takeCheckpoint();
+  }
+}
+
+/**
+ * Keeps an input from the outside, so it can be delivered again when the past
+ * is executed again. Inputs replayed from a log are already in the log.
+ */
+void TimeTravel::noteInput(const InputLog::Event &event) {
+  if(this->fileReplayer()) {
+    return;
+  }
+
+  this->inputs.push_back(event);
+}
+
+/**
+ * Goes back the given number of instructions. Returns false if that's further
+ * back than the oldest checkpoint.
+ */
+bool TimeTravel::stepBack(uint64_t instructions) {
+  uint64_t now = this->emulator->getInstructionCount();
+
+  if(this->checkpoints.empty() || instructions > (now - this->checkpoints.front().instructions)) {
+    return false;
+  }
+
+  return this->goTo(now - instructions);
+}
+
+/**
+ * Goes back to right after the most recent CPU write to the given RAM address,
+ * by running forward from each checkpoint in turn, newest first, with writes
+ * to it watched. Returns false if there was no write since the oldest
+ * checkpoint, in which case the machine stays where it was.
+ */
+bool TimeTravel::runBackToWrite(uint32_t address) {
+  if(this->checkpoints.empty() || !this->emulator->pageFor(address).write) {
+    return false;
+  }
+
+  uint64_t now = this->emulator->getInstructionCount();
+  uint64_t write = 0;
+  size_t index;
+
+  this->emulator->watchWrites(address);
+
+  for(index = this->checkpoints.size(); index-- > 0; ) {
+    uint64_t end = now;
+
+    if((index + 1) < this->checkpoints.size()) {
+      end = this->checkpoints[index + 1].instructions;
+    }
+
+    if(this->checkpoints[index].instructions >= end) {
+      continue;
+    }
+
+    this->emulator->lastWatchedWrite = 0;
+
+    this->restore(index);
+    this->runTo(end);
+
+    if(this->emulator->lastWatchedWrite) {
+      write = this->emulator->lastWatchedWrite;
+      break;
+    }
+  }
+
+  this->emulator->unwatchWrites();
+
+  // never written: get back to where we were
+  if(!write) {
+    this->goTo(now);
+    return false;
+  }
+
+  this->restore(index);
+  this->runTo(write);
+  this->finish(index);
+
+  return true;
+}
+
+/**
+ * Prints how far back the checkpoints go, and how much memory they take.
+ */
+void TimeTravel::printCheckpoints(std::ostream &os) const {
+  if(this->checkpoints.empty()) {
+    os << "no checkpoints" << std::endl;
+    return;
+  }
+
+  const Checkpoint &oldest = this->checkpoints.front(), &newest = this->checkpoints.back();
+
+  os << this->checkpoints.size() << " checkpoints (" << (this->bytes / 1024) << "K), from cycle "
+     << oldest.cycles << " (" << oldest.instructions << " instructions) to cycle "
+     << newest.cycles << " (" << newest.instructions << " instructions)" << std::endl;
+}
+
+/**
+ * Called before every instruction while the past is executed again; stops
+ * the CPU once the instruction that reaches the target has executed.
+ */
+void TimeTravel::instructionExecuted(Emulator *emu, uint32_t address) {
+  if((m68k_get_instruction_count(nullptr) + 1) >= this->target) {
+    m68k_end_timeslice();
+  }
+}
+
+
+
+/**
+ * Takes a checkpoint of the machine as it is now.
+ */
+void TimeTravel::takeCheckpoint(void) {
+  Emulator *emu = this->emulator;
+  Checkpoint checkpoint;
+
+  checkpoint.cycles = emu->cycles;
+  checkpoint.instructions = emu->getInstructionCount();
+
+  if(this->fileReplayer()) {
+    checkpoint.inputs = this->fileReplayer()->position();
+  } else {
+    checkpoint.inputs = this->inputsDropped + this->inputs.size();
+  }
+
+  checkpoint.context.resize(m68k_context_size());
+  m68k_get_context(checkpoint.context.data());
+
+  StateWriter state;
+
+  for(const Emulator::Page &page : emu->pages) {
+    if(page.periph) {
+      page.periph->saveState(state);
+    }
+  }
+
+  checkpoint.devices = state.getData();
+
+  checkpoint.irqLines = emu->irqLines;
+  checkpoint.writes = emu->fastMemory.writes;
+  checkpoint.lastPoll = emu->lastPoll;
+  checkpoint.lastPollTime = emu->lastPollTime;
+  checkpoint.pollMatches = emu->pollMatches;
+
+  // keep only the pages that changed since the last checkpoint
+  std::vector<uint8_t> image;
+  this->readMemory(image);
+
+  if(this->checkpoints.empty()) {
+    this->oldestImage = image;
+  } else {
+    for(size_t offset = 0; offset < image.size(); offset += kPageSize) {
+      if(memcmp(image.data() + offset, this->newestImage.data() + offset, kPageSize) != 0) {
+        checkpoint.pages.push_back(offset / kPageSize);
+        checkpoint.data.insert(checkpoint.data.end(), image.begin() + offset,
+                               image.begin() + offset + kPageSize);
+      }
+    }
+  }
+
+  this->newestImage.swap(image);
+
+  this->bytes += checkpoint.context.size() + checkpoint.devices.size() + checkpoint.data.size();
+  this->checkpoints.push_back(std::move(checkpoint));
+
+  while(this->bytes > kMaxBytes && this->checkpoints.size() > 1) {
+    this->dropOldest();
+  }
+}
+
+/**
+ * Forgets the oldest checkpoint; the one after it becomes the oldest, so its
+ * changes are folded into the memory image of the oldest one.
+ */
+void TimeTravel::dropOldest(void) {
+  Checkpoint &oldest = this->checkpoints.front();
+  Checkpoint &next = this->checkpoints[1];
+
+  for(size_t i = 0; i < next.pages.size(); i++) {
+    memcpy(this->oldestImage.data() + next.pages[i] * kPageSize, next.data.data() + i * kPageSize,
+           kPageSize);
+  }
+
+  this->bytes -= oldest.context.size() + oldest.devices.size() + oldest.data.size();
+  this->bytes -= next.data.size();
+
+  next.pages.clear();
+  next.pages.shrink_to_fit();
+  next.data.clear();
+  next.data.shrink_to_fit();
+
+  this->checkpoints.pop_front();
+
+  // inputs from before the oldest checkpoint aren't needed anymore
+  uint64_t first = this->checkpoints.front().inputs;
+
+  while(this->inputsDropped < first && !this->inputs.empty()) {
+    this->inputs.pop_front();
+    this->inputsDropped++;
+  }
+}
+
+/**
+ * Finds the newest checkpoint taken at or before the given instruction count.
+ */
+size_t TimeTravel::checkpointBefore(uint64_t instructions) const {
+  for(size_t i = this->checkpoints.size(); i-- > 0; ) {
+    if(this->checkpoints[i].instructions <= instructions) {
+      return i;
+    }
+  }
+
+  return kNoCheckpoint;
+}
+
+/**
+ * Returns the replayer of the input log the emulator is replaying, if it is.
+ */
+InputReplayer *TimeTravel::fileReplayer(void) const {
+  if(this->emulator->replayer != this->replayer) {
+    return this->emulator->replayer;
+  }
+
+  return nullptr;
+}
+
+/**
+ * Goes to the given instruction count, which must not be later than now.
+ */
+bool TimeTravel::goTo(uint64_t instructions) {
+  size_t index = this->checkpointBefore(instructions);
+
+  if(index == kNoCheckpoint) {
+    return false;
+  }
+
+  this->restore(index);
+  bool reached = this->runTo(instructions);
+  this->finish(index);
+
+  LOG_IF(ERROR, !reached) << "Couldn't execute the past again up to instruction " << instructions;
+
+  return reached;
+}
+
+/**
+ * Puts the machine back into the state of the given checkpoint, and gets the
+ * inputs observed after it ready to be delivered again.
+ */
+void TimeTravel::restore(size_t index) {
+  Emulator *emu = this->emulator;
+  const Checkpoint &checkpoint = this->checkpoints[index];
+
+  // memory is the oldest image, with all changes since applied in turn
+  std::vector<uint8_t> image = this->oldestImage;
+
+  for(size_t i = 1; i <= index; i++) {
+    const Checkpoint &changes = this->checkpoints[i];
+
+    for(size_t j = 0; j < changes.pages.size(); j++) {
+      memcpy(image.data() + changes.pages[j] * kPageSize, changes.data.data() + j * kPageSize,
+             kPageSize);
+    }
+  }
+
+  this->writeMemory(image);
+  this->newestImage.swap(image);
+
+  // the rest of the machine
+  m68k_restore_context(checkpoint.context.data());
+
+  emu->cycles = checkpoint.cycles;
+  emu->irqLines = checkpoint.irqLines;
+  emu->fastMemory.writes = checkpoint.writes;
+  emu->lastPoll = checkpoint.lastPoll;
+  emu->lastPollTime = checkpoint.lastPollTime;
+  emu->pollMatches = checkpoint.pollMatches;
+  emu->idleDetected = false;
+
+  StateReader state(checkpoint.devices);
+
+  for(const Emulator::Page &page : emu->pages) {
+    if(page.periph) {
+      page.periph->loadState(state);
+    }
+  }
+
+  // inputs
+  if(this->fileReplayer()) {
+    this->fileReplayer()->rewind(checkpoint.inputs);
+  } else {
+    std::vector<InputLog::Event> events(this->inputs.begin() + (checkpoint.inputs - this->inputsDropped),
+                                        this->inputs.end());
+
+    delete this->replayer;
+    this->replayer = new InputReplayer(emu, events);
+
+    emu->replayer = this->replayer;
+  }
+}
+
+/**
+ * Executes the past again, from a checkpoint that was just restored, until
+ * the given instruction count. This is like the emulator's main loop, except
+ * that it takes no work from other threads, and never waits for the wall
+ * clock; everything that came from the outside is replayed instead. Returns
+ * whether the instruction count was reached.
+ */
+bool TimeTravel::runTo(uint64_t instructions) {
+  Emulator *emu = this->emulator;
+
+  this->target = instructions;
+
+  emu->reexecuting = true;
+  emu->addTracer(this);
+
+  while(emu->getInstructionCount() < instructions) {
+    emu->deliverDue();
+    emu->runSlice();
+
+    if(emu->getInstructionCount() >= instructions) {
+      break;
+    }
+
+    // skip ahead as the emulator would have; it can't wait for anything else
+    if(emu->idleDetected || emu->cpuIsIdle()) {
+      emu->idleDetected = false;
+
+      Scheduler::cycles_t next = emu->nextEventTime();
+
+      if(next == Scheduler::kNever) {
+        break;
+      }
+
+      emu->cycles = std::max(emu->cycles, next);
+    }
+  }
+
+  emu->removeTracer(this);
+  emu->reexecuting = false;
+
+  return (emu->getInstructionCount() == instructions);
+}
+
+/**
+ * Makes the state the machine is in now, after restoring the given checkpoint
+ * and running forward, the present: later checkpoints and inputs are dropped.
+ */
+void TimeTravel::finish(size_t index) {
+  Emulator *emu = this->emulator;
+
+  while(this->checkpoints.size() > (index + 1)) {
+    const Checkpoint &checkpoint = this->checkpoints.back();
+
+    this->bytes -= checkpoint.context.size() + checkpoint.devices.size() + checkpoint.data.size();
+    this->checkpoints.pop_back();
+  }
+
+  if(this->replayer) {
+    uint64_t position = this->checkpoints[index].inputs + this->replayer->position();
+    this->inputs.resize(position - this->inputsDropped);
+
+    delete this->replayer;
+    this->replayer = nullptr;
+
+    emu->replayer = nullptr;
+  }
+
+  emu->resetPacing();
+
+  LOG(INFO) << "Went back to cycle " << emu->cycles << " (" << emu->getInstructionCount()
+            << " instructions)";
+}
+
+/**
+ * Copies RAM and NVRAM into a single image.
+ */
+void TimeTravel::readMemory(std::vector<uint8_t> &image) const {
+  const Emulator *emu = this->emulator;
+
+  image.resize(sizeof(emu->memRam) + sizeof(emu->nvram));
+
+  memcpy(image.data(), emu->memRam, sizeof(emu->memRam));
+  memcpy(image.data() + sizeof(emu->memRam), emu->nvram, sizeof(emu->nvram));
+}
+
+/**
+ * Copies an image taken by readMemory() back into RAM and NVRAM.
+ */
+void TimeTravel::writeMemory(const std::vector<uint8_t> &image) {
+  Emulator *emu = this->emulator;
+
+  memcpy(emu->memRam, image.data(), sizeof(emu->memRam));
+  memcpy(emu->nvram, image.data() + sizeof(emu->memRam), sizeof(emu->nvram));
+}
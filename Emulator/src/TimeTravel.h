@@ -0,0 +1,115 @@
+/**
+ * Reverse execution. Checkpoints of the machine are taken periodically while
+ * it runs; each holds the CPU context and peripheral state, but only the pages
+ * of RAM and NVRAM that changed since the checkpoint before it. They're kept in
+ * a ring of bounded size, along with the inputs from the outside since the
+ * oldest one.
+ *
+ * To go back to an earlier point, the nearest checkpoint before it is restored
+ * and execution runs forward again, with the same inputs, to the exact
+ * instruction. Going back discards everything after that point; the machine
+ * then carries on from there.
+ */
+#ifndef TIMETRAVEL_H
+#define TIMETRAVEL_H
+
+#include "Emulator.h"
+#include "InputLog.h"
+#include "Scheduler.h"
+#include "Tracer.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <vector>
+
+class InputReplayer;
+
+class TimeTravel : public Tracer {
+  public:
+    TimeTravel(Emulator *emulator, Scheduler::cycles_t interval);
+
+    void maybeCheckpoint(void);
+    void noteInput(const InputLog::Event &event);
+
+    bool stepBack(uint64_t instructions);
+    bool runBackToWrite(uint32_t address);
+
+    void printCheckpoints(std::ostream &os) const;
+
+    virtual void instructionExecuted(Emulator *emu, uint32_t address);
+
+  private:
+    /// a single checkpoint
+    typedef struct {
+      /// emulated time and instruction count it was taken at
+      Scheduler::cycles_t cycles;
+      uint64_t instructions;
+      /// number of inputs observed before it
+      uint64_t inputs;
+
+      /// CPU context, and everything the peripherals save to a snapshot
+      std::vector<uint8_t> context;
+      std::vector<uint8_t> devices;
+
+      /// interrupt lines and bus write count
+      uint8_t irqLines;
+      uint64_t writes;
+      /// idle loop detection state
+      Emulator::PollSample lastPoll;
+      Scheduler::cycles_t lastPollTime;
+      unsigned int pollMatches;
+
+      /// pages of memory that changed since the previous checkpoint, and
+      /// their contents, one page after another
+      std::vector<uint16_t> pages;
+      std::vector<uint8_t> data;
+    } Checkpoint;
+
+  private:
+    void takeCheckpoint(void);
+    void dropOldest(void);
+    size_t checkpointBefore(uint64_t instructions) const;
+
+    InputReplayer *fileReplayer(void) const;
+
+    bool goTo(uint64_t instructions);
+    void restore(size_t index);
+    bool runTo(uint64_t instructions);
+    void finish(size_t index);
+
+    void readMemory(std::vector<uint8_t> &image) const;
+    void writeMemory(const std::vector<uint8_t> &image);
+
+  private:
+    /// memory is compared and stored in pages of this size
+    static const size_t kPageSize = 1024;
+    /// most memory that checkpoints may take up
+    static const size_t kMaxBytes = (64 * 1024 * 1024);
+
+  private:
+    Emulator *emulator;
+
+    /// cycles between checkpoints
+    Scheduler::cycles_t interval;
+
+    std::deque<Checkpoint> checkpoints;
+    /// memory (RAM followed by NVRAM) at the oldest and the newest checkpoint
+    std::vector<uint8_t> oldestImage, newestImage;
+    /// bytes taken up by checkpoints
+    size_t bytes = 0;
+
+    /// inputs observed since the oldest checkpoint, and how many came before
+    std::deque<InputLog::Event> inputs;
+    uint64_t inputsDropped = 0;
+
+    /// replays the inputs while the past is executed again, unless the
+    /// emulator is replaying a log anyway
+    InputReplayer *replayer = nullptr;
+
+    /// instruction count at which execution stops again
+    uint64_t target = 0;
+};
+
+#endif
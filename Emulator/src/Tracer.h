@@ -0,0 +1,24 @@
+/**
+ * Interface for observers of the instructions the CPU executes, such as
+ * instruction loggers. Tracers are attached to an emulator at runtime; while
+ * none are attached, the CPU runs without an instruction hook at all.
+ */
+#ifndef TRACER_H
+#define TRACER_H
+
+#include <cstdint>
+
+class Emulator;
+
+class Tracer {
+  public:
+    virtual ~Tracer() {};
+
+    /**
+     * Called right before the CPU executes the instruction at the given
+     * address. The CPU's state can be inspected through the emulator.
+     */
+    virtual void instructionExecuted(Emulator *emu, uint32_t address) = 0;
+};
+
+#endif
@@ -1,4 +1,5 @@
 #include "TubeDrivers.h"
+#include "Snapshot.h"
 
 #include <iostream>
 #include <iomanip>
@@ -84,6 +85,19 @@ uint32_t TubeDrivers::busRead(uint32_t addr, bus_size_t size) {
   return 0;
 }
 
+/**
+ * Writes the state of all channels to a snapshot.
+ */
+void TubeDrivers::saveState(StateWriter &state) {
+  state.put(this->state);
+}
+/**
+ * Restores the state of all channels.
+ */
+void TubeDrivers::loadState(StateReader &state) {
+  state.get(this->state);
+}
+
 
 
 /**
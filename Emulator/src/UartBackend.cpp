@@ -0,0 +1,620 @@
+#include "UartBackend.h"
+#include "IoReactor.h"
+
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+#include <fcntl.h>
+#include <termios.h>
+#include <unistd.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/uio.h>
+#include <sys/un.h>
+
+#include <glog/logging.h>
+
+/**
+ * Creates a backend from its description on the command line; see the header
+ * for the formats. Returns nullptr for `none`, i.e. an unconnected channel.
+ */
+UartBackend *UartBackend::create(const std::string &spec) {
+  if(spec == "none") {
+    return nullptr;
+  } else if(spec == "pty") {
+    return new PtyUartBackend;
+  } else if(spec == "stdio") {
+    return new StdioUartBackend;
+  } else if(spec.compare(0, 4, "tcp:") == 0) {
+    char *end = nullptr;
+    unsigned long port = strtoul(spec.c_str() + 4, &end, 10);
+
+    if(spec.size() > 4 && !*end && port > 0 && port <= 0xFFFF) {
+      return new ListenerUartBackend((unsigned int) port);
+    }
+  } else if(spec.compare(0, 5, "unix:") == 0 && spec.size() > 5) {
+    return new ListenerUartBackend(spec.substr(5));
+  }
+
+  throw std::runtime_error("Invalid UART backend: " + spec);
+}
+
+/**
+ * Queues a transmitted byte; the host side is told about it on the next
+ * flush(). Returns false if the ring is full. This and the other functions
+ * below are called on the emulation thread.
+ */
+bool UartBackend::transmit(uint8_t byte) {
+  if(!this->txRing.push(byte)) {
+    return false;
+  }
+
+  this->txPending = true;
+  return true;
+}
+
+/**
+ * Tells the host side about everything transmitted since the last flush, so
+ * it can be sent off in one go.
+ */
+void UartBackend::flush(void) {
+  if(this->txPending) {
+    this->txPending = false;
+    this->transmitReady();
+  }
+}
+
+/**
+ * Takes up to count received bytes out of the ring, and returns how many
+ * there were.
+ */
+size_t UartBackend::receive(uint8_t *data, size_t count) {
+  // clear the flag first, so bytes received from here on are announced again
+  this->rxNotified.exchange(false);
+
+  count = this->rxRing.pop(data, count);
+
+  // let the host side know if it's waiting for room (checking after making
+  // room, in case it just started to)
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if(this->rxStalled.exchange(false)) {
+    this->receiveRoom();
+  }
+
+  return count;
+}
+
+/**
+ * Called on the host side after bytes were put in the receive ring; tells the
+ * emulation thread, unless it already knows.
+ */
+void UartBackend::received(void) {
+  if(!this->rxNotified.exchange(true) && this->receiveHandler) {
+    this->receiveHandler();
+  }
+}
+
+
+
+/**
+ * Keeps the reactor; subclasses then open their descriptors.
+ */
+void FdUartBackend::start(IoReactor *reactor) {
+  this->reactor = reactor;
+}
+
+/**
+ * The reactor was woken up: send whatever the emulation thread asked for, and
+ * pick receiving back up if it made room.
+ */
+void FdUartBackend::woken(void) {
+  if(this->txFlushPending.exchange(false)) {
+    this->writeOutput();
+  }
+
+  if(this->connected && this->readFd != -1 && !this->reading) {
+    this->updateInterest();
+  }
+}
+
+/**
+ * Has the reactor send the transmit ring, unless it's already been asked.
+ */
+void FdUartBackend::transmitReady(void) {
+  if(!this->txFlushPending.exchange(true)) {
+    this->reactor->wake();
+  }
+}
+
+/**
+ * Has the reactor read again, now that there's room in the receive ring.
+ */
+void FdUartBackend::receiveRoom(void) {
+  this->reactor->wake();
+}
+
+/**
+ * Connects the channel to the given descriptors, which may be the same. This
+ * and the other functions below run on the reactor thread.
+ */
+void FdUartBackend::attach(int readFd, int writeFd) {
+  // anything queued while disconnected was meant for nobody
+  const uint8_t *spans[2];
+  size_t counts[2];
+
+  this->txRing.consume(this->txRing.peek(spans, counts));
+
+  this->readFd = readFd;
+  this->writeFd = writeFd;
+  this->connected = true;
+
+  this->updateInterest();
+}
+
+/**
+ * Disconnects the channel: stops watching its descriptors, and drops anything
+ * still waiting to be sent.
+ */
+void FdUartBackend::disconnect(void) {
+  if(!this->connected) {
+    return;
+  }
+
+  this->connected = false;
+  this->unwatch();
+
+  const uint8_t *spans[2];
+  size_t counts[2];
+
+  this->txRing.consume(this->txRing.peek(spans, counts));
+
+  this->detached();
+
+  this->readFd = this->writeFd = -1;
+}
+
+/**
+ * Handles events on one of the descriptors.
+ */
+void FdUartBackend::ready(int fd, unsigned int events) {
+  if(fd == this->readFd && (events & IoReactor::kReadable)) {
+    this->readInput();
+  }
+  if(fd == this->writeFd && (events & IoReactor::kWritable)) {
+    this->writeOutput();
+  }
+
+  // a hangup with data left is handled once it's been read
+  if((events & IoReactor::kHangup) && !(events & IoReactor::kReadable)) {
+    if(fd == this->readFd) {
+      this->inputEnded();
+    } else if(fd == this->writeFd) {
+      this->disconnect();
+    }
+  }
+}
+
+/**
+ * Reads as much as there's room for straight into the receive ring. When
+ * the ring is full, reading stops until the emulation thread makes room.
+ */
+void FdUartBackend::readInput(void) {
+  while(this->connected && this->readFd != -1) {
+    uint8_t *spans[2];
+    size_t counts[2];
+
+    // check again after flagging that we stopped, in case room was just made
+    if(!this->rxRing.reserve(spans, counts)) {
+      this->rxStalled = true;
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+
+      if(!this->rxRing.reserve(spans, counts)) {
+        this->updateInterest();
+        return;
+      }
+
+      this->rxStalled = false;
+    }
+
+    struct iovec iov[2] = {
+      {spans[0], counts[0]},
+      {spans[1], counts[1]},
+    };
+
+    ssize_t err = readv(this->readFd, iov, counts[1] ? 2 : 1);
+
+    if(err == -1 && errno == EINTR) {
+      continue;
+    } else if(err == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      return;
+    } else if(err == 0 || (err == -1 && errno == EIO)) {
+      this->inputEnded();
+      return;
+    } else if(err == -1) {
+      PLOG(ERROR) << "Error reading from UART backend";
+      this->disconnect();
+      return;
+    }
+
+    VLOG(2) << "UART backend received " << err << " bytes";
+
+    this->rxRing.commit(err);
+    this->received();
+
+    // come back once there's more, unless this can't be waited for
+    if(this->readPollable) {
+      return;
+    }
+  }
+}
+
+/**
+ * Sends as much of the transmit ring as the descriptor takes, a single write
+ * at a time; the rest is sent once it's writable again.
+ */
+void FdUartBackend::writeOutput(void) {
+  const uint8_t *spans[2];
+  size_t counts[2];
+
+  while(size_t total = this->txRing.peek(spans, counts)) {
+    if(!this->connected || this->writeFd == -1) {
+      this->txRing.consume(total);
+      continue;
+    }
+
+    struct iovec iov[2] = {
+      {const_cast<uint8_t *>(spans[0]), counts[0]},
+      {const_cast<uint8_t *>(spans[1]), counts[1]},
+    };
+
+    ssize_t err = writev(this->writeFd, iov, counts[1] ? 2 : 1);
+
+    if(err == -1 && errno == EINTR) {
+      continue;
+    } else if(err == -1 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+      break;
+    } else if(err <= 0) {
+      PLOG_IF(ERROR, errno != EPIPE) << "Error writing to UART backend";
+      this->disconnect();
+      return;
+    }
+
+    this->txRing.consume(err);
+  }
+
+  this->updateInterest();
+}
+
+/**
+ * Watches for input unless the receive ring is full, and for the output
+ * becoming writable while there's data it didn't take yet.
+ */
+void FdUartBackend::updateInterest(void) {
+  if(!this->connected) {
+    return;
+  }
+
+  this->reading = (this->readFd != -1) && !this->rxStalled;
+  this->writing = (this->writeFd != -1) && !this->txRing.empty();
+
+  unsigned int read = this->reading ? IoReactor::kReadable : 0;
+  unsigned int write = this->writing ? IoReactor::kWritable : 0;
+
+  if(this->readFd == this->writeFd) {
+    this->watch(this->readFd, read | write, this->readWatched, this->readPollable);
+  } else {
+    this->watch(this->readFd, read, this->readWatched, this->readPollable);
+    this->watch(this->writeFd, write, this->writeWatched, this->writePollable);
+  }
+
+  // nothing will say when a file is readable; it always is
+  if(this->reading && !this->readPollable) {
+    this->readInput();
+  }
+}
+
+/**
+ * Registers a descriptor with the reactor, or changes what it's watched for.
+ */
+void FdUartBackend::watch(int fd, unsigned int interest, bool &watched, bool &pollable) {
+  if(fd == -1 || !pollable) {
+    return;
+  }
+
+  if(watched) {
+    this->reactor->setInterest(fd, interest);
+    return;
+  }
+
+  pollable = this->reactor->add(fd, interest, [this, fd](unsigned int events) {
+    this->ready(fd, events);
+  });
+
+  watched = pollable;
+}
+
+/**
+ * Stops watching both descriptors.
+ */
+void FdUartBackend::unwatch(void) {
+  if(this->readWatched) {
+    this->reactor->remove(this->readFd);
+  }
+  if(this->writeWatched) {
+    this->reactor->remove(this->writeFd);
+  }
+
+  this->readWatched = this->writeWatched = false;
+  this->readPollable = this->writePollable = true;
+  this->reading = this->writing = false;
+}
+
+
+
+/**
+ * Listens on the given TCP port, on all interfaces.
+ */
+ListenerUartBackend::ListenerUartBackend(unsigned int port) {
+  int err, yes = 1;
+
+  LOG(INFO) << "UART listening on port " << port;
+
+  this->listenSocket = socket(AF_INET, SOCK_STREAM, 0);
+  PCHECK(this->listenSocket != -1) << "Error creating socket";
+
+  // enable the SO_REUSEADDR option
+  err = setsockopt(this->listenSocket, SOL_SOCKET, SO_REUSEADDR, &yes, sizeof(yes));
+  PCHECK(err == 0) << "Error setting SO_REUSEADDR";
+
+  // enable the TCP_NODELAY option; clients inherit it
+  err = setsockopt(this->listenSocket, IPPROTO_TCP, TCP_NODELAY, &yes, sizeof(yes));
+  PCHECK(err == 0) << "Error setting TCP_NODELAY";
+
+  struct sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_ANY);
+  addr.sin_port = htons(port);
+
+  err = bind(this->listenSocket, (struct sockaddr *) &addr, sizeof(addr));
+  PCHECK(err == 0) << "Error binding socket to port " << port;
+
+  err = listen(this->listenSocket, 5);
+  PCHECK(err == 0) << "Error listening on socket";
+}
+
+/**
+ * Listens on a Unix domain socket at the given path, replacing anything that
+ * was there.
+ */
+ListenerUartBackend::ListenerUartBackend(const std::string &_path) : path(_path) {
+  int err;
+
+  LOG(INFO) << "UART listening on `" << this->path << "`";
+
+  struct sockaddr_un addr = {};
+  addr.sun_family = AF_UNIX;
+
+  if(this->path.size() >= sizeof(addr.sun_path)) {
+    throw std::runtime_error("Socket path too long: " + this->path);
+  }
+
+  strncpy(addr.sun_path, this->path.c_str(), sizeof(addr.sun_path) - 1);
+
+  this->listenSocket = socket(AF_UNIX, SOCK_STREAM, 0);
+  PCHECK(this->listenSocket != -1) << "Error creating socket";
+
+  unlink(this->path.c_str());
+
+  err = bind(this->listenSocket, (struct sockaddr *) &addr, sizeof(addr));
+  PCHECK(err == 0) << "Error binding socket to " << this->path;
+
+  err = listen(this->listenSocket, 5);
+  PCHECK(err == 0) << "Error listening on socket";
+}
+
+/**
+ * Closes the sockets. The reactor must be stopped by now.
+ */
+ListenerUartBackend::~ListenerUartBackend() {
+  if(this->connected) {
+    close(this->readFd);
+  }
+
+  close(this->listenSocket);
+
+  if(!this->path.empty()) {
+    unlink(this->path.c_str());
+  }
+}
+
+/**
+ * Has the reactor accept clients as they connect.
+ */
+void ListenerUartBackend::start(IoReactor *reactor) {
+  FdUartBackend::start(reactor);
+
+  int err = fcntl(this->listenSocket, F_SETFL, fcntl(this->listenSocket, F_GETFL) | O_NONBLOCK);
+  PCHECK(err == 0) << "Error making socket non-blocking";
+
+  reactor->post([this]() {
+    this->reactor->add(this->listenSocket, IoReactor::kReadable, [this](unsigned int events) {
+      this->acceptClient();
+    });
+  });
+}
+
+/**
+ * Accepts a client that connected, unless there already is one.
+ */
+void ListenerUartBackend::acceptClient(void) {
+  int fd = accept(this->listenSocket, nullptr, nullptr);
+
+  if(fd == -1) {
+    PLOG_IF(ERROR, errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)
+        << "Error accepting UART client";
+    return;
+  }
+
+  if(this->connected) {
+    LOG(WARNING) << "UART already has a client; refusing another";
+    close(fd);
+    return;
+  }
+
+  int err = fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  PCHECK(err == 0) << "Error making socket non-blocking";
+
+  LOG(INFO) << "UART client connected";
+  VLOG(1) << "Accepted socket: " << fd;
+
+  this->attach(fd, fd);
+}
+
+/**
+ * Closes the client's socket; the next client may then connect.
+ */
+void ListenerUartBackend::detached(void) {
+  LOG(WARNING) << "UART client disconnected";
+  close(this->readFd);
+}
+
+
+
+/**
+ * Opens a pseudo terminal, and sets its terminal side to raw mode so bytes
+ * pass through unchanged.
+ */
+PtyUartBackend::PtyUartBackend() {
+  int fd = posix_openpt(O_RDWR | O_NOCTTY);
+  PCHECK(fd != -1) << "Error opening pseudo terminal";
+
+  PCHECK(grantpt(fd) == 0 && unlockpt(fd) == 0) << "Error unlocking pseudo terminal";
+
+  const char *name = ptsname(fd);
+  PCHECK(name != nullptr) << "Error getting pseudo terminal name";
+
+  this->path = name;
+
+  this->slaveFd = open(name, O_RDWR | O_NOCTTY);
+  PCHECK(this->slaveFd != -1) << "Error opening " << name;
+
+  struct termios mode;
+  PCHECK(tcgetattr(this->slaveFd, &mode) == 0) << "Error getting terminal mode";
+
+  cfmakeraw(&mode);
+  PCHECK(tcsetattr(this->slaveFd, TCSANOW, &mode) == 0) << "Error setting terminal mode";
+
+  int err = fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+  PCHECK(err == 0) << "Error making pseudo terminal non-blocking";
+
+  this->masterFd = fd;
+  this->lossy = true;
+}
+
+/**
+ * Closes both sides of the terminal.
+ */
+PtyUartBackend::~PtyUartBackend() {
+  close(this->masterFd);
+  close(this->slaveFd);
+}
+
+/**
+ * Connects the channel to the terminal right away; the terminal side is
+ * always open, so it never hangs up.
+ */
+void PtyUartBackend::start(IoReactor *reactor) {
+  FdUartBackend::start(reactor);
+
+  LOG(INFO) << "UART connected to pseudo terminal `" << this->path << "`";
+
+  reactor->post([this]() {
+    this->attach(this->masterFd, this->masterFd);
+  });
+}
+
+
+
+/**
+ * Connects the channel to standard input and output right away. Neither is
+ * made non-blocking, since that would affect whatever else shares them (like
+ * the terminal, or standard error); reads only happen once input is ready,
+ * and the terminal keeps up with output.
+ */
+void StdioUartBackend::start(IoReactor *reactor) {
+  FdUartBackend::start(reactor);
+
+  reactor->post([this]() {
+    this->attach(STDIN_FILENO, STDOUT_FILENO);
+  });
+}
+
+/**
+ * Standard input was closed; output still goes to standard output.
+ */
+void StdioUartBackend::inputEnded(void) {
+  LOG(INFO) << "UART input (stdin) ended";
+
+  if(this->readFd != this->writeFd) {
+    this->reactor->remove(this->readFd);
+  }
+
+  this->readFd = -1;
+  this->updateInterest();
+}
+
+
+
+/**
+ * Sets up the pipe; it's always connected.
+ */
+PipeUartBackend::PipeUartBackend() {
+  this->connected = true;
+}
+
+/**
+ * Puts up to count bytes into the receive ring, and returns how many fit.
+ * This and the other host side functions may be called on any one thread.
+ */
+size_t PipeUartBackend::write(const uint8_t *data, size_t count) {
+  count = this->rxRing.push(data, count);
+
+  if(count) {
+    this->received();
+  }
+
+  return count;
+}
+
+/**
+ * Publishes bytes written in place into space returned by reserve().
+ */
+void PipeUartBackend::commit(size_t count) {
+  this->rxRing.commit(count);
+  this->received();
+}
+
+/**
+ * Takes up to count transmitted bytes out of the ring, and returns how many
+ * there were.
+ */
+size_t PipeUartBackend::read(uint8_t *data, size_t count) {
+  return this->txRing.pop(data, count);
+}
+
+/**
+ * Hands transmitted bytes to the host side's handler.
+ */
+void PipeUartBackend::transmitReady(void) {
+  if(this->transmitHandler) {
+    this->transmitHandler();
+  }
+}
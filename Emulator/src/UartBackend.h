@@ -0,0 +1,254 @@
+/**
+ * Host side of a DUART channel: what the emulated serial port is connected to.
+ *
+ * Every backend has a pair of rings between the emulation thread and the host:
+ * one for received bytes, one for transmitted ones. The emulation thread only
+ * ever touches its ends of them; how they're filled and emptied on the host
+ * side is up to the backend. Those built on file descriptors do it on the
+ * DUART's I/O reactor thread:
+ *
+ * - `tcp:PORT`: listens on a TCP port, and accepts one client at a time
+ * - `unix:PATH`: the same, on a Unix domain socket
+ * - `pty`: a pseudo terminal, whose path is logged; attach `screen` or
+ *   `minicom` to it
+ * - `stdio`: standard input and output
+ *
+ * PipeUartBackend instead exposes the rings directly, for embedding the
+ * emulator in a test program.
+ */
+#ifndef UARTBACKEND_H
+#define UARTBACKEND_H
+
+#include "SpscRing.h"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+class IoReactor;
+
+class UartBackend {
+  public:
+    /// bytes buffered in each direction
+    static const size_t kRingSize = (64 * 1024);
+
+    typedef SpscRing<uint8_t, kRingSize> ring_t;
+    /// called on the host side when bytes were received
+    typedef std::function<void(void)> notify_t;
+
+  public:
+    virtual ~UartBackend() {};
+
+    static UartBackend *create(const std::string &spec);
+
+    /// whether the backend needs the I/O reactor; if so, it's passed to start()
+    virtual bool needsReactor(void) const {
+      return false;
+    }
+
+    virtual void start(IoReactor *reactor) {};
+    virtual void woken(void) {};
+
+    void setReceiveHandler(notify_t handler) {
+      this->receiveHandler = handler;
+    }
+
+    /// whether anything is connected to receive transmitted bytes
+    bool isConnected(void) const {
+      return this->connected;
+    }
+    /// whether transmitted bytes are dropped, rather than waited for, when
+    /// the host can't keep up
+    bool isLossy(void) const {
+      return this->lossy;
+    }
+
+    bool transmit(uint8_t byte);
+    void flush(void);
+    size_t receive(uint8_t *data, size_t count);
+
+    /// whether received bytes are waiting to be picked up
+    bool isReceivePending(void) const {
+      return !this->rxRing.empty();
+    }
+
+  protected:
+    /// called on the emulation thread once transmitted bytes are ready
+    virtual void transmitReady(void) = 0;
+    /// called on the emulation thread when it made room in the receive ring
+    /// after the host side found it full
+    virtual void receiveRoom(void) {};
+
+    void received(void);
+
+  protected:
+    /// received bytes, and transmitted ones
+    ring_t rxRing, txRing;
+
+    std::atomic_bool connected = false;
+    bool lossy = false;
+
+    /// set by the host side when it stopped receiving because the ring was
+    /// full; cleared by the emulation thread once it made room
+    std::atomic_bool rxStalled = false;
+
+  private:
+    notify_t receiveHandler;
+
+    /// set while the emulation thread has been told about received bytes
+    std::atomic_bool rxNotified = false;
+    /// set while bytes were transmitted that the host side wasn't told about
+    /// (emulation thread only)
+    bool txPending = false;
+};
+
+/**
+ * Base for backends that move bytes through file descriptors; all of their
+ * I/O happens on the reactor thread.
+ */
+class FdUartBackend : public UartBackend {
+  public:
+    virtual bool needsReactor(void) const {
+      return true;
+    }
+
+    virtual void start(IoReactor *reactor);
+    virtual void woken(void);
+
+  protected:
+    virtual void transmitReady(void);
+    virtual void receiveRoom(void);
+
+    void attach(int readFd, int writeFd);
+    void disconnect(void);
+    void updateInterest(void);
+
+    /// the input reached its end; by default, this disconnects
+    virtual void inputEnded(void) {
+      this->disconnect();
+    }
+    /// called after disconnecting, with the descriptors still set
+    virtual void detached(void) {};
+
+  protected:
+    IoReactor *reactor = nullptr;
+
+    /// descriptors read from and written to, or -1
+    int readFd = -1, writeFd = -1;
+
+  private:
+    void ready(int fd, unsigned int events);
+    void readInput(void);
+    void writeOutput(void);
+    void watch(int fd, unsigned int interest, bool &watched, bool &pollable);
+    void unwatch(void);
+
+  private:
+    /// set while the reactor has been told to send
+    std::atomic_bool txFlushPending = false;
+
+    /// whether the reactor watches the descriptors, and whether they can be
+    /// watched at all (regular files can't, but are always ready)
+    bool readWatched = false, writeWatched = false;
+    bool readPollable = true, writePollable = true;
+    /// events they're watched for
+    bool reading = false, writing = false;
+};
+
+/**
+ * Listens on a TCP port or Unix domain socket, and connects the channel to
+ * one client at a time; others are turned away until it disconnects.
+ */
+class ListenerUartBackend : public FdUartBackend {
+  public:
+    ListenerUartBackend(unsigned int port);
+    ListenerUartBackend(const std::string &path);
+    virtual ~ListenerUartBackend();
+
+    virtual void start(IoReactor *reactor);
+
+  protected:
+    virtual void detached(void);
+
+  private:
+    void acceptClient(void);
+
+  private:
+    int listenSocket = -1;
+    /// path of the Unix domain socket, which is removed again when done
+    std::string path;
+};
+
+/**
+ * Connects the channel to a pseudo terminal. Output is dropped while nothing
+ * reads the terminal, rather than stalling the CPU.
+ */
+class PtyUartBackend : public FdUartBackend {
+  public:
+    PtyUartBackend();
+    virtual ~PtyUartBackend();
+
+    virtual void start(IoReactor *reactor);
+
+    const std::string &getPath(void) const {
+      return this->path;
+    }
+
+  private:
+    /// our side of the terminal, and the terminal side, which is kept open
+    /// so the pty doesn't hang up between clients
+    int masterFd = -1, slaveFd = -1;
+    std::string path;
+};
+
+/**
+ * Connects the channel to the emulator's standard input and output.
+ */
+class StdioUartBackend : public FdUartBackend {
+  public:
+    virtual void start(IoReactor *reactor);
+
+  protected:
+    virtual void inputEnded(void);
+};
+
+/**
+ * Connects the channel to code in the same process. The host side may be on
+ * any one thread; it reads and writes the rings in place, or copies in and
+ * out of them with read() and write().
+ */
+class PipeUartBackend : public UartBackend {
+  public:
+    PipeUartBackend();
+
+    /// called on the emulation thread when transmitted bytes are ready
+    void setTransmitHandler(notify_t handler) {
+      this->transmitHandler = handler;
+    }
+
+    size_t write(const uint8_t *data, size_t count);
+    size_t read(uint8_t *data, size_t count);
+
+    /// free space to receive into, and bytes transmitted; see SpscRing
+    size_t reserve(uint8_t *data[2], size_t counts[2]) {
+      return this->rxRing.reserve(data, counts);
+    }
+    void commit(size_t count);
+
+    size_t peek(const uint8_t *data[2], size_t counts[2]) {
+      return this->txRing.peek(data, counts);
+    }
+    void consume(size_t count) {
+      this->txRing.consume(count);
+    }
+
+  protected:
+    virtual void transmitReady(void);
+
+  private:
+    notify_t transmitHandler;
+};
+
+#endif
@@ -1,4 +1,7 @@
 #include "VFD.h"
+#include "Emulator.h"
+#include "MC68681.h"
+#include "Snapshot.h"
 
 #include <cstdint>
 #include <iostream>
@@ -29,6 +32,13 @@ void VFD::busWrite(uint32_t addr, uint32_t data, bus_size_t size) {
     throw BusError("VFD supports only 8 bit writes");
   }
 
+  // the display is busy while it processes the byte
+  this->setBusy(true);
+
+  this->emulator->cancelEvent(this->busyEvent);
+
+  this->busyUntil = this->emulator->now() + (uint64_t(kBusyTime) * Emulator::kCpuClock) / 1000000;
+  this->scheduleNotBusy();
 }
 /**
  * Handles bus reads
@@ -37,3 +47,47 @@ uint32_t VFD::busRead(uint32_t addr, bus_size_t size) {
   throw BusError("VFD does not support reads");
   return 0;
 }
+
+/**
+ * Writes whether the display is busy, and until when, to a snapshot. The BUSY
+ * output itself is part of the DUART's state.
+ */
+void VFD::saveState(StateWriter &state) {
+  bool busy = (this->busyEvent != Scheduler::kInvalidEvent);
+
+  state.put(busy);
+  state.put(this->busyUntil);
+}
+/**
+ * Restores the busy state, and deasserts BUSY again when it's due.
+ */
+void VFD::loadState(StateReader &state) {
+  bool busy;
+
+  state.get(busy);
+  state.get(this->busyUntil);
+
+  this->emulator->cancelEvent(this->busyEvent);
+  this->busyEvent = Scheduler::kInvalidEvent;
+
+  if(busy) {
+    this->scheduleNotBusy();
+  }
+}
+
+/**
+ * Schedules BUSY to be deasserted once the display is done.
+ */
+void VFD::scheduleNotBusy(void) {
+  this->busyEvent = this->emulator->scheduleAt(this->busyUntil, [this]() {
+    this->busyEvent = Scheduler::kInvalidEvent;
+    this->setBusy(false);
+  });
+}
+
+/**
+ * Drives the BUSY output.
+ */
+void VFD::setBusy(bool busy) {
+  this->emulator->getDuart()->setInputPin(kBusyPin, busy);
+}
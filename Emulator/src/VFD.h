@@ -5,6 +5,7 @@
 #define VFD_H
 
 #include "BusPeripheral.h"
+#include "Scheduler.h"
 
 #include <cstdint>
 #include <iostream>
@@ -22,6 +23,23 @@ class VFD : public BusPeripheral {
     virtual void busWrite(uint32_t addr, uint32_t data, bus_size_t size);
     virtual uint32_t busRead(uint32_t addr, bus_size_t size);
 
+    virtual void saveState(StateWriter &state);
+    virtual void loadState(StateReader &state);
+
+  private:
+    void setBusy(bool busy);
+    void scheduleNotBusy(void);
+
+  private:
+    /// DUART input pin that the BUSY output is connected to
+    static const unsigned int kBusyPin = 3;
+    /// approximate time the display is busy after a byte is written, in µs
+    static const unsigned int kBusyTime = 100;
+
+  private:
+    /// event that deasserts BUSY again, and when it's due
+    Scheduler::event_id_t busyEvent = Scheduler::kInvalidEvent;
+    Scheduler::cycles_t busyUntil = 0;
 };
 
 #endif
@@ -2,14 +2,23 @@
  * Entry point for the emulator; this parses command line parameters and sets up
  * the state of the rest of the emulator.
  */
+#include <getopt.h>
 #include <unistd.h>
 
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
 #include <string>
+#include <thread>
 
 #include <glog/logging.h>
 
+#include "BatchRunner.h"
+#include "Console.h"
 #include "Emulator.h"
+#include "InstructionLogger.h"
+#include "MC68681.h"
+#include "UartBackend.h"
 
 
 static void SetUpLogging(int argc, char const *argv[]);
@@ -17,6 +26,9 @@ static void SetUpLogging(int argc, char const *argv[]);
 static int ParseCommandLine(int argc, char const *argv[]);
 static void PrintUsage(const char *binName);
 
+static void RunBenchmark(double seconds);
+static int RunBatch(void);
+
 /**
  * File paths and whatnot
  */
@@ -25,8 +37,80 @@ static struct {
 	std::string romPath = "rom.bin";
 	// location of NVRAM file
 	std::string nvramPath = "nvram.bin";
+
+	// whether to pace emulation to the wall clock
+	bool realtime = false;
+	// whether to translate hot code to native code
+	bool jit = false;
+	// whether to log every instruction executed
+	bool logInstructions = false;
+	// whether to service loader API calls natively, and the cycles charged
+	bool loaderHle = false;
+	int loaderHleCycles = -1;
+
+	// snapshot to start from, if any
+	std::string loadStatePath;
+	// snapshot to write, and after how many emulated seconds
+	std::string saveStatePath;
+	double saveStateSeconds = 0;
+
+	// file to log external inputs to, or to replay them from
+	std::string recordPath;
+	std::string replayPath;
+
+	// what each DUART channel is connected to; see UartBackend
+	std::string uartSpecs[2] = {"tcp:4200", "none"};
+	// whether UART characters move instantly, rather than at the baud rate
+	bool uartUnthrottled = false;
+
+	// emulated seconds between time travel checkpoints, or 0 if disabled
+	double timeTravelSeconds = 0;
+
+	// emulated seconds to benchmark for, or 0 to run normally
+	double benchmarkSeconds = 0;
+
+	// scenario file to run in batch mode, if any
+	std::string batchPath;
+	// scenarios run at once (0 = one per core)
+	unsigned int batchJobs = 0;
+	// emulated seconds to boot for before forking off the scenarios
+	double batchBootSeconds = 0;
 } gState;
 
+/**
+ * Long options; those without a short equivalent use values past any char.
+ */
+enum {
+	kOptionLoadState = 0x100,
+	kOptionSaveState,
+	kOptionSaveAfter,
+	kOptionBatch,
+	kOptionJobs,
+	kOptionBoot,
+	kOptionRecord,
+	kOptionReplay,
+	kOptionTimeTravel,
+	kOptionUartA,
+	kOptionUartB,
+	kOptionUartUnthrottled,
+};
+
+static const struct option kLongOptions[] = {
+	{"load-state", required_argument, nullptr, kOptionLoadState},
+	{"save-state", required_argument, nullptr, kOptionSaveState},
+	{"save-after", required_argument, nullptr, kOptionSaveAfter},
+	{"batch", required_argument, nullptr, kOptionBatch},
+	{"jobs", required_argument, nullptr, kOptionJobs},
+	{"boot", required_argument, nullptr, kOptionBoot},
+	{"record", required_argument, nullptr, kOptionRecord},
+	{"replay", required_argument, nullptr, kOptionReplay},
+	{"time-travel", required_argument, nullptr, kOptionTimeTravel},
+	{"uart-a", required_argument, nullptr, kOptionUartA},
+	{"uart-b", required_argument, nullptr, kOptionUartB},
+	{"uart-unthrottled", no_argument, nullptr, kOptionUartUnthrottled},
+	{nullptr, 0, nullptr, 0}
+};
+
 
 /**
  * Entry point
@@ -45,9 +129,69 @@ int main(int argc, char const *argv[]) {
 	SetUpLogging(argc, argv);
 
 
-	// set up CPU emulation
+	// run the benchmark instead, if requested
+	if(gState.benchmarkSeconds > 0) {
+		RunBenchmark(gState.benchmarkSeconds);
+		return 0;
+	}
+
+	// or run a batch of scenarios
+	if(!gState.batchPath.empty()) {
+		return RunBatch();
+	}
+
+	// set up CPU emulation; a replay takes no input from the outside
+	bool replay = !gState.replayPath.empty();
+
 	Emulator *emu = new Emulator(gState.romPath, gState.nvramPath);
 
+	if(!replay) {
+		emu->getDuart()->setBackend(MC68681::kChannelA, UartBackend::create(gState.uartSpecs[0]));
+		emu->getDuart()->setBackend(MC68681::kChannelB, UartBackend::create(gState.uartSpecs[1]));
+	}
+
+	emu->getDuart()->setUnthrottled(gState.uartUnthrottled);
+
+	emu->setRealtime(gState.realtime && !replay);
+	emu->setJit(gState.jit);
+	emu->setLoaderHle(gState.loaderHle);
+
+	if(gState.loaderHleCycles >= 0) {
+		emu->setLoaderHleCycles(gState.loaderHleCycles);
+	}
+
+	// pick up from a snapshot, and take one once the time comes
+	if(!gState.loadStatePath.empty()) {
+		emu->loadState(gState.loadStatePath);
+	}
+
+	if(!gState.recordPath.empty()) {
+		emu->startRecording(gState.recordPath);
+	} else if(replay) {
+		emu->startReplay(gState.replayPath);
+	}
+
+	// keep checkpoints to go back to, and take commands to do so
+	Console console(emu);
+
+	if(gState.timeTravelSeconds > 0) {
+		emu->enableTimeTravel(gState.timeTravelSeconds * Emulator::kCpuClock);
+		console.start();
+	}
+
+	if(!gState.saveStatePath.empty()) {
+		emu->scheduleIn(gState.saveStateSeconds * Emulator::kCpuClock, [emu]() {
+			emu->saveState(gState.saveStatePath);
+			emu->stop();
+		});
+	}
+
+	InstructionLogger logger;
+
+	if(gState.logInstructions) {
+		emu->addTracer(&logger);
+	}
+
 	// start
 	emu->start();
 
@@ -86,7 +230,7 @@ static void SetUpLogging(int argc, char const *argv[]) {
 static int ParseCommandLine(int argc, char const *argv[]) {
 	int c;
 
-	while((c = getopt(argc, const_cast<char **>(argv), "hr:n:")) != -1) {
+	while((c = getopt_long(argc, const_cast<char **>(argv), "hr:n:tjlec:b:", kLongOptions, nullptr)) != -1) {
 		switch(c) {
 			case 'h':
 				PrintUsage(argv[0]);
@@ -102,6 +246,120 @@ static int ParseCommandLine(int argc, char const *argv[]) {
 					gState.nvramPath = std::string(optarg);
 					break;
 
+				// run in real time
+				case 't':
+					gState.realtime = true;
+					break;
+
+				// translate hot code
+				case 'j':
+					gState.jit = true;
+					break;
+
+				// trace instructions
+				case 'l':
+					gState.logInstructions = true;
+					break;
+
+				// service loader calls natively
+				case 'e':
+					gState.loaderHle = true;
+					break;
+
+				// cycles to charge for a loader call
+				case 'c':
+					gState.loaderHleCycles = atoi(optarg);
+
+					if(gState.loaderHleCycles < 0) {
+						std::cerr << "invalid cycle count: " << optarg << std::endl;
+						return -1;
+					}
+					break;
+
+				// benchmark
+				case 'b':
+					gState.benchmarkSeconds = atof(optarg);
+
+					if(gState.benchmarkSeconds <= 0) {
+						std::cerr << "invalid benchmark duration: " << optarg << std::endl;
+						return -1;
+					}
+					break;
+
+				// start from a snapshot
+				case kOptionLoadState:
+					gState.loadStatePath = std::string(optarg);
+					break;
+
+				// write a snapshot, then exit
+				case kOptionSaveState:
+					gState.saveStatePath = std::string(optarg);
+					break;
+
+				case kOptionSaveAfter:
+					gState.saveStateSeconds = atof(optarg);
+
+					if(gState.saveStateSeconds <= 0) {
+						std::cerr << "invalid snapshot time: " << optarg << std::endl;
+						return -1;
+					}
+					break;
+
+				// run scenarios from a file
+				case kOptionBatch:
+					gState.batchPath = std::string(optarg);
+					break;
+
+				case kOptionJobs:
+					if(atoi(optarg) <= 0) {
+						std::cerr << "invalid job count: " << optarg << std::endl;
+						return -1;
+					}
+
+					gState.batchJobs = atoi(optarg);
+					break;
+
+				case kOptionBoot:
+					gState.batchBootSeconds = atof(optarg);
+
+					if(gState.batchBootSeconds < 0) {
+						std::cerr << "invalid boot time: " << optarg << std::endl;
+						return -1;
+					}
+					break;
+
+				// log inputs, or replay them
+				case kOptionRecord:
+					gState.recordPath = std::string(optarg);
+					break;
+
+				case kOptionReplay:
+					gState.replayPath = std::string(optarg);
+					break;
+
+				// take checkpoints to go back in time to
+				case kOptionTimeTravel:
+					gState.timeTravelSeconds = atof(optarg);
+
+					if(gState.timeTravelSeconds <= 0) {
+						std::cerr << "invalid checkpoint interval: " << optarg << std::endl;
+						return -1;
+					}
+					break;
+
+				// what the DUART channels are connected to
+				case kOptionUartA:
+					gState.uartSpecs[0] = std::string(optarg);
+					break;
+
+				case kOptionUartB:
+					gState.uartSpecs[1] = std::string(optarg);
+					break;
+
+				case kOptionUartUnthrottled:
+					gState.uartUnthrottled = true;
+					break;
+
 				// something went wrong
 				case '?':
 				// case ':':
@@ -109,6 +367,29 @@ static int ParseCommandLine(int argc, char const *argv[]) {
 			}
 	}
 
+	if(!gState.saveStatePath.empty() && gState.saveStateSeconds <= 0) {
+		std::cerr << "--save-state needs --save-after" << std::endl;
+		return -1;
+	}
+
+	if(!gState.recordPath.empty() && !gState.replayPath.empty()) {
+		std::cerr << "--record and --replay can't be combined" << std::endl;
+		return -1;
+	}
+
+	if(!gState.recordPath.empty() && gState.timeTravelSeconds > 0) {
+		std::cerr << "--record and --time-travel can't be combined" << std::endl;
+		return -1;
+	}
+
+	// the time travel console reads commands from stdin
+	for(const std::string &spec : gState.uartSpecs) {
+		if(spec == "stdio" && gState.timeTravelSeconds > 0) {
+			std::cerr << "a UART on stdio and --time-travel can't be combined" << std::endl;
+			return -1;
+		}
+	}
+
 	// assume success
 	return 1;
 }
@@ -118,10 +399,174 @@ static int ParseCommandLine(int argc, char const *argv[]) {
  */
 static void PrintUsage(const char *binName) {
 	// print to cout, not log
-	std::cout << "usage: " << binName << "[-r rom] [-n nvram] -h" << std::endl;
+	std::cout << "usage: " << binName << "[-r rom] [-n nvram] [-t] [-j] [-l] [-e] [-c cycles] [--load-state file] [--save-state file --save-after seconds] [--record file | --replay file] [--time-travel seconds] [--uart-a backend] [--uart-b backend] [--uart-unthrottled] [--batch file [--jobs n] [--boot seconds]] [-b seconds] -h" << std::endl;
 	std::cout << "\t-r: Path to boot ROM file" << std::endl;
 	std::cout << "\t-n: Path to NVRAM file" << std::endl;
+	std::cout << "\t-t: Run in real time, rather than as fast as possible" << std::endl;
+	std::cout << "\t-j: Translate frequently executed ROM code to native code (common register ops and branches; the rest calls the opcode handlers; see -b)" << std::endl;
+	std::cout << "\t-l: Log every instruction executed, along with the registers" << std::endl;
+	std::cout << "\t-e: Service calls to the loader API natively, rather than running the loader's code" << std::endl;
+	std::cout << "\t-c: Cycles to charge for each loader call serviced natively (default 32)" << std::endl;
+	std::cout << "\t--load-state: Start from a snapshot, rather than from reset" << std::endl;
+	std::cout << "\t--save-state: Write a snapshot after --save-after emulated seconds, then exit" << std::endl;
+	std::cout << "\t--record: Log every input from the outside (UART bytes, clock reads) with the cycle it arrived at" << std::endl;
+	std::cout << "\t--replay: Rerun a recording exactly, as fast as possible, without any connections" << std::endl;
+	std::cout << "\t--time-travel: Take a checkpoint every given emulated seconds, and read commands from stdin to go back in time (see README)" << std::endl;
+	std::cout << "\t--uart-a, --uart-b: What the DUART channel is connected to: tcp:PORT, unix:PATH, pty, stdio or none (default tcp:4200 for A, none for B)" << std::endl;
+	std::cout << "\t--uart-unthrottled: Move UART characters instantly, rather than taking as long as the programmed baud rate says" << std::endl;
+	std::cout << "\t--batch: Boot once, then run each scenario in the file in a forked copy of the machine, and print which passed" << std::endl;
+	std::cout << "\t--jobs: Number of scenarios to run at once (default one per core)" << std::endl;
+	std::cout << "\t--boot: Emulated seconds to run before forking off the scenarios (default 0)" << std::endl;
+	std::cout << "\t-b: Run the ROM headless for the given number of emulated seconds, with either opcode table, with and without DBcc loop skipping, with and without -j, and print how fast each was" << std::endl;
 	std::cout << "\t-h: Displays help on using this program" << std::endl;
 	std::cout << std::endl;
 	std::cout << "git version " << GIT_HASH << "/" << GIT_BRANCH << std::endl;
 }
+
+/**
+ * Outcome of a single benchmark run
+ */
+struct BenchmarkResult {
+	// instruction throughput in MIPS
+	double mips = 0;
+	// instructions executed
+	uint64_t instructions = 0;
+	// CPU state at the end
+	Emulator::M68kRegs regs;
+};
+
+/**
+ * Runs the ROM without any UART connections for the given amount of emulated
+ * time with the given settings, and prints and returns the instruction
+ * throughput in MIPS.
+ */
+static BenchmarkResult RunBenchmarkPass(const char *name, double seconds, bool decodeCache,
+										bool compactDispatch, bool jit, bool dbccFastForward = true) {
+	BenchmarkResult result;
+
+	Emulator *emu = new Emulator(gState.romPath, gState.nvramPath);
+	emu->setDecodeCache(decodeCache);
+	emu->setCompactDispatch(compactDispatch);
+	emu->setJit(jit);
+	emu->getDuart()->setUnthrottled(gState.uartUnthrottled);
+	emu->setDbccFastForward(dbccFastForward);
+
+	emu->scheduleIn(seconds * Emulator::kCpuClock, [emu]() {
+		emu->stop();
+	});
+
+	// run it
+	auto start = std::chrono::steady_clock::now();
+	emu->start();
+	std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+	result.instructions = emu->getInstructionCount();
+	emu->getRegs(result.regs);
+	delete emu;
+
+	result.mips = (result.instructions / elapsed.count()) / 1000000.0;
+
+	std::cout << name << result.instructions << " instructions in " << elapsed.count()
+			  << " s (" << result.mips << " MIPS)" << std::endl;
+
+	return result;
+}
+
+/**
+ * Checks that a benchmark run ended up in the same state as the reference run;
+ * all of the ways of running code must give identical results.
+ */
+static void CheckBenchmarkPass(const char *name, const BenchmarkResult &result,
+							   const BenchmarkResult &reference) {
+	const Emulator::M68kRegs &a = result.regs, &b = reference.regs;
+
+	bool same = (result.instructions == reference.instructions) &&
+				a.d0 == b.d0 && a.d1 == b.d1 && a.d2 == b.d2 && a.d3 == b.d3 &&
+				a.d4 == b.d4 && a.d5 == b.d5 && a.d6 == b.d6 && a.d7 == b.d7 &&
+				a.a0 == b.a0 && a.a1 == b.a1 && a.a2 == b.a2 && a.a3 == b.a3 &&
+				a.a4 == b.a4 && a.a5 == b.a5 && a.a6 == b.a6 && a.a7 == b.a7 &&
+				a.pc == b.pc && a.sr == b.sr;
+
+	if(!same) {
+		std::cout << "MISMATCH: " << name << "ended in a different state:" << std::endl
+				  << result.regs << "instead of:" << std::endl << reference.regs;
+	}
+}
+
+/**
+ * Benchmarks the ROM a few different ways: first without the decode cache, so
+ * that every instruction is looked up in either the flat or the compact
+ * dispatch tables, then with the regular interpreter (with and without DBcc
+ * loop skipping) and with the JIT.
+ *
+ * Runs that fetch instructions the same way must end up in exactly the same
+ * state; any that doesn't is reported. (Without the decode cache, opcode fetches
+ * are charged before the instruction runs rather than after, so peripherals
+ * can see slightly different times, and runs with and without it may differ.)
+ */
+static void RunBenchmark(double seconds) {
+	BenchmarkResult flat = RunBenchmarkPass("flat table:    ", seconds, false, false, false);
+	BenchmarkResult compact = RunBenchmarkPass("compact table: ", seconds, false, true, false);
+	BenchmarkResult noSkip = RunBenchmarkPass("no loop skip:  ", seconds, true, false, false, false);
+	BenchmarkResult interpreter = RunBenchmarkPass("interpreter:   ", seconds, true, false, false);
+	BenchmarkResult jit = RunBenchmarkPass("jit:           ", seconds, true, false, true);
+
+	CheckBenchmarkPass("compact table ", compact, flat);
+	CheckBenchmarkPass("interpreter ", interpreter, noSkip);
+	CheckBenchmarkPass("jit ", jit, noSkip);
+
+	if(flat.mips > 0) {
+		std::cout << "compact/flat:  " << (compact.mips / flat.mips) << "x" << std::endl;
+	}
+	if(noSkip.mips > 0) {
+		std::cout << "loop skipping: " << (interpreter.mips / noSkip.mips) << "x" << std::endl;
+	}
+	if(interpreter.mips > 0) {
+		std::cout << "jit speedup:   " << (jit.mips / interpreter.mips) << "x" << std::endl;
+	}
+}
+
+
+
+/**
+ * Boots the ROM headless (or picks up from a snapshot), then runs the batch of
+ * scenarios from there. Returns the exit code: 0 if all scenarios passed.
+ */
+static int RunBatch(void) {
+	Emulator *emu = new Emulator(gState.romPath, gState.nvramPath);
+	emu->getDuart()->setUnthrottled(gState.uartUnthrottled);
+	emu->setJit(gState.jit);
+	emu->setLoaderHle(gState.loaderHle);
+
+	if(gState.loaderHleCycles >= 0) {
+		emu->setLoaderHleCycles(gState.loaderHleCycles);
+	}
+
+	if(!gState.loadStatePath.empty()) {
+		emu->loadState(gState.loadStatePath);
+	}
+
+	// get through the boot once, rather than in every scenario
+	if(gState.batchBootSeconds > 0) {
+		emu->scheduleIn(gState.batchBootSeconds * Emulator::kCpuClock, [emu]() {
+			emu->stop();
+		});
+
+		emu->start();
+	}
+
+	unsigned int jobs = gState.batchJobs;
+
+	if(jobs == 0) {
+		jobs = std::thread::hardware_concurrency();
+	}
+
+	BatchRunner runner(emu, jobs);
+	runner.loadScenarios(gState.batchPath);
+
+	bool passed = runner.run();
+
+	delete emu;
+
+	return passed ? 0 : 1;
+}
@@ -180,6 +180,31 @@ void m68k_write_memory_8(unsigned int address, unsigned int value);
 void m68k_write_memory_16(unsigned int address, unsigned int value);
 void m68k_write_memory_32(unsigned int address, unsigned int value);
 
+/* Page table for M68K_FAST_MEMORY in m68kconf.h.  Pages with host memory for
+ * reads or writes are accessed directly by the CPU, laid out as selected by
+ * M68K_HOST_ORDER_WORDS; the rest go through the functions above.  writes
+ * counts the writes done directly.  The wait states are only used with
+ * M68K_BUS_TIMING.
+ */
+#if M68K_HOST_ORDER_WORDS && defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define M68K_BYTE_XOR 1
+#else
+#define M68K_BYTE_XOR 0
+#endif
+
+typedef struct
+{
+	unsigned char* read;  /* host memory to read from, or NULL */
+	unsigned char* write; /* host memory to write to, or NULL */
+	unsigned int wait_states; /* extra clocks per bus cycle */
+} m68k_fast_page;
+
+typedef struct
+{
+	m68k_fast_page pages[1 << (M68K_FAST_ADDRESS_BITS - M68K_FAST_PAGE_BITS)];
+	unsigned long long writes;
+} m68k_fast_memory;
+
 /* Special call to simulate undocumented 68k behavior when move.l with a
  * predecrement destination mode is executed.
  * To simulate real 68k behavior, first write the high word to
@@ -255,11 +280,23 @@ void m68k_set_fc_callback(void  (*callback)(unsigned int new_fc));
 /* Set a callback for the instruction cycle of the CPU.
  * You must enable M68K_INSTRUCTION_HOOK in m68kconf.h.
  * The CPU calls this callback just before fetching the opcode in the
- * instruction cycle.
+ * instruction cycle.  This takes effect from the next call to m68k_execute();
+ * pass NULL to remove the callback.
  * Default behavior: do nothing.
  */
 void m68k_set_instr_hook_callback(void  (*callback)(void));
 
+/* Set a callback that replaces the instruction at the given address.
+ * You must enable M68K_PC_TRAP in m68kconf.h.
+ * When the PC reaches the address, the CPU calls the callback instead of
+ * executing the instruction there.  It returns the number of cycles it took,
+ * having changed the registers (including the PC) as the routine it stands in
+ * for would have, or a negative number to execute the instruction after all.
+ * Pass NULL to remove the callback.
+ * Default behavior: no trap.
+ */
+void m68k_set_pc_trap(unsigned int address, int  (*callback)(void));
+
 
 
 /* ======================================================================== */
@@ -298,6 +335,12 @@ int m68k_cycles_remaining(void);        /* Number of cycles left */
 void m68k_modify_timeslice(int cycles); /* Modify cycles left */
 void m68k_end_timeslice(void);          /* End timeslice now */
 
+/* Returns nonzero if the CPU is stopped by a STOP instruction or halted, in
+ * which case m68k_execute() won't run any instructions until an interrupt
+ * or reset occurs.
+ */
+int m68k_is_stopped(void);
+
 /* Set the IPL0-IPL2 pins on the CPU (IRQ).
  * A transition from < 7 to 7 will cause a non-maskable interrupt (NMI).
  * Setting IRQ to 0 will clear an interrupt request.
@@ -309,6 +352,69 @@ void m68k_set_irq(unsigned int int_level);
 void m68k_pulse_halt(void);
 
 
+/* Get the number of instructions executed since the CPU was created.
+ * If context is NULL, the currently active CPU is used.
+ */
+unsigned long long m68k_get_instruction_count(void* context);
+
+
+/* Use the given page table for the current CPU (see m68k_fast_memory above.)
+ * It's owned by the caller, and referenced by the cpu context; pass NULL to
+ * send all accesses through m68k_read_memory_xx() and m68k_write_memory_xx().
+ * Call this again after changing the host memory of a page, so that
+ * instruction fetches pick up the change.
+ */
+void m68k_set_fast_memory(m68k_fast_memory* memory);
+
+
+/* Charge memory accesses for the bus cycles the cycle tables leave out (see
+ * M68K_BUS_TIMING in m68kconf.h.)  data_bus_bytes is the width of the data
+ * bus: 1 for the 68008's 8-bit bus, on which a word takes two bus cycles and
+ * a longword four, or 2 for a 16-bit bus.  Either way, every bus cycle also
+ * takes the wait states of its page.  Pass 0 to turn bus timing off.
+ */
+void m68k_set_bus_timing(unsigned int data_bus_bytes);
+
+
+/* Turn skipping of DBcc loops on or off (see M68K_DBCC_FAST_FORWARD in
+ * m68kconf.h.)  It's on by default; turning it off is only useful to check
+ * that the results are the same.
+ */
+void m68k_set_dbcc_fast_forward(int enable);
+
+
+/* Look opcodes up in the compact dispatch tables, rather than the flat 64K
+ * entry jump and cycle tables (see m68kops.h.)  Both give the same results;
+ * the compact tables take up about a tenth of the memory.
+ */
+void m68k_set_compact_dispatch(int enable);
+
+
+/* Predecoded instruction cache (see M68K_DECODE_CACHE in m68kconf.h).
+ * Instructions in the given region of memory are decoded the first time
+ * they're executed, and dispatched from the cache from then on; memory is
+ * read through m68k_read_memory_16() when the cache is set up. If anything
+ * in that region is written, the affected range has to be invalidated.
+ * The buffer must be m68k_decode_cache_size(size) bytes, and is owned by the
+ * caller; it's referenced by the cpu context. Pass NULL to disable the cache.
+ */
+unsigned int m68k_decode_cache_size(unsigned int size);
+void m68k_set_decode_cache(void* buffer, unsigned int base, unsigned int size);
+void m68k_invalidate_decode_cache(unsigned int address, unsigned int size);
+
+
+/* Dynamic translation of hot code in the decode cache (see M68K_JIT in
+ * m68kconf.h). m68k_jit_create() allocates a translator with the given
+ * amount of executable memory for translated code, or returns NULL if that
+ * isn't possible on this host. Attach it to the current CPU with
+ * m68k_set_jit(); like the decode cache, it's referenced by the cpu context.
+ */
+void* m68k_jit_create(unsigned int code_size);
+void m68k_jit_destroy(void* jit);
+void m68k_set_jit(void* jit);
+unsigned int m68k_jit_blocks(void* jit); /* Number of blocks translated */
+
+
 /* Context switching to allow multiple CPUs */
 
 /* Get the size of the cpu context in bytes */
@@ -320,6 +426,14 @@ unsigned int m68k_get_context(void* dst);
 /* set the current cpu context */
 void m68k_set_context(void* dst);
 
+/* Restore the emulated state (registers, flags, interrupt and stop state and
+ * the instruction count) from a context saved with m68k_get_context(), maybe
+ * by another process running the same build.  Unlike m68k_set_context(), the
+ * current CPU keeps everything the host set up: callbacks, cycle tables, page
+ * table, decode cache, translator and options.
+ */
+void m68k_restore_context(const void* src);
+
 /* Register the CPU state information */
 void m68k_state_register(const char *type);
 
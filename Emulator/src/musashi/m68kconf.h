@@ -60,6 +60,37 @@
  */
 #define M68K_SEPARATE_READS         OPT_OFF
 
+/* If ON, reads and writes to pages of the address space that are backed by
+ * host memory are done inline, through the page table given to
+ * m68k_set_fast_memory() (see m68kmem.h), rather than by calling
+ * m68k_read_memory_xx() and m68k_write_memory_xx().  Pages are
+ * 2^M68K_FAST_PAGE_BITS bytes, and the address space has
+ * M68K_FAST_ADDRESS_BITS bits.
+ */
+#ifndef M68K_FAST_MEMORY
+#define M68K_FAST_MEMORY            OPT_ON
+#endif
+#define M68K_FAST_PAGE_BITS         16
+#define M68K_FAST_ADDRESS_BITS      19
+
+
+/* If ON, pages in the page table hold 16-bit words in host byte order, so
+ * that word accesses are plain loads and stores; on a little endian host, the
+ * byte at a 68k address is then at (address ^ M68K_BYTE_XOR) in its page.
+ * If OFF, pages are stored in big endian byte order, like the 68k sees them.
+ */
+#ifndef M68K_HOST_ORDER_WORDS
+#define M68K_HOST_ORDER_WORDS       OPT_ON
+#endif
+
+
+/* If ON, memory accesses can be charged the extra bus cycles of a data bus
+ * narrower than 16 bits (as on the 68008), and the wait states of the page
+ * they go to; see m68k_set_bus_timing().  The cycle tables only count one
+ * bus cycle per word, without wait states.
+ */
+#define M68K_BUS_TIMING             OPT_ON
+
 /* If ON, the CPU will call m68k_write_32_pd() when it executes move.l with a
  * predecrement destination EA mode instead of m68k_write_32().
  * To simulate real 68k behavior, m68k_write_32_pd() must first write the high
@@ -115,15 +146,97 @@
 
 /* If ON, CPU will call the instruction hook callback before every
  * instruction.
+ * When ON (not OPT_SPECIFY_HANDLER), the execute loop is compiled both with
+ * and without the hook, and the hooked loop only runs while a callback is set
+ * with m68k_set_instr_hook_callback(); without one, there's no cost per
+ * instruction.  Translated code (M68K_JIT) never calls the hook, so it only
+ * runs while no callback is set.
  */
-#define M68K_INSTRUCTION_HOOK       OPT_SPECIFY_HANDLER
-#define M68K_INSTRUCTION_CALLBACK() m68k_instruction_hook()
+#define M68K_INSTRUCTION_HOOK       OPT_ON
+#define M68K_INSTRUCTION_CALLBACK() your_instruction_hook_function()
 
 
 /* If ON, the CPU will emulate the 4-byte prefetch queue of a real 68000 */
 #define M68K_EMULATE_PREFETCH       OPT_OFF
 
 
+/* If ON, instructions fetched from the region given to m68k_set_decode_cache()
+ * are decoded once, and from then on dispatched straight out of the cache,
+ * which also holds their extension words.  This can't be combined with
+ * prefetch or address error emulation.
+ */
+#define M68K_DECODE_CACHE           OPT_ON
+
+
+/* If ON, code in the decode cache that runs often enough is translated into
+ * native code (see m68k_jit_create()).  Common register to register
+ * instructions and branches are done natively, and everything else calls the
+ * regular opcode handlers (all instructions do, with M68K_LAZY_FLAGS.)  This
+ * needs M68K_DECODE_CACHE, and can't be combined with trace emulation.  Only x86-64 hosts are supported, and the instruction lengths
+ * come from M68K_GENERATED_TABLES; elsewhere m68k_jit_create() returns NULL
+ * and everything is interpreted.
+ */
+#define M68K_JIT                    OPT_ON
+#define M68K_JIT_THRESHOLD          64
+
+
+/* If ON, DBcc loops in the decode cache whose body only adds constants to
+ * registers (NOP, ADDQ/SUBQ.L to a data register, ADDQ/SUBQ to an address
+ * register and LEA (d16,An),An) skip ahead many iterations at once, as if
+ * they had been run one by one.  The last iteration is always run normally,
+ * and loops never skip past the end of the timeslice, so registers, flags,
+ * cycle counts and instruction counts all come out the same.  Nothing is
+ * skipped while an instruction hook is attached; see also
+ * m68k_set_dbcc_fast_forward().
+ */
+#ifndef M68K_DBCC_FAST_FORWARD
+#define M68K_DBCC_FAST_FORWARD      OPT_ON
+#endif
+
+
+/* If ON, the host can take over the instruction at one address, such as the
+ * entry point of a ROM routine, with m68k_set_pc_trap().  Whenever the PC gets
+ * there, the callback runs instead of the instruction; it's checked before
+ * every instruction, so it works with the decode cache and the translator
+ * alike (translated blocks never start at the trap address, though one that
+ * runs straight into it without branching isn't stopped.)
+ */
+#ifndef M68K_PC_TRAP
+#define M68K_PC_TRAP                OPT_ON
+#endif
+
+
+/* If ON, ADD and SUB only record their operands, and the V, C and X flags
+ * are worked out when something needs them (a conditional instruction, an
+ * instruction that reads or changes those flags, or reading the SR.)  With
+ * M68K_LAZY_FLAGS_VERIFY also ON, the flags are computed eagerly as well, and
+ * the core aborts if the two disagree when they're worked out; this is slow,
+ * and only meant for testing changes to the core.  Since the eager values are
+ * there too, it doesn't catch an instruction that reads V, C or X without
+ * working them out first; comparing a build without it against eager
+ * evaluation does (`make test-flags` does both.)
+ * N and Z are always stored as the raw result, so there's little left to
+ * defer; in benchmarks this was no faster than eager evaluation, which
+ * is why it's off by default.
+ */
+#ifndef M68K_LAZY_FLAGS
+#define M68K_LAZY_FLAGS             OPT_OFF
+#endif
+#ifndef M68K_LAZY_FLAGS_VERIFY
+#define M68K_LAZY_FLAGS_VERIFY      OPT_OFF
+#endif
+
+
+/* If ON, the opcode jump table, the cycle tables and the disassembler's
+ * table are not built at startup, but included from m68kopstab.h and
+ * m68kdasmtab.h as constant data.  Those are written at build time by
+ * tools/m68kgen.c; the Makefile takes care of this, and turns the option on.
+ */
+#ifndef M68K_GENERATED_TABLES
+#define M68K_GENERATED_TABLES       OPT_OFF
+#endif
+
+
 /* If ON, the CPU will generate address error exceptions if it tries to
  * access a word or longword at an odd address.
  * NOTE: This is only emulated properly for 68000 mode.
@@ -153,6 +266,18 @@
 #define M68K_USE_64_BIT  OPT_OFF
 
 
+/* Storage class applied to all of the emulation core's mutable state (the
+ * CPU registers, cycle counters and the disassembler's scratch buffers).
+ * Setting this to a thread-local storage class gives every host thread its
+ * own CPU, so several emulated CPUs may run concurrently on different threads;
+ * use m68k_get_context() and m68k_set_context() to move a CPU between them.
+ * Set it to blank to share a single CPU between all threads.
+ */
+#ifndef M68K_THREAD_LOCAL
+#define M68K_THREAD_LOCAL _Thread_local
+#endif /* M68K_THREAD_LOCAL */
+
+
 /* Set to your compiler's static inline keyword to enable it, or
  * set it to blank to disable it.
  * If you define INLINE in the makefile, it will override this value.
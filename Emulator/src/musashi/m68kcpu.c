@@ -38,6 +38,10 @@
 /* ================================ INCLUDES ============================== */
 /* ======================================================================== */
 
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
 #include "m68kops.h"
 #include "m68kcpu.h"
 
@@ -45,10 +49,10 @@
 /* ================================= DATA ================================= */
 /* ======================================================================== */
 
-int  m68ki_initial_cycles;
-int  m68ki_remaining_cycles = 0;                     /* Number of clocks remaining */
-uint m68ki_tracing = 0;
-uint m68ki_address_space;
+M68K_THREAD_LOCAL int  m68ki_initial_cycles;
+M68K_THREAD_LOCAL int  m68ki_remaining_cycles = 0;   /* Number of clocks remaining */
+M68K_THREAD_LOCAL uint m68ki_tracing = 0;
+M68K_THREAD_LOCAL uint m68ki_address_space;
 
 #ifdef M68K_LOG_ENABLE
 char* m68ki_cpu_names[9] =
@@ -66,15 +70,15 @@ char* m68ki_cpu_names[9] =
 #endif /* M68K_LOG_ENABLE */
 
 /* The CPU core */
-m68ki_cpu_core m68ki_cpu = {0};
+M68K_THREAD_LOCAL m68ki_cpu_core m68ki_cpu = {0};
 
 #if M68K_EMULATE_ADDRESS_ERROR
-jmp_buf m68ki_aerr_trap;
+M68K_THREAD_LOCAL jmp_buf m68ki_aerr_trap;
 #endif /* M68K_EMULATE_ADDRESS_ERROR */
 
-uint    m68ki_aerr_address;
-uint    m68ki_aerr_write_mode;
-uint    m68ki_aerr_fc;
+M68K_THREAD_LOCAL uint m68ki_aerr_address;
+M68K_THREAD_LOCAL uint m68ki_aerr_write_mode;
+M68K_THREAD_LOCAL uint m68ki_aerr_fc;
 
 /* Used by shift & rotate instructions */
 uint8 m68ki_shift_8_table[65] =
@@ -370,7 +374,7 @@ uint8 m68ki_ea_idx_cycle_table[64] =
  */
 
 /* Interrupt acknowledge */
-static int default_int_ack_callback_data;
+static M68K_THREAD_LOCAL int default_int_ack_callback_data;
 static int default_int_ack_callback(int int_level)
 {
 	default_int_ack_callback_data = int_level;
@@ -379,7 +383,7 @@ static int default_int_ack_callback(int int_level)
 }
 
 /* Breakpoint acknowledge */
-static unsigned int default_bkpt_ack_callback_data;
+static M68K_THREAD_LOCAL unsigned int default_bkpt_ack_callback_data;
 static void default_bkpt_ack_callback(unsigned int data)
 {
 	default_bkpt_ack_callback_data = data;
@@ -391,23 +395,19 @@ static void default_reset_instr_callback(void)
 }
 
 /* Called when the program counter changed by a large value */
-static unsigned int default_pc_changed_callback_data;
+static M68K_THREAD_LOCAL unsigned int default_pc_changed_callback_data;
 static void default_pc_changed_callback(unsigned int new_pc)
 {
 	default_pc_changed_callback_data = new_pc;
 }
 
 /* Called every time there's bus activity (read/write to/from memory */
-static unsigned int default_set_fc_callback_data;
+static M68K_THREAD_LOCAL unsigned int default_set_fc_callback_data;
 static void default_set_fc_callback(unsigned int new_fc)
 {
 	default_set_fc_callback_data = new_fc;
 }
 
-/* Called every instruction cycle prior to execution */
-static void default_instr_hook_callback(void)
-{
-}
 
 
 #if M68K_EMULATE_ADDRESS_ERROR
@@ -444,7 +444,12 @@ unsigned int m68k_get_reg(void* context, m68k_register_t regnum)
 		case M68K_REG_A6:	return cpu->dar[14];
 		case M68K_REG_A7:	return cpu->dar[15];
 		case M68K_REG_PC:	return MASK_OUT_ABOVE_32(cpu->pc);
-		case M68K_REG_SR:	return	cpu->t1_flag						|
+		case M68K_REG_SR:
+#if M68K_LAZY_FLAGS
+							if(cpu->lazy_op)
+								m68ki_sync_flags_of(cpu);
+#endif /* M68K_LAZY_FLAGS */
+							return	cpu->t1_flag						|
 									cpu->t0_flag						|
 									(cpu->s_flag << 11)					|
 									(cpu->m_flag << 11)					|
@@ -559,9 +564,127 @@ void m68k_set_fc_callback(void  (*callback)(unsigned int new_fc))
 
 void m68k_set_instr_hook_callback(void  (*callback)(void))
 {
-	CALLBACK_INSTR_HOOK = callback ? callback : default_instr_hook_callback;
+	CALLBACK_INSTR_HOOK = callback;
+}
+
+void m68k_set_pc_trap(unsigned int address, int  (*callback)(void))
+{
+	CPU_TRAP_PC = address;
+	CALLBACK_PC_TRAP = callback;
+}
+
+#if M68K_PC_TRAP
+int m68ki_pc_trap(void)
+{
+	int cycles;
+
+	if(!CALLBACK_PC_TRAP)
+		return 0;
+
+	cycles = CALLBACK_PC_TRAP();
+	if(cycles < 0)
+		return 0;
+
+	USE_CYCLES(cycles);
+	return 1;
+}
+#endif /* M68K_PC_TRAP */
+
+#if M68K_LAZY_FLAGS
+void m68ki_sync_flags_of(m68ki_cpu_core* cpu)
+{
+	uint src = cpu->lazy_src;
+	uint dst = cpu->lazy_dst;
+	uint res;
+	uint v;
+	uint c;
+
+	switch(cpu->lazy_op & LAZY_OP_MASK)
+	{
+		case LAZY_ADD_8:
+			res = src + dst;
+			v = VFLAG_ADD_8(src, dst, res);
+			c = CFLAG_8(res);
+			break;
+		case LAZY_ADD_16:
+			res = src + dst;
+			v = VFLAG_ADD_16(src, dst, res);
+			c = CFLAG_16(res);
+			break;
+		case LAZY_ADD_32:
+			res = src + dst;
+			v = VFLAG_ADD_32(src, dst, res);
+			c = CFLAG_ADD_32(src, dst, res);
+			break;
+		case LAZY_SUB_8:
+			res = dst - src;
+			v = VFLAG_SUB_8(src, dst, res);
+			c = CFLAG_8(res);
+			break;
+		case LAZY_SUB_16:
+			res = dst - src;
+			v = VFLAG_SUB_16(src, dst, res);
+			c = CFLAG_16(res);
+			break;
+		case LAZY_SUB_32:
+			res = dst - src;
+			v = VFLAG_SUB_32(src, dst, res);
+			c = CFLAG_SUB_32(src, dst, res);
+			break;
+		default:
+			cpu->lazy_op = LAZY_NONE;
+			return;
+	}
+
+#if M68K_LAZY_FLAGS_VERIFY
+	/* The eagerly computed flags must not have been touched since */
+	if(cpu->x_flag != c || (!(cpu->lazy_op & LAZY_X_ONLY) && (cpu->v_flag != v || cpu->c_flag != c)))
+	{
+		fprintf(stderr, "m68k: lazy flags (op %02x, src %08x, dst %08x) disagree near pc %08x\n",
+				cpu->lazy_op, src, dst, cpu->ppc);
+		abort();
+	}
+#endif /* M68K_LAZY_FLAGS_VERIFY */
+
+	if(!(cpu->lazy_op & LAZY_X_ONLY))
+	{
+		cpu->v_flag = v;
+		cpu->c_flag = c;
+	}
+	cpu->x_flag = c;
+	cpu->lazy_op = LAZY_NONE;
+}
+#endif /* M68K_LAZY_FLAGS */
+
+
+/* Forget what was found out about DBcc loops */
+static void m68ki_dbcc_forget_loops(void)
+{
+#if M68K_DBCC_FAST_FORWARD
+	uint i;
+
+	for(i = 0; i < M68KI_DBCC_LOOPS; i++)
+		CPU_DBCC_LOOPS[i].pc = CPU_DBCC_LOOPS[i].target = ~0u;
+#endif /* M68K_DBCC_FAST_FORWARD */
+}
+
+/* Forget decoded handlers, keeping the cached words */
+static void m68ki_decode_cache_flush(void)
+{
+	uint i;
+
+	for(i = 0; i < (CPU_DCACHE_SIZE >> 1); i++)
+		CPU_DCACHE[i].handler = NULL;
+
+	/* Loop timings come from the cycle counts of decoded instructions */
+	m68ki_dbcc_forget_loops();
+
+#if M68K_JIT
+	m68ki_jit_flush();
+#endif /* M68K_JIT */
 }
 
+
 /* Set the CPU type. */
 void m68k_set_cpu_type(unsigned int cpu_type)
 {
@@ -572,6 +695,7 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			CPU_ADDRESS_MASK = 0x00ffffff;
 			CPU_SR_MASK      = 0xa71f; /* T1 -- S  -- -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
 			CYC_INSTRUCTION  = m68ki_cycles[0];
+			CYC_TYPE_INDEX   = 0;
 			CYC_EXCEPTION    = m68ki_exception_cycle_table[0];
 			CYC_BCC_NOTAKE_B = -2;
 			CYC_BCC_NOTAKE_W = 2;
@@ -582,12 +706,13 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			CYC_MOVEM_L      = 3;
 			CYC_SHIFT        = 1;
 			CYC_RESET        = 132;
-			return;
+			break;
 		case M68K_CPU_TYPE_68010:
 			CPU_TYPE         = CPU_TYPE_010;
 			CPU_ADDRESS_MASK = 0x00ffffff;
 			CPU_SR_MASK      = 0xa71f; /* T1 -- S  -- -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
 			CYC_INSTRUCTION  = m68ki_cycles[1];
+			CYC_TYPE_INDEX   = 1;
 			CYC_EXCEPTION    = m68ki_exception_cycle_table[1];
 			CYC_BCC_NOTAKE_B = -4;
 			CYC_BCC_NOTAKE_W = 0;
@@ -598,12 +723,13 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			CYC_MOVEM_L      = 3;
 			CYC_SHIFT        = 1;
 			CYC_RESET        = 130;
-			return;
+			break;
 		case M68K_CPU_TYPE_68EC020:
 			CPU_TYPE         = CPU_TYPE_EC020;
 			CPU_ADDRESS_MASK = 0x00ffffff;
 			CPU_SR_MASK      = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
 			CYC_INSTRUCTION  = m68ki_cycles[2];
+			CYC_TYPE_INDEX   = 2;
 			CYC_EXCEPTION    = m68ki_exception_cycle_table[2];
 			CYC_BCC_NOTAKE_B = -2;
 			CYC_BCC_NOTAKE_W = 0;
@@ -614,12 +740,13 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			CYC_MOVEM_L      = 2;
 			CYC_SHIFT        = 0;
 			CYC_RESET        = 518;
-			return;
+			break;
 		case M68K_CPU_TYPE_68020:
 			CPU_TYPE         = CPU_TYPE_020;
 			CPU_ADDRESS_MASK = 0xffffffff;
 			CPU_SR_MASK      = 0xf71f; /* T1 T0 S  M  -- I2 I1 I0 -- -- -- X  N  Z  V  C  */
 			CYC_INSTRUCTION  = m68ki_cycles[2];
+			CYC_TYPE_INDEX   = 2;
 			CYC_EXCEPTION    = m68ki_exception_cycle_table[2];
 			CYC_BCC_NOTAKE_B = -2;
 			CYC_BCC_NOTAKE_W = 0;
@@ -630,8 +757,128 @@ void m68k_set_cpu_type(unsigned int cpu_type)
 			CYC_MOVEM_L      = 2;
 			CYC_SHIFT        = 0;
 			CYC_RESET        = 518;
+			break;
+		default:
 			return;
 	}
+
+	/* Cycle counts in the decode cache came from the old table */
+	m68ki_decode_cache_flush();
+}
+
+#if defined(__GNUC__)
+#define M68KI_ALWAYS_INLINE INLINE __attribute__((always_inline))
+#else
+#define M68KI_ALWAYS_INLINE INLINE
+#endif
+
+/* The main loop, which runs instructions until the timeslice is used up.
+ * It's compiled twice, with and without the instruction hook, so that there's
+ * no cost per instruction unless a hook is attached.
+ */
+M68KI_ALWAYS_INLINE void m68ki_run_loop(int hooked)
+{
+#if M68K_JIT
+	/* Whether the PC got here other than by running on from the instruction
+	 * before; only such places start blocks */
+	int jit_head = 0;
+#endif /* M68K_JIT */
+
+	do
+	{
+		/* Set tracing accodring to T1. (T0 is done inside instruction) */
+		m68ki_trace_t1(); /* auto-disable (see m68kcpu.h) */
+
+		/* Set the address space for reads */
+		m68ki_use_data_space(); /* auto-disable (see m68kcpu.h) */
+
+		/* Call external hook to peek at CPU */
+		if(hooked)
+			m68ki_instr_hook(); /* auto-disable (see m68kcpu.h) */
+
+		/* Record previous program counter */
+		REG_PPC = REG_PC;
+		CPU_INSTR_COUNT++;
+
+		/* Let the host stand in for the instruction at the trap address */
+		if(m68ki_pc_trapped()) /* auto-disable (see m68kcpu.h) */
+		{
+#if M68K_JIT
+			jit_head = 1;
+#endif /* M68K_JIT */
+			continue;
+		}
+
+#if M68K_DECODE_CACHE
+		/* Dispatch straight from the decode cache if we can */
+		if(REG_PC - CPU_DCACHE_BASE < CPU_DCACHE_SIZE)
+		{
+			m68ki_decode_entry* entry = &CPU_DCACHE[(REG_PC - CPU_DCACHE_BASE) >> 1];
+			if(!entry->handler)
+				m68ki_decode_fill(entry);
+
+#if M68K_JIT
+			/* Translate code once it's been run often enough.  Only branch
+			 * targets and the places blocks are left at count, so blocks don't
+			 * start in the middle of others; translated code doesn't call the
+			 * hook, so it only runs without one. */
+			if(!hooked && CPU_JIT && jit_head && !entry->block && ++entry->hits >= M68K_JIT_THRESHOLD)
+			{
+				entry->hits = 0;
+				entry->block = m68ki_jit_compile(REG_PC);
+			}
+
+			if(!hooked && entry->block)
+			{
+				((m68ki_jit_block)entry->block)(&m68ki_cpu, &m68ki_remaining_cycles);
+				jit_head = 1;
+			}
+			else
+#endif /* M68K_JIT */
+			{
+				REG_PC += 2;
+				REG_IR = entry->word;
+				entry->handler();
+				USE_CYCLES(entry->cycles);
+#if M68K_JIT
+				jit_head = (REG_PC != REG_PPC + entry->length);
+#endif /* M68K_JIT */
+			}
+		}
+		else
+#endif /* M68K_DECODE_CACHE */
+		{
+#if M68K_JIT
+			jit_head = 1;
+#endif /* M68K_JIT */
+			/* Read an instruction and call its handler */
+			REG_IR = m68ki_read_imm_16();
+			if(CPU_COMPACT_DISPATCH)
+			{
+				const m68ki_opcode_entry* opcode = m68ki_opcode_entry_for(REG_IR);
+				opcode->handler();
+				USE_CYCLES(opcode->cycles[CYC_TYPE_INDEX]);
+			}
+			else
+			{
+				m68ki_instruction_jump_table[REG_IR]();
+				USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
+			}
+		}
+
+		/* Trace m68k_exception, if necessary */
+		m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
+	} while(GET_CYCLES() > 0);
+}
+
+static void m68ki_run_hooked(void)
+{
+	m68ki_run_loop(1);
+}
+
+static void m68ki_run(void)
+{
+	m68ki_run_loop(0);
 }
 
 /* Execute some instructions until we use up num_cycles clock cycles */
@@ -653,28 +900,10 @@ int m68k_execute(int num_cycles)
 		m68ki_set_address_error_trap(); /* auto-disable (see m68kcpu.h) */
 
 		/* Main loop.  Keep going until we run out of clock cycles */
-		do
-		{
-			/* Set tracing accodring to T1. (T0 is done inside instruction) */
-			m68ki_trace_t1(); /* auto-disable (see m68kcpu.h) */
-
-			/* Set the address space for reads */
-			m68ki_use_data_space(); /* auto-disable (see m68kcpu.h) */
-
-			/* Call external hook to peek at CPU */
-			m68ki_instr_hook(); /* auto-disable (see m68kcpu.h) */
-
-			/* Record previous program counter */
-			REG_PPC = REG_PC;
-
-			/* Read an instruction and call its handler */
-			REG_IR = m68ki_read_imm_16();
-			m68ki_instruction_jump_table[REG_IR]();
-			USE_CYCLES(CYC_INSTRUCTION[REG_IR]);
-
-			/* Trace m68k_exception, if necessary */
-			m68ki_exception_if_trace(); /* auto-disable (see m68kcpu.h) */
-		} while(GET_CYCLES() > 0);
+		if(m68ki_instr_hook_attached())
+			m68ki_run_hooked();
+		else
+			m68ki_run();
 
 		/* set previous PC to current PC for the next entry into the loop */
 		REG_PPC = REG_PC;
@@ -705,6 +934,11 @@ int m68k_cycles_remaining(void)
 	return GET_CYCLES();
 }
 
+int m68k_is_stopped(void)
+{
+	return CPU_STOPPED != 0;
+}
+
 /* Change the timeslice */
 void m68k_modify_timeslice(int cycles)
 {
@@ -715,7 +949,8 @@ void m68k_modify_timeslice(int cycles)
 
 void m68k_end_timeslice(void)
 {
-	m68ki_initial_cycles = GET_CYCLES();
+	/* Only count the cycles that were actually used towards the timeslice */
+	m68ki_initial_cycles -= GET_CYCLES();
 	SET_CYCLES(0);
 }
 
@@ -739,6 +974,7 @@ void m68k_set_irq(unsigned int int_level)
 
 void m68k_init(void)
 {
+#if !M68K_GENERATED_TABLES
 	static uint emulation_initialized = 0;
 
 	/* The first call to this function initializes the opcode handler jump table */
@@ -747,6 +983,7 @@ void m68k_init(void)
 		m68ki_build_opcode_table();
 		emulation_initialized = 1;
 	}
+#endif /* !M68K_GENERATED_TABLES */
 
 	m68k_set_int_ack_callback(NULL);
 	m68k_set_bkpt_ack_callback(NULL);
@@ -754,6 +991,9 @@ void m68k_init(void)
 	m68k_set_pc_changed_callback(NULL);
 	m68k_set_fc_callback(NULL);
 	m68k_set_instr_hook_callback(NULL);
+	m68k_set_pc_trap(0, NULL);
+	m68k_set_fast_memory(NULL);
+	m68k_set_dbcc_fast_forward(1);
 }
 
 /* Pulse the RESET line on the CPU */
@@ -798,6 +1038,271 @@ void m68k_pulse_halt(void)
 }
 
 
+unsigned long long m68k_get_instruction_count(void* context)
+{
+	m68ki_cpu_core* cpu = context != NULL ?(m68ki_cpu_core*)context : &m68ki_cpu;
+
+	return cpu->instr_count;
+}
+
+
+/* Inline memory access; with no page table, nothing is accessed inline */
+static m68k_fast_memory m68ki_no_fast_memory;
+
+void m68k_set_fast_memory(m68k_fast_memory* memory)
+{
+	CPU_FAST_MEMORY = memory ? memory : &m68ki_no_fast_memory;
+
+	/* Look up the page of the next instruction fetch again */
+	CPU_FETCH_PAGE = ~0u;
+	CPU_FETCH_BASE = NULL;
+}
+
+void m68k_set_bus_timing(unsigned int data_bus_bytes)
+{
+	CPU_BUS_WIDTH = data_bus_bytes > 2 ? 2 : data_bus_bytes;
+
+	/* Cycle counts in the decode cache include the opcode fetch */
+	m68ki_decode_cache_flush();
+}
+
+void m68k_set_compact_dispatch(int enable)
+{
+	CPU_COMPACT_DISPATCH = enable != 0;
+}
+
+
+/* Predecoded instruction cache */
+void m68ki_decode_fill(m68ki_decode_entry* entry)
+{
+	if(CPU_COMPACT_DISPATCH)
+	{
+		const m68ki_opcode_entry* opcode = m68ki_opcode_entry_for(entry->word);
+		entry->handler = opcode->handler;
+		entry->cycles = opcode->cycles[CYC_TYPE_INDEX];
+	}
+	else
+	{
+		entry->handler = m68ki_instruction_jump_table[entry->word];
+		entry->cycles = CYC_INSTRUCTION[entry->word];
+	}
+
+#if M68K_GENERATED_TABLES
+	entry->length = m68ki_instruction_lengths[CYC_TYPE_INDEX][entry->word];
+#else
+	entry->length = 0;
+#endif /* M68K_GENERATED_TABLES */
+
+#if M68K_BUS_TIMING
+	/* The opcode is fetched from the cache, not through m68ki_read_imm_16() */
+	if(CPU_BUS_WIDTH)
+		entry->cycles += m68ki_bus_cycles(CPU_DCACHE_BASE + ((entry - CPU_DCACHE) << 1), 2);
+#endif /* M68K_BUS_TIMING */
+}
+
+unsigned int m68k_decode_cache_size(unsigned int size)
+{
+	return (size >> 1) * sizeof(m68ki_decode_entry);
+}
+
+void m68k_set_decode_cache(void* buffer, unsigned int base, unsigned int size)
+{
+	CPU_DCACHE      = (m68ki_decode_entry*)buffer;
+	CPU_DCACHE_BASE = buffer ? base : 0;
+	CPU_DCACHE_SIZE = buffer ? (size & ~1) : 0;
+
+	m68k_invalidate_decode_cache(CPU_DCACHE_BASE, CPU_DCACHE_SIZE);
+}
+
+void m68k_invalidate_decode_cache(unsigned int address, unsigned int size)
+{
+	uint offset;
+
+	for(offset = address & ~1; offset < address + size; offset += 2)
+	{
+		m68ki_decode_entry* entry;
+
+		if(offset - CPU_DCACHE_BASE >= CPU_DCACHE_SIZE)
+			continue;
+
+		entry = &CPU_DCACHE[(offset - CPU_DCACHE_BASE) >> 1];
+		entry->handler = NULL;
+		entry->word = m68k_read_memory_16(offset);
+		entry->cycles = 0;
+		entry->hits = 0;
+	}
+
+	m68ki_dbcc_forget_loops();
+
+#if M68K_JIT
+	/* Blocks may span the invalidated range without starting in it */
+	m68ki_jit_flush();
+#endif /* M68K_JIT */
+}
+
+
+/* DBcc loop skipping */
+void m68k_set_dbcc_fast_forward(int enable)
+{
+	CPU_DBCC_SKIP = enable != 0;
+	m68ki_dbcc_forget_loops();
+}
+
+#if M68K_DBCC_FAST_FORWARD
+/* Longest loop body looked at, in bytes */
+#define M68KI_DBCC_MAX_BODY 32
+
+/* Decode cache entry for an address known to be covered by it */
+static m68ki_decode_entry* m68ki_dbcc_entry(uint address)
+{
+	m68ki_decode_entry* entry = &CPU_DCACHE[(address - CPU_DCACHE_BASE) >> 1];
+
+	if(!entry->handler)
+		m68ki_decode_fill(entry);
+	return entry;
+}
+
+/* Cycles charged for fetching an extension word */
+static uint m68ki_dbcc_extension_cycles(uint address)
+{
+#if M68K_BUS_TIMING
+	if(CPU_BUS_WIDTH)
+		return m68ki_bus_cycles(address, 2);
+#endif /* M68K_BUS_TIMING */
+	(void)address;
+	return 0;
+}
+
+/* Works out whether the loop from target up to the DBcc at pc can be skipped:
+ * every instruction in it must add a constant to a register (or do nothing),
+ * and leave the counter alone.  Only code in the decode cache is looked at,
+ * since it can't change underneath us. */
+static void m68ki_dbcc_analyze(m68ki_dbcc_loop* loop, uint pc, uint target)
+{
+	m68ki_decode_entry* entry;
+	uint counter;
+	uint address;
+
+	memset(loop, 0, sizeof(*loop));
+	loop->pc = pc;
+	loop->target = target;
+
+	if(target >= pc || pc - target > M68KI_DBCC_MAX_BODY)
+		return;
+	if(target - CPU_DCACHE_BASE >= CPU_DCACHE_SIZE || pc + 4 - CPU_DCACHE_BASE > CPU_DCACHE_SIZE)
+		return;
+
+	entry = m68ki_dbcc_entry(pc);
+	counter = entry->word & 7;
+	loop->dbcc_cycles = entry->cycles;
+	loop->cycles = entry->cycles + CYC_DBCC_F_NOEXP + m68ki_dbcc_extension_cycles(pc + 2);
+	loop->instructions = 1;
+
+	for(address = target; address < pc; address += 2)
+	{
+		uint word;
+		uint reg;
+
+		entry = m68ki_dbcc_entry(address);
+		word = entry->word;
+		reg = word & 7;
+
+		loop->cycles += entry->cycles;
+		loop->instructions++;
+
+		/* nop */
+		if(word == 0x4e71)
+			continue;
+
+		/* addq/subq #n, Dn (long) or An (word, long) */
+		if((word & 0xf000) == 0x5000 && (word & 0x00c0) != 0x00c0)
+		{
+			uint data = (((word >> 9) - 1) & 7) + 1;
+			uint size = (word >> 6) & 3;
+			uint mode = (word >> 3) & 7;
+
+			if(word & 0x0100)
+				data = MASK_OUT_ABOVE_32(-data);
+
+			if(mode == 0 && size == 2 && reg != counter)
+			{
+				loop->delta[reg] += data;
+				loop->writes_flags = 1;
+				continue;
+			}
+			if(mode == 1 && size != 0)
+			{
+				loop->delta[8 + reg] += data;
+				continue;
+			}
+			return;
+		}
+
+		/* lea (d16,An), An */
+		if((word & 0xf1f8) == 0x41e8 && ((word >> 9) & 7) == reg && address + 2 < pc)
+		{
+			address += 2;
+			loop->delta[8 + reg] += MAKE_INT_16(m68ki_dbcc_entry(address)->word);
+			loop->cycles += m68ki_dbcc_extension_cycles(address);
+			continue;
+		}
+
+		return;
+	}
+
+	loop->skippable = 1;
+}
+
+/* Runs as many iterations of the loop as possible at once, right after the
+ * DBcc at REG_PPC branched back.  At least one iteration is always left for
+ * the interpreter, so the final flags come from actually running the body,
+ * and the timeslice has to last beyond the skipped iterations, so that it
+ * ends on the same instruction as it would have. */
+void m68ki_dbcc_fast_forward(void)
+{
+	m68ki_dbcc_loop* loop = &CPU_DBCC_LOOPS[(REG_PPC >> 1) & (M68KI_DBCC_LOOPS - 1)];
+	uint* r_counter = &REG_D[REG_IR & 7];
+	uint counter = MASK_OUT_ABOVE_16(*r_counter);
+	sint budget;
+	uint iterations;
+	uint i;
+
+	if(!CPU_DBCC_SKIP || m68ki_instr_hook_attached() || counter == 0)
+		return;
+#if M68K_EMULATE_TRACE
+	if(FLAG_T1)
+		return;
+#endif /* M68K_EMULATE_TRACE */
+
+	if(loop->pc != REG_PPC || loop->target != REG_PC)
+		m68ki_dbcc_analyze(loop, REG_PPC, REG_PC);
+	if(!loop->skippable)
+		return;
+
+	/* Unless it's DBF, the condition has to stay false */
+	if(loop->writes_flags && (REG_IR & 0x0f00) != 0x0100)
+		return;
+
+	/* The DBcc itself hasn't been charged for yet */
+	budget = GET_CYCLES() - (sint)loop->dbcc_cycles;
+	if(budget <= 0)
+		return;
+
+	iterations = (uint)(budget - 1) / loop->cycles;
+	if(iterations > counter)
+		iterations = counter;
+	if(iterations == 0)
+		return;
+
+	*r_counter = MASK_OUT_BELOW_16(*r_counter) | (counter - iterations);
+	for(i = 0; i < 16; i++)
+		REG_DA[i] = MASK_OUT_ABOVE_32(REG_DA[i] + iterations * loop->delta[i]);
+
+	USE_CYCLES(iterations * loop->cycles);
+	CPU_INSTR_COUNT += (unsigned long long)iterations * loop->instructions;
+}
+#endif /* M68K_DBCC_FAST_FORWARD */
+
 /* Get and set the current CPU context */
 /* This is to allow for multiple CPUs */
 unsigned int m68k_context_size()
@@ -816,6 +1321,42 @@ void m68k_set_context(void* src)
 	if(src) m68ki_cpu = *(m68ki_cpu_core*)src;
 }
 
+void m68k_restore_context(const void* src)
+{
+	m68ki_cpu_core host = m68ki_cpu;
+
+	if(!src)
+		return;
+
+	/* The saved context may not be aligned */
+	memcpy(&m68ki_cpu, src, sizeof(m68ki_cpu_core));
+
+	/* Anything that points into the process, or that the host chose */
+	m68ki_cpu.cyc_instruction      = host.cyc_instruction;
+	m68ki_cpu.cyc_exception        = host.cyc_exception;
+	m68ki_cpu.int_ack_callback     = host.int_ack_callback;
+	m68ki_cpu.bkpt_ack_callback    = host.bkpt_ack_callback;
+	m68ki_cpu.reset_instr_callback = host.reset_instr_callback;
+	m68ki_cpu.pc_changed_callback  = host.pc_changed_callback;
+	m68ki_cpu.set_fc_callback      = host.set_fc_callback;
+	m68ki_cpu.instr_hook_callback  = host.instr_hook_callback;
+	m68ki_cpu.pc_trap_callback     = host.pc_trap_callback;
+	m68ki_cpu.trap_pc              = host.trap_pc;
+	m68ki_cpu.dcache               = host.dcache;
+	m68ki_cpu.dcache_base          = host.dcache_base;
+	m68ki_cpu.dcache_size          = host.dcache_size;
+	m68ki_cpu.jit                  = host.jit;
+	m68ki_cpu.compact_dispatch     = host.compact_dispatch;
+	m68ki_cpu.fast_memory          = host.fast_memory;
+	m68ki_cpu.dbcc_skip            = host.dbcc_skip;
+	m68ki_cpu.bus_width            = host.bus_width;
+
+	/* Instructions are fetched through the page table again */
+	CPU_FETCH_PAGE = ~0u;
+	CPU_FETCH_BASE = NULL;
+	m68ki_dbcc_forget_loops();
+}
+
 
 
 /* ======================================================================== */
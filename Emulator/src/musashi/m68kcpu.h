@@ -40,6 +40,14 @@
 #include <setjmp.h>
 #endif /* M68K_EMULATE_ADDRESS_ERROR */
 
+#if M68K_DECODE_CACHE && (M68K_EMULATE_PREFETCH || M68K_EMULATE_ADDRESS_ERROR)
+#error M68K_DECODE_CACHE cannot be used with prefetch or address error emulation
+#endif /* M68K_DECODE_CACHE */
+
+#if M68K_JIT && (!M68K_DECODE_CACHE || M68K_EMULATE_TRACE)
+#error M68K_JIT requires M68K_DECODE_CACHE, and cannot be used with trace emulation
+#endif /* M68K_JIT */
+
 /* ======================================================================== */
 /* ==================== ARCHITECTURE-DEPENDANT DEFINES ==================== */
 /* ======================================================================== */
@@ -341,8 +349,24 @@
 #define CPU_SR_MASK      m68ki_cpu.sr_mask
 #define CPU_INSTR_MODE   m68ki_cpu.instr_mode
 #define CPU_RUN_MODE     m68ki_cpu.run_mode
+#define CPU_DCACHE       m68ki_cpu.dcache
+#define CPU_DCACHE_BASE  m68ki_cpu.dcache_base
+#define CPU_DCACHE_SIZE  m68ki_cpu.dcache_size
+#define CPU_JIT          m68ki_cpu.jit
+#define CPU_INSTR_COUNT  m68ki_cpu.instr_count
+#define CPU_COMPACT_DISPATCH m68ki_cpu.compact_dispatch
+#define CPU_FAST_MEMORY  m68ki_cpu.fast_memory
+#define CPU_BUS_WIDTH    m68ki_cpu.bus_width
+#define CPU_FETCH_PAGE   m68ki_cpu.fetch_page
+#define CPU_FETCH_BASE   m68ki_cpu.fetch_base
+#define CPU_DBCC_SKIP    m68ki_cpu.dbcc_skip
+#define CPU_DBCC_LOOPS   m68ki_cpu.dbcc_loops
+#define CPU_LAZY_OP      m68ki_cpu.lazy_op
+#define CPU_LAZY_SRC     m68ki_cpu.lazy_src
+#define CPU_LAZY_DST     m68ki_cpu.lazy_dst
 
 #define CYC_INSTRUCTION  m68ki_cpu.cyc_instruction
+#define CYC_TYPE_INDEX   m68ki_cpu.cyc_type_index
 #define CYC_EXCEPTION    m68ki_cpu.cyc_exception
 #define CYC_BCC_NOTAKE_B m68ki_cpu.cyc_bcc_notake_b
 #define CYC_BCC_NOTAKE_W m68ki_cpu.cyc_bcc_notake_w
@@ -361,6 +385,8 @@
 #define CALLBACK_PC_CHANGED  m68ki_cpu.pc_changed_callback
 #define CALLBACK_SET_FC      m68ki_cpu.set_fc_callback
 #define CALLBACK_INSTR_HOOK  m68ki_cpu.instr_hook_callback
+#define CALLBACK_PC_TRAP     m68ki_cpu.pc_trap_callback
+#define CPU_TRAP_PC          m68ki_cpu.trap_pc
 
 
 
@@ -408,7 +434,15 @@
 #endif
 
 
-#if !M68K_SEPARATE_READS
+#if !M68K_SEPARATE_READS && M68K_FAST_MEMORY
+/* Fetch through the instruction fetch window (see m68kmem.h) */
+#define m68k_read_immediate_16(A) m68ki_fetch_16(A)
+#define m68k_read_immediate_32(A) m68ki_fetch_32(A)
+
+#define m68k_read_pcrelative_8(A) m68ki_fetch_8(A)
+#define m68k_read_pcrelative_16(A) m68ki_fetch_16(A)
+#define m68k_read_pcrelative_32(A) m68ki_fetch_32(A)
+#elif !M68K_SEPARATE_READS
 #define m68k_read_immediate_16(A) m68ki_read_program_16(A)
 #define m68k_read_immediate_32(A) m68ki_read_program_32(A)
 
@@ -453,11 +487,14 @@
 #if M68K_INSTRUCTION_HOOK
 	#if M68K_INSTRUCTION_HOOK == OPT_SPECIFY_HANDLER
 		#define m68ki_instr_hook() M68K_INSTRUCTION_CALLBACK()
+		#define m68ki_instr_hook_attached() 1
 	#else
 		#define m68ki_instr_hook() CALLBACK_INSTR_HOOK()
+		#define m68ki_instr_hook_attached() (CALLBACK_INSTR_HOOK != NULL)
 	#endif
 #else
 	#define m68ki_instr_hook()
+	#define m68ki_instr_hook_attached() 0
 #endif /* M68K_INSTRUCTION_HOOK */
 
 #if M68K_MONITOR_PC
@@ -507,11 +544,27 @@
 #endif /* M68K_EMULATE_TRACE */
 
 
+/* Let the host take over the instruction at the trap address; true if it did */
+#if M68K_PC_TRAP
+	#define m68ki_pc_trapped() (REG_PC == CPU_TRAP_PC && m68ki_pc_trap())
+#else
+	#define m68ki_pc_trapped() 0
+#endif /* M68K_PC_TRAP */
+
+
+/* Skip ahead in a DBcc loop that was just branched back to, if possible */
+#if M68K_DBCC_FAST_FORWARD
+	#define m68ki_dbcc_skip_loop() m68ki_dbcc_fast_forward()
+#else
+	#define m68ki_dbcc_skip_loop()
+#endif /* M68K_DBCC_FAST_FORWARD */
+
+
 
 /* Address error */
 #if M68K_EMULATE_ADDRESS_ERROR
 	#include <setjmp.h>
-	extern jmp_buf m68ki_aerr_trap;
+	extern M68K_THREAD_LOCAL jmp_buf m68ki_aerr_trap;
 
 	#define m68ki_set_address_error_trap() \
 		if(setjmp(m68ki_aerr_trap) != 0) \
@@ -729,8 +782,53 @@
 #define COND_XC() (!COND_XS)
 
 
+/* Lazy flag evaluation. Handlers that read or write V, C or X call
+ * m68ki_sync_flags() first; ADD and SUB record their operands through
+ * m68ki_lazy_add/sub_*() instead of computing V, C and X, and instructions
+ * that only clear V and C leave X pending.
+ */
+#define LAZY_NONE   0
+#define LAZY_ADD_8  1
+#define LAZY_ADD_16 2
+#define LAZY_ADD_32 3
+#define LAZY_SUB_8  4
+#define LAZY_SUB_16 5
+#define LAZY_SUB_32 6
+#define LAZY_OP_MASK 0x7f
+#define LAZY_X_ONLY 0x80 /* V and C have since been set; only X is pending */
+
+#if M68K_LAZY_FLAGS
+	#if M68K_LAZY_FLAGS_VERIFY
+		#define m68ki_lazy_eager(V, C) (FLAG_V = (V), FLAG_X = FLAG_C = (C))
+	#else
+		#define m68ki_lazy_eager(V, C) ((void)0)
+	#endif /* M68K_LAZY_FLAGS_VERIFY */
+
+	#define m68ki_lazy_record(OP, S, D, V, C) (m68ki_lazy_eager(V, C), \
+											   CPU_LAZY_OP = (OP), \
+											   CPU_LAZY_SRC = (S), \
+											   CPU_LAZY_DST = (D))
+
+	#define m68ki_lazy_clear_vc() (FLAG_V = VFLAG_CLEAR, FLAG_C = CFLAG_CLEAR, \
+								   CPU_LAZY_OP ? (CPU_LAZY_OP |= LAZY_X_ONLY) : 0)
+
+	#define m68ki_sync_flags() (CPU_LAZY_OP ? m68ki_sync_flags_of(&m68ki_cpu) : (void)0)
+#else
+	#define m68ki_lazy_record(OP, S, D, V, C) (FLAG_V = (V), FLAG_X = FLAG_C = (C))
+	#define m68ki_lazy_clear_vc() (FLAG_V = VFLAG_CLEAR, FLAG_C = CFLAG_CLEAR)
+	#define m68ki_sync_flags() ((void)0)
+#endif /* M68K_LAZY_FLAGS */
+
+#define m68ki_lazy_add_8(S, D, R)  m68ki_lazy_record(LAZY_ADD_8, S, D, VFLAG_ADD_8(S, D, R), CFLAG_8(R))
+#define m68ki_lazy_add_16(S, D, R) m68ki_lazy_record(LAZY_ADD_16, S, D, VFLAG_ADD_16(S, D, R), CFLAG_16(R))
+#define m68ki_lazy_add_32(S, D, R) m68ki_lazy_record(LAZY_ADD_32, S, D, VFLAG_ADD_32(S, D, R), CFLAG_ADD_32(S, D, R))
+#define m68ki_lazy_sub_8(S, D, R)  m68ki_lazy_record(LAZY_SUB_8, S, D, VFLAG_SUB_8(S, D, R), CFLAG_8(R))
+#define m68ki_lazy_sub_16(S, D, R) m68ki_lazy_record(LAZY_SUB_16, S, D, VFLAG_SUB_16(S, D, R), CFLAG_16(R))
+#define m68ki_lazy_sub_32(S, D, R) m68ki_lazy_record(LAZY_SUB_32, S, D, VFLAG_SUB_32(S, D, R), CFLAG_SUB_32(S, D, R))
+
 /* Get the condition code register */
-#define m68ki_get_ccr() ((COND_XS() >> 4) | \
+#define m68ki_get_ccr() (m68ki_sync_flags(), \
+						 (COND_XS() >> 4) | \
 						 (COND_MI() >> 4) | \
 						 (COND_EQ() << 2) | \
 						 (COND_VS() >> 6) | \
@@ -798,6 +896,33 @@
 /* =============================== PROTOTYPES ============================= */
 /* ======================================================================== */
 
+/* An entry in the predecoded instruction cache; there is one per word */
+typedef struct
+{
+	void (*handler)(void); /* Opcode handler, or NULL if not decoded yet */
+	uint16 word;           /* Contents of memory at this address */
+	uint16 cycles;         /* Cycles used by the instruction */
+	uint16 hits;           /* Times the interpreter started a block here (M68K_JIT) */
+	uint8  length;         /* Bytes in the instruction, or 0 if not known */
+	void*  block;          /* Translated code starting here, or NULL */
+} m68ki_decode_entry;
+
+/* Number of DBcc loops whose analysis is remembered */
+#define M68KI_DBCC_LOOPS 4
+
+/* A DBcc loop, as analyzed for M68K_DBCC_FAST_FORWARD */
+typedef struct
+{
+	uint pc;           /* Address of the DBcc instruction */
+	uint target;       /* Address the DBcc branches back to */
+	uint skippable;    /* Whether iterations can be skipped */
+	uint writes_flags; /* Whether the body changes the condition codes */
+	uint dbcc_cycles;  /* Cycles used by the DBcc, before the branch */
+	uint cycles;       /* Cycles used per iteration */
+	uint instructions; /* Instructions per iteration, including the DBcc */
+	uint delta[16];    /* Added to each register per iteration */
+} m68ki_dbcc_loop;
+
 typedef struct
 {
 	uint cpu_type;     /* CPU Type: 68000, 68010, 68EC020, or 68020 */
@@ -841,7 +966,8 @@ typedef struct
 	uint cyc_movem_l;
 	uint cyc_shift;
 	uint cyc_reset;
-	uint8* cyc_instruction;
+	const uint8* cyc_instruction;
+	uint cyc_type_index;        /* Cycle table in use, for compact dispatch */
 	uint8* cyc_exception;
 
 	/* Callbacks to host */
@@ -851,23 +977,88 @@ typedef struct
 	void (*pc_changed_callback)(unsigned int new_pc); /* Called when the PC changes by a large amount */
 	void (*set_fc_callback)(unsigned int new_fc);     /* Called when the CPU function code changes */
 	void (*instr_hook_callback)(void);                /* Called every instruction cycle prior to execution */
+	int  (*pc_trap_callback)(void);                   /* Called instead of the instruction at trap_pc */
+	uint trap_pc;
+
+	/* Predecoded instruction cache */
+	m68ki_decode_entry* dcache; /* One entry per word, or NULL if disabled */
+	uint dcache_base;           /* First address covered by the cache */
+	uint dcache_size;           /* Number of bytes covered by the cache */
+
+	/* Dynamic translator, or NULL if disabled */
+	void* jit;
+
+	unsigned long long instr_count; /* Instructions executed */
+
+	/* Look up opcodes in the compact dispatch tables (see m68kops.h) */
+	uint compact_dispatch;
+
+	/* Pages accessed inline (M68K_FAST_MEMORY); never NULL once initialized */
+	m68k_fast_memory* fast_memory;
+
+	/* Page instructions were last fetched from, and its host memory or NULL */
+	uint fetch_page;
+	const unsigned char* fetch_base;
+
+	/* Whether DBcc loops may be skipped, and the loops seen last
+	 * (M68K_DBCC_FAST_FORWARD) */
+	uint dbcc_skip;
+	m68ki_dbcc_loop dbcc_loops[M68KI_DBCC_LOOPS];
+
+	/* Data bus width in bytes for bus timing, or 0 (M68K_BUS_TIMING) */
+	uint bus_width;
+
+	/* Operation whose V, C and X flags haven't been computed (M68K_LAZY_FLAGS) */
+	uint lazy_op;
+	uint lazy_src;
+	uint lazy_dst;
 
 } m68ki_cpu_core;
 
 
-extern m68ki_cpu_core m68ki_cpu;
-extern sint           m68ki_remaining_cycles;
-extern uint           m68ki_tracing;
+extern M68K_THREAD_LOCAL m68ki_cpu_core m68ki_cpu;
+extern M68K_THREAD_LOCAL sint           m68ki_remaining_cycles;
+extern M68K_THREAD_LOCAL uint           m68ki_tracing;
 extern uint8          m68ki_shift_8_table[];
 extern uint16         m68ki_shift_16_table[];
 extern uint           m68ki_shift_32_table[];
 extern uint8          m68ki_exception_cycle_table[][256];
-extern uint           m68ki_address_space;
+extern M68K_THREAD_LOCAL uint           m68ki_address_space;
 extern uint8          m68ki_ea_idx_cycle_table[];
 
-extern uint           m68ki_aerr_address;
-extern uint           m68ki_aerr_write_mode;
-extern uint           m68ki_aerr_fc;
+extern M68K_THREAD_LOCAL uint           m68ki_aerr_address;
+extern M68K_THREAD_LOCAL uint           m68ki_aerr_write_mode;
+extern M68K_THREAD_LOCAL uint           m68ki_aerr_fc;
+
+#if M68K_LAZY_FLAGS
+/* Compute the flags left pending by the last ADD or SUB */
+void m68ki_sync_flags_of(m68ki_cpu_core* cpu);
+#endif /* M68K_LAZY_FLAGS */
+
+#if M68K_DECODE_CACHE
+/* Look up the handler and cycles for a decode cache entry's word */
+void m68ki_decode_fill(m68ki_decode_entry* entry);
+#endif /* M68K_DECODE_CACHE */
+
+#if M68K_PC_TRAP
+/* Calls the trap callback; returns nonzero if it handled the instruction */
+int m68ki_pc_trap(void);
+#endif /* M68K_PC_TRAP */
+
+#if M68K_DBCC_FAST_FORWARD
+/* Called by DBcc after branching back; skips ahead if the loop allows it */
+void m68ki_dbcc_fast_forward(void);
+#endif /* M68K_DBCC_FAST_FORWARD */
+
+#if M68K_JIT
+/* Translated code; runs until the PC leaves the block or the timeslice ends */
+typedef void (*m68ki_jit_block)(m68ki_cpu_core* cpu, sint* remaining_cycles);
+
+/* Translate the code at the given address (see m68kjit.c) */
+void* m68ki_jit_compile(uint address);
+/* Throw away all translated code */
+void m68ki_jit_flush(void);
+#endif /* M68K_JIT */
 
 /* Read data immediately after the program counter */
 INLINE uint m68ki_read_imm_16(void);
@@ -999,6 +1190,8 @@ char* m68ki_disassemble_quick(unsigned int pc, unsigned int cpu_type);
 /* Handles all immediate reads, does address error check, function code setting,
  * and prefetching if they are enabled in m68kconf.h
  */
+#include "m68kmem.h"
+
 INLINE uint m68ki_read_imm_16(void)
 {
 	m68ki_set_fc(FLAG_S | FUNCTION_CODE_USER_PROGRAM); /* auto-disable (see m68kcpu.h) */
@@ -1012,6 +1205,17 @@ INLINE uint m68ki_read_imm_16(void)
 	REG_PC += 2;
 	return MASK_OUT_ABOVE_16(CPU_PREF_DATA >> ((2-((REG_PC-2)&2))<<3));
 #else
+#if M68K_DECODE_CACHE
+	{
+		uint offset = REG_PC - CPU_DCACHE_BASE;
+		if(offset < CPU_DCACHE_SIZE)
+		{
+			m68ki_bus_timing(REG_PC, 2);
+			REG_PC += 2;
+			return CPU_DCACHE[offset >> 1].word;
+		}
+	}
+#endif /* M68K_DECODE_CACHE */
 	REG_PC += 2;
 	return m68k_read_immediate_16(ADDRESS_68K(REG_PC-2));
 #endif /* M68K_EMULATE_PREFETCH */
@@ -1042,6 +1246,17 @@ INLINE uint m68ki_read_imm_32(void)
 #else
 	m68ki_set_fc(FLAG_S | FUNCTION_CODE_USER_PROGRAM); /* auto-disable (see m68kcpu.h) */
 	m68ki_check_address_error(REG_PC, MODE_READ, FLAG_S | FUNCTION_CODE_USER_PROGRAM); /* auto-disable (see m68kcpu.h) */
+#if M68K_DECODE_CACHE
+	{
+		uint offset = REG_PC - CPU_DCACHE_BASE;
+		if(offset + 2 < CPU_DCACHE_SIZE)
+		{
+			m68ki_bus_timing(REG_PC, 4);
+			REG_PC += 4;
+			return ((uint)CPU_DCACHE[offset >> 1].word << 16) | CPU_DCACHE[(offset >> 1) + 1].word;
+		}
+	}
+#endif /* M68K_DECODE_CACHE */
 	REG_PC += 4;
 	return m68k_read_immediate_32(ADDRESS_68K(REG_PC-4));
 #endif /* M68K_EMULATE_PREFETCH */
@@ -1051,6 +1266,22 @@ INLINE uint m68ki_read_imm_32(void)
 
 /* ------------------------- Top level read/write ------------------------- */
 
+#if M68K_FAST_MEMORY
+#define m68ki_bus_read_8(A)      m68ki_fast_read_8(A)
+#define m68ki_bus_read_16(A)     m68ki_fast_read_16(A)
+#define m68ki_bus_read_32(A)     m68ki_fast_read_32(A)
+#define m68ki_bus_write_8(A, V)  m68ki_fast_write_8(A, V)
+#define m68ki_bus_write_16(A, V) m68ki_fast_write_16(A, V)
+#define m68ki_bus_write_32(A, V) m68ki_fast_write_32(A, V)
+#else
+#define m68ki_bus_read_8(A)      m68k_read_memory_8(A)
+#define m68ki_bus_read_16(A)     m68k_read_memory_16(A)
+#define m68ki_bus_read_32(A)     m68k_read_memory_32(A)
+#define m68ki_bus_write_8(A, V)  m68k_write_memory_8(A, V)
+#define m68ki_bus_write_16(A, V) m68k_write_memory_16(A, V)
+#define m68ki_bus_write_32(A, V) m68k_write_memory_32(A, V)
+#endif /* M68K_FAST_MEMORY */
+
 /* Handles all memory accesses (except for immediate reads if they are
  * configured to use separate functions in m68kconf.h).
  * All memory accesses must go through these top level functions.
@@ -1060,37 +1291,43 @@ INLINE uint m68ki_read_imm_32(void)
 INLINE uint m68ki_read_8_fc(uint address, uint fc)
 {
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
-	return m68k_read_memory_8(ADDRESS_68K(address));
+	m68ki_bus_timing(address, 1);
+	return m68ki_bus_read_8(ADDRESS_68K(address));
 }
 INLINE uint m68ki_read_16_fc(uint address, uint fc)
 {
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
 	m68ki_check_address_error(address, MODE_READ, fc); /* auto-disable (see m68kcpu.h) */
-	return m68k_read_memory_16(ADDRESS_68K(address));
+	m68ki_bus_timing(address, 2);
+	return m68ki_bus_read_16(ADDRESS_68K(address));
 }
 INLINE uint m68ki_read_32_fc(uint address, uint fc)
 {
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
 	m68ki_check_address_error(address, MODE_READ, fc); /* auto-disable (see m68kcpu.h) */
-	return m68k_read_memory_32(ADDRESS_68K(address));
+	m68ki_bus_timing(address, 4);
+	return m68ki_bus_read_32(ADDRESS_68K(address));
 }
 
 INLINE void m68ki_write_8_fc(uint address, uint fc, uint value)
 {
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
-	m68k_write_memory_8(ADDRESS_68K(address), value);
+	m68ki_bus_timing(address, 1);
+	m68ki_bus_write_8(ADDRESS_68K(address), value);
 }
 INLINE void m68ki_write_16_fc(uint address, uint fc, uint value)
 {
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
 	m68ki_check_address_error(address, MODE_WRITE, fc); /* auto-disable (see m68kcpu.h) */
-	m68k_write_memory_16(ADDRESS_68K(address), value);
+	m68ki_bus_timing(address, 2);
+	m68ki_bus_write_16(ADDRESS_68K(address), value);
 }
 INLINE void m68ki_write_32_fc(uint address, uint fc, uint value)
 {
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
 	m68ki_check_address_error(address, MODE_WRITE, fc); /* auto-disable (see m68kcpu.h) */
-	m68k_write_memory_32(ADDRESS_68K(address), value);
+	m68ki_bus_timing(address, 4);
+	m68ki_bus_write_32(ADDRESS_68K(address), value);
 }
 
 #if M68K_SIMULATE_PD_WRITES
@@ -1098,6 +1335,7 @@ INLINE void m68ki_write_32_pd_fc(uint address, uint fc, uint value)
 {
 	m68ki_set_fc(fc); /* auto-disable (see m68kcpu.h) */
 	m68ki_check_address_error(address, MODE_WRITE, fc); /* auto-disable (see m68kcpu.h) */
+	m68ki_bus_timing(address, 4);
 	m68k_write_memory_32_pd(ADDRESS_68K(address), value);
 }
 #endif
@@ -1423,6 +1661,7 @@ INLINE void m68ki_set_sm_flag_nosp(uint value)
 /* Set the condition code register */
 INLINE void m68ki_set_ccr(uint value)
 {
+	CPU_LAZY_OP = LAZY_NONE;
 	FLAG_X = BIT_4(value)  << 4;
 	FLAG_N = BIT_3(value)  << 4;
 	FLAG_Z = !BIT_2(value);
@@ -168,10 +168,12 @@ char* get_imm_str_s8(void);
 char* get_imm_str_s16(void);
 char* get_imm_str_s32(void);
 
+#if !M68K_GENERATED_TABLES
 /* Stuff to build the opcode handler jump table */
 static void  build_opcode_table(void);
 static int   valid_ea(uint opcode, uint mask);
 static int DECL_SPEC compare_nof_true_bits(const void *aptr, const void *bptr);
+#endif /* !M68K_GENERATED_TABLES */
 
 /* used to build opcode handler jump table */
 typedef struct
@@ -188,19 +190,21 @@ typedef struct
 /* ================================= DATA ================================= */
 /* ======================================================================== */
 
+#if !M68K_GENERATED_TABLES
 /* Opcode handler jump table */
 static void (*g_instruction_table[0x10000])(void);
 /* Flag if disassembler initialized */
 static int  g_initialized = 0;
+#endif /* !M68K_GENERATED_TABLES */
 
 /* Address mask to simulate address lines */
-static unsigned int g_address_mask = 0xffffffff;
+static M68K_THREAD_LOCAL unsigned int g_address_mask = 0xffffffff;
 
-static char g_dasm_str[100]; /* string to hold disassembly */
-static char g_helper_str[100]; /* string to hold helpful info */
-static uint g_cpu_pc;        /* program counter */
-static uint g_cpu_ir;        /* instruction register */
-static uint g_cpu_type;
+static M68K_THREAD_LOCAL char g_dasm_str[100]; /* string to hold disassembly */
+static M68K_THREAD_LOCAL char g_helper_str[100]; /* string to hold helpful info */
+static M68K_THREAD_LOCAL uint g_cpu_pc;        /* program counter */
+static M68K_THREAD_LOCAL uint g_cpu_ir;        /* instruction register */
+static M68K_THREAD_LOCAL uint g_cpu_type;
 
 /* used by ops like asr, ror, addq, etc */
 static uint g_3bit_qdata_table[8] = {8, 1, 2, 3, 4, 5, 6, 7};
@@ -275,7 +279,7 @@ static int make_int_16(int value)
 /* Get string representation of hex values */
 static char* make_signed_hex_str_8(uint val)
 {
-	static char str[20];
+	static M68K_THREAD_LOCAL char str[20];
 
 	val &= 0xff;
 
@@ -291,7 +295,7 @@ static char* make_signed_hex_str_8(uint val)
 
 static char* make_signed_hex_str_16(uint val)
 {
-	static char str[20];
+	static M68K_THREAD_LOCAL char str[20];
 
 	val &= 0xffff;
 
@@ -307,7 +311,7 @@ static char* make_signed_hex_str_16(uint val)
 
 static char* make_signed_hex_str_32(uint val)
 {
-	static char str[20];
+	static M68K_THREAD_LOCAL char str[20];
 
 	val &= 0xffffffff;
 
@@ -325,7 +329,7 @@ static char* make_signed_hex_str_32(uint val)
 /* make string of immediate value */
 static char* get_imm_str_s(uint size)
 {
-	static char str[15];
+	static M68K_THREAD_LOCAL char str[15];
 	if(size == 0)
 		sprintf(str, "#%s", make_signed_hex_str_8(read_imm_8()));
 	else if(size == 1)
@@ -337,7 +341,7 @@ static char* get_imm_str_s(uint size)
 
 static char* get_imm_str_u(uint size)
 {
-	static char str[15];
+	static M68K_THREAD_LOCAL char str[15];
 	if(size == 0)
 		sprintf(str, "#$%x", read_imm_8() & 0xff);
 	else if(size == 1)
@@ -350,9 +354,9 @@ static char* get_imm_str_u(uint size)
 /* Make string of effective address mode */
 static char* get_ea_mode_str(uint instruction, uint size)
 {
-	static char b1[64];
-	static char b2[64];
-	static char* mode = b2;
+	static M68K_THREAD_LOCAL char b1[64];
+	static M68K_THREAD_LOCAL char b2[64];
+	static M68K_THREAD_LOCAL char* mode = NULL;
 	uint extension;
 	uint base;
 	uint outer;
@@ -2812,6 +2816,13 @@ static void d68020_unpk_mm(void)
 /* ======================= INSTRUCTION TABLE BUILDER ====================== */
 /* ======================================================================== */
 
+#if M68K_GENERATED_TABLES
+
+/* Opcode handler jump table, written at build time by tools/m68kgen.c */
+#include "m68kdasmtab.h"
+
+#else
+
 /* EA Masks:
 800 = data register direct
 400 = address register direct
@@ -3233,6 +3244,8 @@ static void build_opcode_table(void)
 	}
 }
 
+#endif /* M68K_GENERATED_TABLES */
+
 
 
 /* ======================================================================== */
@@ -3242,11 +3255,13 @@ static void build_opcode_table(void)
 /* Disasemble one instruction at pc and store in str_buff */
 unsigned int m68k_disassemble(char* str_buff, unsigned int pc, unsigned int cpu_type)
 {
+#if !M68K_GENERATED_TABLES
 	if(!g_initialized)
 	{
 		build_opcode_table();
 		g_initialized = 1;
 	}
+#endif /* !M68K_GENERATED_TABLES */
 	switch(cpu_type)
 	{
 		case M68K_CPU_TYPE_68000:
@@ -3287,7 +3302,7 @@ unsigned int m68k_disassemble(char* str_buff, unsigned int pc, unsigned int cpu_
 
 char* m68ki_disassemble_quick(unsigned int pc, unsigned int cpu_type)
 {
-	static char buff[100];
+	static M68K_THREAD_LOCAL char buff[100];
 	buff[0] = 0;
 	m68k_disassemble(buff, pc, cpu_type);
 	return buff;
@@ -3296,11 +3311,13 @@ char* m68ki_disassemble_quick(unsigned int pc, unsigned int cpu_type)
 /* Check if the instruction is a valid one */
 unsigned int m68k_is_valid_instruction(unsigned int instruction, unsigned int cpu_type)
 {
+#if !M68K_GENERATED_TABLES
 	if(!g_initialized)
 	{
 		build_opcode_table();
 		g_initialized = 1;
 	}
+#endif /* !M68K_GENERATED_TABLES */
 
 	instruction &= 0xffff;
 	if(g_instruction_table[instruction] == d68000_illegal)
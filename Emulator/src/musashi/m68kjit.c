@@ -0,0 +1,818 @@
+/* ======================================================================== */
+/* ========================= DYNAMIC TRANSLATION ========================== */
+/* ======================================================================== */
+/*
+ * Translates runs of instructions out of the decode cache into x86-64 code.
+ *
+ * The most common register to register instructions (MOVE, MOVEQ, ADD, SUB,
+ * CMP, ADDQ and SUBQ) and conditional branches (Bcc and DBcc) are turned into
+ * native code that does their work directly.  Everything else becomes a call
+ * into its regular opcode handler, with the program counter, instruction
+ * register and cycle counts baked in as immediates, so anything the
+ * interpreter can run, a block can run too.
+ *
+ * After every instruction, the block returns to the interpreter if the
+ * timeslice is used up, or if the program counter isn't where the next
+ * instruction in the block starts (a branch was taken, or an exception
+ * happened.) Branches back to the start of the block, as in tight loops, stay
+ * in the block. Execution is thus the same as if the instructions had been
+ * interpreted.
+ */
+
+#include <stddef.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "m68kcpu.h"
+#include "m68kops.h"
+
+/* Instruction lengths come from the generated tables */
+#if defined(__x86_64__) && !defined(_WIN32) && M68K_GENERATED_TABLES
+#define M68KJIT_SUPPORTED 1
+#include <sys/mman.h>
+#else
+#define M68KJIT_SUPPORTED 0
+#endif
+
+#if M68K_JIT
+
+/* Most instructions to put in a block */
+#define M68KJIT_MAX_INSTRUCTIONS 32
+/* Most bytes of code a single block can take up */
+#define M68KJIT_MAX_BLOCK_SIZE   (M68KJIT_MAX_INSTRUCTIONS * 256 + 64)
+/* Most places a block can be left from */
+#define M68KJIT_MAX_EXITS        (M68KJIT_MAX_INSTRUCTIONS * 4)
+
+/* State of the translator; one per CPU */
+typedef struct
+{
+	uint8* code; /* Executable memory for translated blocks */
+	uint size;   /* Size of the code buffer, in bytes */
+	uint used;   /* Bytes of the code buffer in use */
+	uint blocks; /* Blocks translated so far */
+} m68ki_jit_state;
+
+
+#if M68KJIT_SUPPORTED
+
+/* A block being translated */
+typedef struct
+{
+	uint address;                     /* Where the block starts */
+	uint8* loop;                      /* Code to go back to the start */
+	uint8* exits[M68KJIT_MAX_EXITS];  /* Jumps to patch to the exit */
+	uint num_exits;
+} m68ki_jit_block_info;
+
+/* Host registers used by generated code */
+#define X86_EAX 0
+#define X86_ECX 1
+#define X86_EDX 2
+
+/* Condition codes of x86 jumps (the second byte of jcc rel32) */
+#define X86_JE  0x84
+#define X86_JNE 0x85
+#define X86_JLE 0x8e
+
+/* Offsets into the CPU state */
+#define CPU_OFFSET(FIELD) ((uint)offsetof(m68ki_cpu_core, FIELD))
+#define CPU_OFFSET_DA(N)  (CPU_OFFSET(dar) + (N) * 4)
+
+/* Code emission */
+static void emit_8(uint8** out, uint value)
+{
+	*(*out)++ = value & 0xff;
+}
+
+static void emit_32(uint8** out, uint value)
+{
+	emit_8(out, value);
+	emit_8(out, value >> 8);
+	emit_8(out, value >> 16);
+	emit_8(out, value >> 24);
+}
+
+static void emit_64(uint8** out, unsigned long long value)
+{
+	emit_32(out, (uint)value);
+	emit_32(out, (uint)(value >> 32));
+}
+
+/* ModRM byte and displacement for the operand [rbx+offset] */
+static void emit_modrm_cpu(uint8** out, uint reg, uint offset)
+{
+	emit_8(out, 0x83 | (reg << 3));
+	emit_32(out, offset);
+}
+
+/* mov rax, func; call rax */
+static void emit_call(uint8** out, void (*func)(void))
+{
+	emit_8(out, 0x48);
+	emit_8(out, 0xb8);
+	emit_64(out, (unsigned long long)(size_t)func);
+	emit_8(out, 0xff);
+	emit_8(out, 0xd0);
+}
+
+/* mov dword [rbx+offset], value */
+static void emit_store_cpu(uint8** out, uint offset, uint value)
+{
+	emit_8(out, 0xc7);
+	emit_modrm_cpu(out, 0, offset);
+	emit_32(out, value);
+}
+
+/* cmp dword [rbx+offset], value */
+static void emit_cmp_cpu(uint8** out, uint offset, uint value)
+{
+	emit_8(out, 0x81);
+	emit_modrm_cpu(out, 7, offset);
+	emit_32(out, value);
+}
+
+/* add qword [rbx+offset], 1 */
+static void emit_inc64_cpu(uint8** out, uint offset)
+{
+	emit_8(out, 0x48);
+	emit_8(out, 0x83);
+	emit_modrm_cpu(out, 0, offset);
+	emit_8(out, 0x01);
+}
+
+/* sub dword [r12], value */
+static void emit_use_cycles(uint8** out, uint value)
+{
+	emit_8(out, 0x41);
+	emit_8(out, 0x81);
+	emit_8(out, 0x2c);
+	emit_8(out, 0x24);
+	emit_32(out, value);
+}
+
+/* jcc rel32; returns where to patch in the displacement */
+static uint8* emit_jcc(uint8** out, uint condition)
+{
+	uint8* patch;
+
+	emit_8(out, 0x0f);
+	emit_8(out, condition);
+	patch = *out;
+	emit_32(out, 0);
+	return patch;
+}
+
+/* jmp rel32; returns where to patch in the displacement */
+static uint8* emit_jmp(uint8** out)
+{
+	uint8* patch;
+
+	emit_8(out, 0xe9);
+	patch = *out;
+	emit_32(out, 0);
+	return patch;
+}
+
+/* Points the rel32 displacement at patch to target */
+static void emit_patch(uint8* patch, uint8* target)
+{
+	uint displacement = (uint)(target - (patch + 4));
+	memcpy(patch, &displacement, 4);
+}
+
+/* Whether the instruction never continues with the one after it */
+static int m68ki_jit_ends_block(uint word)
+{
+	if((word & 0xff00) == 0x6000)  /* bra */
+		return 1;
+	if((word & 0xff80) == 0x4e80)  /* jsr, jmp */
+		return 1;
+	if((word & 0xfff0) == 0x4e40)  /* trap */
+		return 1;
+	switch(word)
+	{
+		case 0x4e72:               /* stop */
+		case 0x4e73:               /* rte */
+		case 0x4e75:               /* rts */
+		case 0x4e77:               /* rtr */
+			return 1;
+	}
+	return 0;
+}
+
+
+#if !M68K_LAZY_FLAGS
+/*
+ * Native code for the most common register to register instructions and
+ * for conditional branches.  These work on the CPU state in memory, like the
+ * handlers do, and leave the flags the way they would (N, V, C and X are only
+ * ever looked at through the bits named in m68kcpu.h, so those bits are all
+ * that's set.)  Afterwards the PC is always up to date, so that the block
+ * can be left at any point; the previous PC isn't, but the interpreter sets
+ * that whenever it gets control back.
+ *
+ * With M68K_LAZY_FLAGS, all instructions are run through their handlers.
+ */
+
+/* test dword [rbx+offset], value */
+static void emit_test_cpu(uint8** out, uint offset, uint value)
+{
+	emit_8(out, 0xf7);
+	emit_modrm_cpu(out, 0, offset);
+	emit_32(out, value);
+}
+
+/* Zero extending load of a byte, word or long: movzx/mov reg, [rbx+offset] */
+static void emit_load_cpu(uint8** out, uint reg, uint size, uint offset)
+{
+	if(size == 4)
+		emit_8(out, 0x8b);
+	else
+	{
+		emit_8(out, 0x0f);
+		emit_8(out, size == 1 ? 0xb6 : 0xb7);
+	}
+	emit_modrm_cpu(out, reg, offset);
+}
+
+/* Store of the low byte, word or long of a register: mov [rbx+offset], reg */
+static void emit_store_reg_cpu(uint8** out, uint reg, uint size, uint offset)
+{
+	if(size == 2)
+		emit_8(out, 0x66);
+	emit_8(out, size == 1 ? 0x88 : 0x89);
+	emit_modrm_cpu(out, reg, offset);
+}
+
+/* Byte, word or long ALU operation on eax with ecx: op eax, ecx */
+static void emit_alu(uint8** out, uint op, uint size)
+{
+	if(size == 2)
+		emit_8(out, 0x66);
+	emit_8(out, size == 1 ? op : op + 1);
+	emit_8(out, 0xc0 | (X86_ECX << 3) | X86_EAX);
+}
+
+#define X86_ADD 0x00
+#define X86_SUB 0x28
+
+/* shl/shr reg, count */
+static void emit_shift(uint8** out, uint right, uint reg, uint count)
+{
+	emit_8(out, 0xc1);
+	emit_8(out, (right ? 0xe8 : 0xe0) | reg);
+	emit_8(out, count);
+}
+
+/* setcc reg8; movzx reg, reg8 */
+static void emit_setcc(uint8** out, uint condition, uint reg)
+{
+	emit_8(out, 0x0f);
+	emit_8(out, condition);
+	emit_8(out, 0xc0 | reg);
+	emit_8(out, 0x0f);
+	emit_8(out, 0xb6);
+	emit_8(out, 0xc0 | (reg << 3) | reg);
+}
+
+#define X86_SETO 0x90
+#define X86_SETC 0x92
+#define X86_SETE 0x94
+
+/* Size in bytes of the size field of MOVE (bits 13 and 12) */
+static uint m68ki_jit_move_size(uint word)
+{
+	switch((word >> 12) & 3)
+	{
+		case 1: return 1;
+		case 3: return 2;
+		case 2: return 4;
+	}
+	return 0;
+}
+
+/* Size in bytes of the usual size field (bits 7 and 6), or 0 if it's 3 */
+static uint m68ki_jit_size(uint word)
+{
+	switch((word >> 6) & 3)
+	{
+		case 0: return 1;
+		case 1: return 2;
+		case 2: return 4;
+	}
+	return 0;
+}
+
+/* Extra clocks for fetching a branch displacement at the given address */
+static uint m68ki_jit_extension_cycles(uint address)
+{
+#if M68K_BUS_TIMING
+	if(CPU_BUS_WIDTH)
+		return m68ki_bus_cycles(address, 2);
+#endif /* M68K_BUS_TIMING */
+	(void)address;
+	return 0;
+}
+
+/* Extension word at the given address, which is known to be in the cache */
+static uint m68ki_jit_extension(uint address)
+{
+	return CPU_DCACHE[(address - CPU_DCACHE_BASE) >> 1].word;
+}
+
+/* Sets the flags from the result of an ALU operation in eax, the same way
+ * the handlers do, and writes the result to data register dst, unless it's
+ * a compare (dst is then -1); compares leave X alone. */
+static void m68ki_jit_alu_flags(uint8** out, uint size, int dst)
+{
+	emit_setcc(out, X86_SETC, X86_ECX);
+	emit_setcc(out, X86_SETO, X86_EDX);
+
+	if(size != 4)
+	{
+		emit_8(out, 0x0f);                              /* movzx eax, al/ax */
+		emit_8(out, size == 1 ? 0xb6 : 0xb7);
+		emit_8(out, 0xc0);
+	}
+	if(dst >= 0)
+		emit_store_reg_cpu(out, X86_EAX, size, CPU_OFFSET_DA(dst));
+	emit_store_reg_cpu(out, X86_EAX, 4, CPU_OFFSET(not_z_flag));
+	if(size != 1)
+		emit_shift(out, 1, X86_EAX, size * 8 - 8);
+	emit_store_reg_cpu(out, X86_EAX, 4, CPU_OFFSET(n_flag));
+
+	emit_shift(out, 0, X86_ECX, 8);
+	emit_store_reg_cpu(out, X86_ECX, 4, CPU_OFFSET(c_flag));
+	if(dst >= 0)
+		emit_store_reg_cpu(out, X86_ECX, 4, CPU_OFFSET(x_flag));
+	emit_shift(out, 0, X86_EDX, 7);
+	emit_store_reg_cpu(out, X86_EDX, 4, CPU_OFFSET(v_flag));
+}
+
+/* Sets N and Z from a MOVE result in eax (zero extended), and clears V and C */
+static void m68ki_jit_move_flags(uint8** out, uint size)
+{
+	emit_store_reg_cpu(out, X86_EAX, 4, CPU_OFFSET(not_z_flag));
+	if(size != 1)
+		emit_shift(out, 1, X86_EAX, size * 8 - 8);
+	emit_store_reg_cpu(out, X86_EAX, 4, CPU_OFFSET(n_flag));
+	emit_store_cpu(out, CPU_OFFSET(v_flag), VFLAG_CLEAR);
+	emit_store_cpu(out, CPU_OFFSET(c_flag), CFLAG_CLEAR);
+}
+
+/* Tests a condition (2 to 15, as in Bcc); returns the x86 condition code
+ * under which it's true */
+static uint m68ki_jit_condition(uint8** out, uint condition)
+{
+	switch(condition)
+	{
+		case 2:  /* hi */
+		case 3:  /* ls: C or Z */
+			emit_load_cpu(out, X86_EAX, 4, CPU_OFFSET(c_flag));
+			emit_shift(out, 1, X86_EAX, 8);
+			emit_cmp_cpu(out, CPU_OFFSET(not_z_flag), 0);
+			emit_setcc(out, X86_SETE, X86_ECX);
+			break;
+		case 14: /* gt */
+		case 15: /* le: N xor V, or Z */
+			emit_load_cpu(out, X86_EAX, 4, CPU_OFFSET(n_flag));
+			emit_8(out, 0x33);                          /* xor eax, [v_flag] */
+			emit_modrm_cpu(out, X86_EAX, CPU_OFFSET(v_flag));
+			emit_shift(out, 1, X86_EAX, 7);
+			emit_cmp_cpu(out, CPU_OFFSET(not_z_flag), 0);
+			emit_setcc(out, X86_SETE, X86_ECX);
+			break;
+		case 4:  /* cc */
+		case 5:  /* cs */
+			emit_test_cpu(out, CPU_OFFSET(c_flag), CFLAG_SET);
+			return (condition & 1) ? X86_JNE : X86_JE;
+		case 6:  /* ne */
+		case 7:  /* eq */
+			emit_cmp_cpu(out, CPU_OFFSET(not_z_flag), 0);
+			return (condition & 1) ? X86_JE : X86_JNE;
+		case 8:  /* vc */
+		case 9:  /* vs */
+			emit_test_cpu(out, CPU_OFFSET(v_flag), VFLAG_SET);
+			return (condition & 1) ? X86_JNE : X86_JE;
+		case 10: /* pl */
+		case 11: /* mi */
+			emit_test_cpu(out, CPU_OFFSET(n_flag), NFLAG_SET);
+			return (condition & 1) ? X86_JNE : X86_JE;
+		default: /* ge, lt: N xor V */
+			emit_load_cpu(out, X86_EAX, 4, CPU_OFFSET(n_flag));
+			emit_8(out, 0x33);                          /* xor eax, [v_flag] */
+			emit_modrm_cpu(out, X86_EAX, CPU_OFFSET(v_flag));
+			emit_8(out, 0xa9);                          /* test eax, 0x80 */
+			emit_32(out, 0x80);
+			return (condition & 1) ? X86_JNE : X86_JE;
+	}
+
+	/* Compound conditions: or together the two bits in eax and ecx */
+	emit_8(out, 0x83);                                  /* and eax, 1 */
+	emit_8(out, 0xe0);
+	emit_8(out, 0x01);
+	emit_8(out, 0x09);                                  /* or eax, ecx */
+	emit_8(out, 0xc8);
+	return (condition & 1) ? X86_JNE : X86_JE;
+}
+
+/* Goes on at target once a branch is taken, with the PC stored and the cycles
+ * used: back to the start of the block, unless the timeslice is over, or out
+ * of the block */
+static void m68ki_jit_branch(uint8** out, m68ki_jit_block_info* info, uint target)
+{
+	if(target == info->address)
+	{
+		info->exits[info->num_exits++] = emit_jcc(out, X86_JLE);
+		emit_patch(emit_jmp(out), info->loop);
+	}
+	else
+		info->exits[info->num_exits++] = emit_jmp(out);
+}
+
+/* Bcc.B and Bcc.W (but not BRA or BSR) */
+static void m68ki_jit_bcc(uint8** out, m68ki_jit_block_info* info, uint pc,
+							m68ki_decode_entry* entry)
+{
+	uint displacement = entry->word & 0xff;
+	uint next = pc + (displacement ? 2 : 4);
+	uint target = pc + 2 + (displacement ? MAKE_INT_8(displacement) : MAKE_INT_16(m68ki_jit_extension(pc + 2)));
+	uint taken_cycles = entry->cycles + (displacement ? 0 : m68ki_jit_extension_cycles(pc + 2));
+	uint8* taken;
+	uint8* done;
+
+	taken = emit_jcc(out, m68ki_jit_condition(out, (entry->word >> 8) & 0xf));
+	emit_store_cpu(out, CPU_OFFSET(pc), next);
+	emit_use_cycles(out, entry->cycles + (displacement ? CYC_BCC_NOTAKE_B : CYC_BCC_NOTAKE_W));
+	done = emit_jmp(out);
+
+	emit_patch(taken, *out);
+	emit_store_cpu(out, CPU_OFFSET(pc), target);
+	emit_use_cycles(out, taken_cycles);
+	m68ki_jit_branch(out, info, target);
+
+	emit_patch(done, *out);
+}
+
+/* DBcc (but not DBT, which never branches) */
+static void m68ki_jit_dbcc(uint8** out, m68ki_jit_block_info* info, uint pc,
+							m68ki_decode_entry* entry)
+{
+	uint condition = (entry->word >> 8) & 0xf;
+	uint counter = CPU_OFFSET_DA(entry->word & 7);
+	uint target = pc + 2 + MAKE_INT_16(m68ki_jit_extension(pc + 2));
+	uint branch_cycles = CYC_DBCC_F_NOEXP + m68ki_jit_extension_cycles(pc + 2);
+	uint8* condition_true = NULL;
+	uint8* expired;
+	uint8* done;
+
+	if(condition != 1)
+		condition_true = emit_jcc(out, m68ki_jit_condition(out, condition));
+
+	/* sub word [counter], 1; jc expired (it went from 0 to $ffff) */
+	emit_8(out, 0x66);
+	emit_8(out, 0x83);
+	emit_modrm_cpu(out, 5, counter);
+	emit_8(out, 0x01);
+	expired = emit_jcc(out, 0x82);
+
+	/* The loop goes on; see if it can be skipped, as the handler would */
+	emit_store_cpu(out, CPU_OFFSET(pc), target);
+#if M68K_DBCC_FAST_FORWARD
+	emit_use_cycles(out, branch_cycles);
+	emit_store_cpu(out, CPU_OFFSET(ppc), pc);
+	emit_store_cpu(out, CPU_OFFSET(ir), entry->word);
+	emit_call(out, m68ki_dbcc_fast_forward);
+	emit_use_cycles(out, entry->cycles);
+#else
+	emit_use_cycles(out, entry->cycles + branch_cycles);
+#endif /* M68K_DBCC_FAST_FORWARD */
+	m68ki_jit_branch(out, info, target);
+
+	emit_patch(expired, *out);
+	emit_store_cpu(out, CPU_OFFSET(pc), pc + 4);
+	emit_use_cycles(out, entry->cycles + CYC_DBCC_F_EXP);
+
+	if(condition_true)
+	{
+		done = emit_jmp(out);
+		emit_patch(condition_true, *out);
+		emit_store_cpu(out, CPU_OFFSET(pc), pc + 4);
+		emit_use_cycles(out, entry->cycles);
+		emit_patch(done, *out);
+	}
+}
+
+/* Generates native code for the instruction at pc if it's one of those
+ * handled here; returns whether it did.  The code falls through to the next
+ * instruction with the cycles just used, so the caller can check whether the
+ * timeslice is over (jle.) */
+static int m68ki_jit_native(uint8** out, m68ki_jit_block_info* info, uint pc,
+							m68ki_decode_entry* entry)
+{
+	uint word = entry->word;
+	uint reg = (word >> 9) & 7;
+	uint mode = (word >> 3) & 7;
+	uint size;
+
+	/* moveq #data, Dn */
+	if((word & 0xf100) == 0x7000)
+	{
+		uint res = MAKE_INT_8(word & 0xff);
+
+		emit_store_cpu(out, CPU_OFFSET_DA(reg), res);
+		emit_store_cpu(out, CPU_OFFSET(not_z_flag), res);
+		emit_store_cpu(out, CPU_OFFSET(n_flag), NFLAG_32(res));
+		emit_store_cpu(out, CPU_OFFSET(v_flag), VFLAG_CLEAR);
+		emit_store_cpu(out, CPU_OFFSET(c_flag), CFLAG_CLEAR);
+	}
+	/* move Dm/Am, Dn */
+	else if((word & 0xc1c0) == 0x0000 && (size = m68ki_jit_move_size(word)) != 0 &&
+			(mode == 0 || (mode == 1 && size != 1)))
+	{
+		emit_load_cpu(out, X86_EAX, size, CPU_OFFSET_DA(word & 0xf));
+		emit_store_reg_cpu(out, X86_EAX, size, CPU_OFFSET_DA(reg));
+		m68ki_jit_move_flags(out, size);
+	}
+	/* add, sub, cmp Dm/Am, Dn */
+	else if(((word & 0xf000) == 0xd000 || (word & 0xf000) == 0x9000 || (word & 0xf000) == 0xb000) &&
+			(word & 0x0100) == 0 && (size = m68ki_jit_size(word)) != 0 &&
+			(mode == 0 || (mode == 1 && size != 1)))
+	{
+		/* (a compare is a subtraction whose result isn't written back) */
+		emit_load_cpu(out, X86_EAX, size, CPU_OFFSET_DA(reg));
+		emit_load_cpu(out, X86_ECX, size, CPU_OFFSET_DA(word & 0xf));
+		emit_alu(out, (word & 0xf000) == 0xd000 ? X86_ADD : X86_SUB, size);
+		m68ki_jit_alu_flags(out, size, (word & 0xf000) == 0xb000 ? -1 : (int)reg);
+	}
+	/* addq, subq #data, Dn */
+	else if((word & 0xf038) == 0x5000 && (size = m68ki_jit_size(word)) != 0)
+	{
+		emit_load_cpu(out, X86_EAX, size, CPU_OFFSET_DA(word & 7));
+		emit_8(out, 0xb9);                              /* mov ecx, data */
+		emit_32(out, ((reg - 1) & 7) + 1);
+		emit_alu(out, (word & 0x0100) ? X86_SUB : X86_ADD, size);
+		m68ki_jit_alu_flags(out, size, word & 7);
+	}
+	/* addq, subq #data, An (which doesn't change the flags) */
+	else if((word & 0xf038) == 0x5008 && (word & 0x00c0) != 0x0000 && (word & 0x00c0) != 0x00c0)
+	{
+		emit_8(out, 0x83);                              /* add/sub dword [An], data */
+		emit_modrm_cpu(out, (word & 0x0100) ? 5 : 0, CPU_OFFSET_DA(8 + (word & 7)));
+		emit_8(out, ((reg - 1) & 7) + 1);
+	}
+	/* bcc (displacements of $ff are longs on the 68020, and odd otherwise) */
+	else if((word & 0xf000) == 0x6000 && (word & 0x0e00) != 0 && (word & 0xff) != 0xff)
+	{
+		m68ki_jit_bcc(out, info, pc, entry);
+		return 1;
+	}
+	/* dbcc */
+	else if((word & 0xf0f8) == 0x50c8 && (word & 0x0f00) != 0)
+	{
+		m68ki_jit_dbcc(out, info, pc, entry);
+		return 1;
+	}
+	else
+		return 0;
+
+	emit_store_cpu(out, CPU_OFFSET(pc), pc + 2);
+	emit_use_cycles(out, entry->cycles);
+	return 1;
+}
+#endif /* !M68K_LAZY_FLAGS */
+
+/* Translates the block starting at address into the code buffer */
+static void* m68ki_jit_translate(m68ki_jit_state* jit, uint address)
+{
+	uint8* start = jit->code + jit->used;
+	uint8* out = start;
+	uint8* body;
+	m68ki_jit_block_info info;
+	uint num_instructions = 0;
+	uint pc = address;
+	uint i;
+
+	info.address = address;
+	info.num_exits = 0;
+
+	/* push rbx; push r12; sub rsp, 8 (keeps the stack aligned for calls) */
+	emit_8(&out, 0x53);
+	emit_8(&out, 0x41);
+	emit_8(&out, 0x54);
+	emit_8(&out, 0x48);
+	emit_8(&out, 0x83);
+	emit_8(&out, 0xec);
+	emit_8(&out, 0x08);
+	/* mov rbx, rdi; mov r12, rsi */
+	emit_8(&out, 0x48);
+	emit_8(&out, 0x89);
+	emit_8(&out, 0xfb);
+	emit_8(&out, 0x49);
+	emit_8(&out, 0x89);
+	emit_8(&out, 0xf4);
+
+	/* The interpreter already counted the first instruction; when the block
+	 * loops back to its start, that has to happen here. */
+	body = emit_jmp(&out);
+	info.loop = out;
+	emit_inc64_cpu(&out, CPU_OFFSET(instr_count));
+	emit_patch(body, out);
+
+	while(num_instructions < M68KJIT_MAX_INSTRUCTIONS)
+	{
+		m68ki_decode_entry* entry;
+		uint length;
+
+		if(pc - CPU_DCACHE_BASE >= CPU_DCACHE_SIZE)
+			break;
+
+		entry = &CPU_DCACHE[(pc - CPU_DCACHE_BASE) >> 1];
+		if(!entry->handler)
+			m68ki_decode_fill(entry);
+
+		/* The whole instruction must come from the cache */
+		length = entry->length;
+		if(length == 0 || pc + length - CPU_DCACHE_BASE > CPU_DCACHE_SIZE)
+			break;
+
+		/* The first instruction was counted by the interpreter */
+		if(num_instructions > 0)
+			emit_inc64_cpu(&out, CPU_OFFSET(instr_count));
+
+#if !M68K_LAZY_FLAGS
+		if(m68ki_jit_native(&out, &info, pc, entry))
+		{
+			num_instructions++;
+			pc += length;
+
+			/* Leave if the timeslice is over */
+			if(num_instructions < M68KJIT_MAX_INSTRUCTIONS)
+				info.exits[info.num_exits++] = emit_jcc(&out, X86_JLE);
+			continue;
+		}
+#endif /* !M68K_LAZY_FLAGS */
+
+		emit_store_cpu(&out, CPU_OFFSET(ppc), pc);
+		emit_store_cpu(&out, CPU_OFFSET(pc), pc + 2);
+		emit_store_cpu(&out, CPU_OFFSET(ir), entry->word);
+		emit_call(&out, entry->handler);
+		emit_use_cycles(&out, entry->cycles);
+
+		num_instructions++;
+		pc += length;
+
+		if(m68ki_jit_ends_block(entry->word) || num_instructions == M68KJIT_MAX_INSTRUCTIONS)
+			break;
+
+		/* Leave if the timeslice is over (jle). Otherwise, keep going if the
+		 * PC is at the next instruction, or start over if it went back to the
+		 * start of the block (je); anything else leaves as well (jmp). */
+		info.exits[info.num_exits++] = emit_jcc(&out, X86_JLE);
+		emit_cmp_cpu(&out, CPU_OFFSET(pc), pc);
+		emit_8(&out, 0x74);
+		emit_8(&out, 10 + 6 + 5);
+		emit_cmp_cpu(&out, CPU_OFFSET(pc), address);
+		emit_patch(emit_jcc(&out, X86_JE), info.loop);
+		info.exits[info.num_exits++] = emit_jmp(&out);
+	}
+
+	if(num_instructions == 0)
+		return NULL;
+
+	for(i = 0; i < info.num_exits; i++)
+		emit_patch(info.exits[i], out);
+
+	/* add rsp, 8; pop r12; pop rbx; ret */
+	emit_8(&out, 0x48);
+	emit_8(&out, 0x83);
+	emit_8(&out, 0xc4);
+	emit_8(&out, 0x08);
+	emit_8(&out, 0x41);
+	emit_8(&out, 0x5c);
+	emit_8(&out, 0x5b);
+	emit_8(&out, 0xc3);
+
+	jit->used += (uint)(out - start);
+	jit->blocks++;
+	return start;
+}
+
+#endif /* M68KJIT_SUPPORTED */
+
+
+void* m68ki_jit_compile(uint address)
+{
+#if M68KJIT_SUPPORTED
+	m68ki_jit_state* jit = (m68ki_jit_state*)CPU_JIT;
+	void* block;
+
+	/* Start over once the code buffer fills up */
+	if(jit->size - jit->used < M68KJIT_MAX_BLOCK_SIZE)
+		m68ki_jit_flush();
+
+	if(mprotect(jit->code, jit->size, PROT_READ | PROT_WRITE) != 0)
+		return NULL;
+
+	block = m68ki_jit_translate(jit, address);
+
+	if(mprotect(jit->code, jit->size, PROT_READ | PROT_EXEC) != 0)
+		return NULL;
+
+	return block;
+#else
+	(void)address;
+	return NULL;
+#endif /* M68KJIT_SUPPORTED */
+}
+
+void m68ki_jit_flush(void)
+{
+	m68ki_jit_state* jit = (m68ki_jit_state*)CPU_JIT;
+	uint i;
+
+	for(i = 0; i < (CPU_DCACHE_SIZE >> 1); i++)
+		CPU_DCACHE[i].block = NULL;
+
+	if(jit)
+		jit->used = 0;
+}
+
+
+void* m68k_jit_create(unsigned int code_size)
+{
+#if M68KJIT_SUPPORTED
+	m68ki_jit_state* jit;
+	void* code;
+
+	code = mmap(NULL, code_size, PROT_READ | PROT_EXEC, MAP_PRIVATE | MAP_ANON, -1, 0);
+	if(code == MAP_FAILED)
+		return NULL;
+
+	jit = (m68ki_jit_state*)calloc(1, sizeof(m68ki_jit_state));
+	if(!jit)
+	{
+		munmap(code, code_size);
+		return NULL;
+	}
+
+	jit->code = (uint8*)code;
+	jit->size = code_size;
+	return jit;
+#else
+	(void)code_size;
+	return NULL;
+#endif /* M68KJIT_SUPPORTED */
+}
+
+void m68k_jit_destroy(void* jit)
+{
+#if M68KJIT_SUPPORTED
+	m68ki_jit_state* state = (m68ki_jit_state*)jit;
+
+	if(!state)
+		return;
+
+	munmap(state->code, state->size);
+	free(state);
+#else
+	(void)jit;
+#endif /* M68KJIT_SUPPORTED */
+}
+
+void m68k_set_jit(void* jit)
+{
+	CPU_JIT = jit;
+	m68ki_jit_flush();
+}
+
+unsigned int m68k_jit_blocks(void* jit)
+{
+	return jit ? ((m68ki_jit_state*)jit)->blocks : 0;
+}
+
+#else
+
+void* m68k_jit_create(unsigned int code_size)
+{
+	(void)code_size;
+	return NULL;
+}
+
+void m68k_jit_destroy(void* jit)
+{
+	(void)jit;
+}
+
+void m68k_set_jit(void* jit)
+{
+	(void)jit;
+}
+
+unsigned int m68k_jit_blocks(void* jit)
+{
+	(void)jit;
+	return 0;
+}
+
+#endif /* M68K_JIT */
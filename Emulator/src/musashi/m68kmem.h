@@ -0,0 +1,200 @@
+#ifndef M68KMEM__HEADER
+#define M68KMEM__HEADER
+
+/* ======================================================================== */
+/* ============================== MEMORY ACCESS =========================== */
+/* ======================================================================== */
+/*
+ * Access to the page table given to m68k_set_fast_memory() (see m68k.h.)
+ *
+ * With M68K_BUS_TIMING on, accesses are charged the bus cycles that the cycle
+ * tables leave out: those of a bus narrower than 16 bits, and wait states.
+ *
+ * With M68K_FAST_MEMORY on, pages of the address space that are backed by
+ * host memory are read and written right here, inlined into the op handlers;
+ * everything else goes out to m68k_read_memory_xx() and m68k_write_memory_xx()
+ * as usual.  Longword accesses that straddle two pages, and word accesses
+ * to odd addresses, also take the slow path.
+ *
+ * Instruction fetches (immediates and PC relative reads) also keep the host
+ * memory of the page they last came from, so fetching from the same page
+ * again doesn't even look at the page table.
+ *
+ * This is only included by m68kcpu.h.
+ */
+
+#define M68KI_FAST_PAGE_SIZE   (1 << M68K_FAST_PAGE_BITS)
+#define M68KI_FAST_NUM_PAGES   (1 << (M68K_FAST_ADDRESS_BITS - M68K_FAST_PAGE_BITS))
+
+#define m68ki_fast_page(A) \
+	(&CPU_FAST_MEMORY->pages[((A) >> M68K_FAST_PAGE_BITS) & (M68KI_FAST_NUM_PAGES - 1)])
+#define m68ki_fast_offset(A) ((A) & (M68KI_FAST_PAGE_SIZE - 1))
+
+#if M68K_BUS_TIMING
+/* Extra clocks taken by an access of the given number of bytes.  The cycle
+ * tables count one 4 clock bus cycle per word, without wait states. */
+INLINE uint m68ki_bus_cycles(uint address, uint size)
+{
+	uint bus_cycles = (size + CPU_BUS_WIDTH - 1) >> (CPU_BUS_WIDTH - 1);
+	uint counted = (size + 1) >> 1;
+
+	return (bus_cycles - counted) * 4 + bus_cycles * m68ki_fast_page(address)->wait_states;
+}
+
+INLINE void m68ki_bus_timing(uint address, uint size)
+{
+	if(CPU_BUS_WIDTH)
+		USE_CYCLES(m68ki_bus_cycles(address, size));
+}
+#else
+#define m68ki_bus_timing(A, SIZE)
+#endif /* M68K_BUS_TIMING */
+
+#if M68K_FAST_MEMORY
+/* Words in a page, in the layout selected by M68K_HOST_ORDER_WORDS.  Offsets
+ * of words must be even; odd ones take the slow path. */
+#if M68K_HOST_ORDER_WORDS
+#define m68ki_page_get_8(P, O)      ((P)[(O) ^ M68K_BYTE_XOR])
+#define m68ki_page_get_16(P, O)     (*(const uint16*)((P) + (O)))
+#define m68ki_page_set_8(P, O, V)   ((P)[(O) ^ M68K_BYTE_XOR] = (V))
+#define m68ki_page_set_16(P, O, V)  (*(uint16*)((P) + (O)) = (V))
+#else
+#define m68ki_page_get_8(P, O)      ((P)[O])
+#define m68ki_page_get_16(P, O)     (((P)[O] << 8) | (P)[(O) + 1])
+#define m68ki_page_set_8(P, O, V)   ((P)[O] = (V))
+#define m68ki_page_set_16(P, O, V)  ((P)[O] = (V) >> 8, (P)[(O) + 1] = (V))
+#endif /* M68K_HOST_ORDER_WORDS */
+
+INLINE uint m68ki_fast_read_8(uint address)
+{
+	const m68k_fast_page* page = m68ki_fast_page(address);
+
+	if(page->read)
+		return m68ki_page_get_8(page->read, m68ki_fast_offset(address));
+	return m68k_read_memory_8(address);
+}
+
+INLINE uint m68ki_fast_read_16(uint address)
+{
+	const m68k_fast_page* page = m68ki_fast_page(address);
+
+	if(page->read && !(address & 1))
+		return m68ki_page_get_16(page->read, m68ki_fast_offset(address));
+	return m68k_read_memory_16(address);
+}
+
+INLINE uint m68ki_fast_read_32(uint address)
+{
+	const m68k_fast_page* page = m68ki_fast_page(address);
+	uint offset = m68ki_fast_offset(address);
+
+	if(page->read && !(address & 1) && offset <= M68KI_FAST_PAGE_SIZE - 4)
+		return ((uint)m68ki_page_get_16(page->read, offset) << 16) | m68ki_page_get_16(page->read, offset + 2);
+	return m68k_read_memory_32(address);
+}
+
+INLINE void m68ki_fast_write_8(uint address, uint value)
+{
+	const m68k_fast_page* page = m68ki_fast_page(address);
+
+	if(page->write)
+	{
+		m68ki_page_set_8(page->write, m68ki_fast_offset(address), value);
+		CPU_FAST_MEMORY->writes++;
+		return;
+	}
+	m68k_write_memory_8(address, value);
+}
+
+INLINE void m68ki_fast_write_16(uint address, uint value)
+{
+	const m68k_fast_page* page = m68ki_fast_page(address);
+
+	if(page->write && !(address & 1))
+	{
+		m68ki_page_set_16(page->write, m68ki_fast_offset(address), value);
+		CPU_FAST_MEMORY->writes++;
+		return;
+	}
+	m68k_write_memory_16(address, value);
+}
+
+INLINE void m68ki_fast_write_32(uint address, uint value)
+{
+	const m68k_fast_page* page = m68ki_fast_page(address);
+	uint offset = m68ki_fast_offset(address);
+
+	if(page->write && !(address & 1) && offset <= M68KI_FAST_PAGE_SIZE - 4)
+	{
+		m68ki_page_set_16(page->write, offset, value >> 16);
+		m68ki_page_set_16(page->write, offset + 2, value);
+		CPU_FAST_MEMORY->writes++;
+		return;
+	}
+	m68k_write_memory_32(address, value);
+}
+
+/* Host memory of the page holding the given address, or NULL if it has to be
+ * read through the callbacks; only looked up when fetching from a new page. */
+INLINE const unsigned char* m68ki_fetch_window(uint address)
+{
+	uint page = address >> M68K_FAST_PAGE_BITS;
+
+	if(page != CPU_FETCH_PAGE)
+	{
+		CPU_FETCH_PAGE = page;
+		CPU_FETCH_BASE = m68ki_fast_page(address)->read;
+	}
+	return CPU_FETCH_BASE;
+}
+
+INLINE uint m68ki_fetch_8(uint address)
+{
+	const unsigned char* base;
+
+	m68ki_set_fc(FLAG_S | FUNCTION_CODE_USER_PROGRAM); /* auto-disable (see m68kcpu.h) */
+	m68ki_bus_timing(address, 1);
+	address = ADDRESS_68K(address);
+	base = m68ki_fetch_window(address);
+	if(base)
+		return m68ki_page_get_8(base, m68ki_fast_offset(address));
+	return m68k_read_memory_8(address);
+}
+
+INLINE uint m68ki_fetch_16(uint address)
+{
+	const unsigned char* base;
+
+	m68ki_set_fc(FLAG_S | FUNCTION_CODE_USER_PROGRAM); /* auto-disable (see m68kcpu.h) */
+	m68ki_check_address_error(address, MODE_READ, FLAG_S | FUNCTION_CODE_USER_PROGRAM); /* auto-disable (see m68kcpu.h) */
+	m68ki_bus_timing(address, 2);
+	address = ADDRESS_68K(address);
+	base = m68ki_fetch_window(address);
+	if(base && !(address & 1))
+		return m68ki_page_get_16(base, m68ki_fast_offset(address));
+	return m68k_read_memory_16(address);
+}
+
+INLINE uint m68ki_fetch_32(uint address)
+{
+	const unsigned char* base;
+	uint offset;
+
+	m68ki_set_fc(FLAG_S | FUNCTION_CODE_USER_PROGRAM); /* auto-disable (see m68kcpu.h) */
+	m68ki_check_address_error(address, MODE_READ, FLAG_S | FUNCTION_CODE_USER_PROGRAM); /* auto-disable (see m68kcpu.h) */
+	m68ki_bus_timing(address, 4);
+	address = ADDRESS_68K(address);
+	base = m68ki_fetch_window(address);
+	offset = m68ki_fast_offset(address);
+	if(base && !(address & 1) && offset <= M68KI_FAST_PAGE_SIZE - 4)
+		return ((uint)m68ki_page_get_16(base, offset) << 16) | m68ki_page_get_16(base, offset + 2);
+	return m68k_read_memory_32(address);
+}
+#endif /* M68K_FAST_MEMORY */
+
+
+/* ======================================================================== */
+/* ============================== END OF FILE ============================= */
+/* ======================================================================== */
+
+#endif /* M68KMEM__HEADER */
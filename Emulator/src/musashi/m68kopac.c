@@ -19,6 +19,7 @@ void m68k_op_1111(void)
 
 void m68k_op_abcd_8_rr(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = DY;
 	uint dst = *r_dst;
@@ -45,6 +46,7 @@ void m68k_op_abcd_8_rr(void)
 
 void m68k_op_abcd_8_mm_ax7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PD_8();
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -71,6 +73,7 @@ void m68k_op_abcd_8_mm_ax7(void)
 
 void m68k_op_abcd_8_mm_ay7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_A7_PD_8();
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -97,6 +100,7 @@ void m68k_op_abcd_8_mm_ay7(void)
 
 void m68k_op_abcd_8_mm_axy7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_A7_PD_8();
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -123,6 +127,7 @@ void m68k_op_abcd_8_mm_axy7(void)
 
 void m68k_op_abcd_8_mm(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PD_8();
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -155,8 +160,7 @@ void m68k_op_add_8_er_d(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -171,8 +175,7 @@ void m68k_op_add_8_er_ai(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -187,8 +190,7 @@ void m68k_op_add_8_er_pi(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -203,8 +205,7 @@ void m68k_op_add_8_er_pi7(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -219,8 +220,7 @@ void m68k_op_add_8_er_pd(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -235,8 +235,7 @@ void m68k_op_add_8_er_pd7(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -251,8 +250,7 @@ void m68k_op_add_8_er_di(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -267,8 +265,7 @@ void m68k_op_add_8_er_ix(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -283,8 +280,7 @@ void m68k_op_add_8_er_aw(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -299,8 +295,7 @@ void m68k_op_add_8_er_al(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -315,8 +310,7 @@ void m68k_op_add_8_er_pcdi(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -331,8 +325,7 @@ void m68k_op_add_8_er_pcix(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -347,8 +340,7 @@ void m68k_op_add_8_er_i(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -363,8 +355,7 @@ void m68k_op_add_16_er_d(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -379,8 +370,7 @@ void m68k_op_add_16_er_a(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -395,8 +385,7 @@ void m68k_op_add_16_er_ai(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -411,8 +400,7 @@ void m68k_op_add_16_er_pi(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -427,8 +415,7 @@ void m68k_op_add_16_er_pd(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -443,8 +430,7 @@ void m68k_op_add_16_er_di(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -459,8 +445,7 @@ void m68k_op_add_16_er_ix(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -475,8 +460,7 @@ void m68k_op_add_16_er_aw(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -491,8 +475,7 @@ void m68k_op_add_16_er_al(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -507,8 +490,7 @@ void m68k_op_add_16_er_pcdi(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -523,8 +505,7 @@ void m68k_op_add_16_er_pcix(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -539,8 +520,7 @@ void m68k_op_add_16_er_i(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -555,8 +535,7 @@ void m68k_op_add_32_er_d(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -571,8 +550,7 @@ void m68k_op_add_32_er_a(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -587,8 +565,7 @@ void m68k_op_add_32_er_ai(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -603,8 +580,7 @@ void m68k_op_add_32_er_pi(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -619,8 +595,7 @@ void m68k_op_add_32_er_pd(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -635,8 +610,7 @@ void m68k_op_add_32_er_di(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -651,8 +625,7 @@ void m68k_op_add_32_er_ix(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -667,8 +640,7 @@ void m68k_op_add_32_er_aw(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -683,8 +655,7 @@ void m68k_op_add_32_er_al(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -699,8 +670,7 @@ void m68k_op_add_32_er_pcdi(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -715,8 +685,7 @@ void m68k_op_add_32_er_pcix(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -731,8 +700,7 @@ void m68k_op_add_32_er_i(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -747,8 +715,7 @@ void m68k_op_add_8_re_ai(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -763,8 +730,7 @@ void m68k_op_add_8_re_pi(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -779,8 +745,7 @@ void m68k_op_add_8_re_pi7(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -795,8 +760,7 @@ void m68k_op_add_8_re_pd(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -811,8 +775,7 @@ void m68k_op_add_8_re_pd7(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -827,8 +790,7 @@ void m68k_op_add_8_re_di(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -843,8 +805,7 @@ void m68k_op_add_8_re_ix(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -859,8 +820,7 @@ void m68k_op_add_8_re_aw(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -875,8 +835,7 @@ void m68k_op_add_8_re_al(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -891,8 +850,7 @@ void m68k_op_add_16_re_ai(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -907,8 +865,7 @@ void m68k_op_add_16_re_pi(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -923,8 +880,7 @@ void m68k_op_add_16_re_pd(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -939,8 +895,7 @@ void m68k_op_add_16_re_di(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -955,8 +910,7 @@ void m68k_op_add_16_re_ix(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -971,8 +925,7 @@ void m68k_op_add_16_re_aw(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -987,8 +940,7 @@ void m68k_op_add_16_re_al(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -1003,8 +955,7 @@ void m68k_op_add_32_re_ai(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1019,8 +970,7 @@ void m68k_op_add_32_re_pi(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1035,8 +985,7 @@ void m68k_op_add_32_re_pd(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1051,8 +1000,7 @@ void m68k_op_add_32_re_di(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1067,8 +1015,7 @@ void m68k_op_add_32_re_ix(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1083,8 +1030,7 @@ void m68k_op_add_32_re_aw(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1099,8 +1045,7 @@ void m68k_op_add_32_re_al(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1327,8 +1272,7 @@ void m68k_op_addi_8_d(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -1343,8 +1287,7 @@ void m68k_op_addi_8_ai(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1359,8 +1302,7 @@ void m68k_op_addi_8_pi(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1375,8 +1317,7 @@ void m68k_op_addi_8_pi7(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1391,8 +1332,7 @@ void m68k_op_addi_8_pd(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1407,8 +1347,7 @@ void m68k_op_addi_8_pd7(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1423,8 +1362,7 @@ void m68k_op_addi_8_di(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1439,8 +1377,7 @@ void m68k_op_addi_8_ix(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1455,8 +1392,7 @@ void m68k_op_addi_8_aw(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1471,8 +1407,7 @@ void m68k_op_addi_8_al(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1487,8 +1422,7 @@ void m68k_op_addi_16_d(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -1503,8 +1437,7 @@ void m68k_op_addi_16_ai(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -1519,8 +1452,7 @@ void m68k_op_addi_16_pi(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -1535,8 +1467,7 @@ void m68k_op_addi_16_pd(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -1551,8 +1482,7 @@ void m68k_op_addi_16_di(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -1567,8 +1497,7 @@ void m68k_op_addi_16_ix(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -1583,8 +1512,7 @@ void m68k_op_addi_16_aw(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -1599,8 +1527,7 @@ void m68k_op_addi_16_al(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -1615,8 +1542,7 @@ void m68k_op_addi_32_d(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -1631,8 +1557,7 @@ void m68k_op_addi_32_ai(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1647,8 +1572,7 @@ void m68k_op_addi_32_pi(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1663,8 +1587,7 @@ void m68k_op_addi_32_pd(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1679,8 +1602,7 @@ void m68k_op_addi_32_di(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1695,8 +1617,7 @@ void m68k_op_addi_32_ix(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1711,8 +1632,7 @@ void m68k_op_addi_32_aw(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1727,8 +1647,7 @@ void m68k_op_addi_32_al(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -1743,8 +1662,7 @@ void m68k_op_addq_8_d(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -1759,8 +1677,7 @@ void m68k_op_addq_8_ai(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1775,8 +1692,7 @@ void m68k_op_addq_8_pi(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1791,8 +1707,7 @@ void m68k_op_addq_8_pi7(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1807,8 +1722,7 @@ void m68k_op_addq_8_pd(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1823,8 +1737,7 @@ void m68k_op_addq_8_pd7(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1839,8 +1752,7 @@ void m68k_op_addq_8_di(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1855,8 +1767,7 @@ void m68k_op_addq_8_ix(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1871,8 +1782,7 @@ void m68k_op_addq_8_aw(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1887,8 +1797,7 @@ void m68k_op_addq_8_al(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_V = VFLAG_ADD_8(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
+	m68ki_lazy_add_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -1903,8 +1812,7 @@ void m68k_op_addq_16_d(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -1927,8 +1835,7 @@ void m68k_op_addq_16_ai(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -1943,8 +1850,7 @@ void m68k_op_addq_16_pi(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -1959,8 +1865,7 @@ void m68k_op_addq_16_pd(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -1975,8 +1880,7 @@ void m68k_op_addq_16_di(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -1991,8 +1895,7 @@ void m68k_op_addq_16_ix(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -2007,8 +1910,7 @@ void m68k_op_addq_16_aw(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -2023,8 +1925,7 @@ void m68k_op_addq_16_al(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_V = VFLAG_ADD_16(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
+	m68ki_lazy_add_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -2039,8 +1940,7 @@ void m68k_op_addq_32_d(void)
 	uint res = src + dst;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -2064,8 +1964,7 @@ void m68k_op_addq_32_ai(void)
 
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -2081,8 +1980,7 @@ void m68k_op_addq_32_pi(void)
 
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -2098,8 +1996,7 @@ void m68k_op_addq_32_pd(void)
 
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -2115,8 +2012,7 @@ void m68k_op_addq_32_di(void)
 
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -2132,8 +2028,7 @@ void m68k_op_addq_32_ix(void)
 
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -2149,8 +2044,7 @@ void m68k_op_addq_32_aw(void)
 
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -2166,8 +2060,7 @@ void m68k_op_addq_32_al(void)
 
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_ADD_32(src, dst, res);
-	FLAG_X = FLAG_C = CFLAG_ADD_32(src, dst, res);
+	m68ki_lazy_add_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	m68ki_write_32(ea, FLAG_Z);
@@ -2176,6 +2069,7 @@ void m68k_op_addq_32_al(void)
 
 void m68k_op_addx_8_rr(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_8(DY);
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
@@ -2194,6 +2088,7 @@ void m68k_op_addx_8_rr(void)
 
 void m68k_op_addx_16_rr(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_16(DY);
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
@@ -2212,6 +2107,7 @@ void m68k_op_addx_16_rr(void)
 
 void m68k_op_addx_32_rr(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = DY;
 	uint dst = *r_dst;
@@ -2230,6 +2126,7 @@ void m68k_op_addx_32_rr(void)
 
 void m68k_op_addx_8_mm_ax7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PD_8();
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -2248,6 +2145,7 @@ void m68k_op_addx_8_mm_ax7(void)
 
 void m68k_op_addx_8_mm_ay7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_A7_PD_8();
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -2266,6 +2164,7 @@ void m68k_op_addx_8_mm_ay7(void)
 
 void m68k_op_addx_8_mm_axy7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_A7_PD_8();
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -2284,6 +2183,7 @@ void m68k_op_addx_8_mm_axy7(void)
 
 void m68k_op_addx_8_mm(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PD_8();
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -2302,6 +2202,7 @@ void m68k_op_addx_8_mm(void)
 
 void m68k_op_addx_16_mm(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PD_16();
 	uint ea  = EA_AX_PD_16();
 	uint dst = m68ki_read_16(ea);
@@ -2320,6 +2221,7 @@ void m68k_op_addx_16_mm(void)
 
 void m68k_op_addx_32_mm(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PD_32();
 	uint ea  = EA_AX_PD_32();
 	uint dst = m68ki_read_32(ea);
@@ -2341,8 +2243,7 @@ void m68k_op_and_8_er_d(void)
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (DY | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2351,8 +2252,7 @@ void m68k_op_and_8_er_ai(void)
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_AI_8() | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2361,8 +2261,7 @@ void m68k_op_and_8_er_pi(void)
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_PI_8() | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2371,8 +2270,7 @@ void m68k_op_and_8_er_pi7(void)
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_A7_PI_8() | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2381,8 +2279,7 @@ void m68k_op_and_8_er_pd(void)
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_PD_8() | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2391,8 +2288,7 @@ void m68k_op_and_8_er_pd7(void)
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_A7_PD_8() | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2401,8 +2297,7 @@ void m68k_op_and_8_er_di(void)
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_DI_8() | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2411,8 +2306,7 @@ void m68k_op_and_8_er_ix(void)
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AY_IX_8() | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2421,8 +2315,7 @@ void m68k_op_and_8_er_aw(void)
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AW_8() | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2431,8 +2324,7 @@ void m68k_op_and_8_er_al(void)
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_AL_8() | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2441,8 +2333,7 @@ void m68k_op_and_8_er_pcdi(void)
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_PCDI_8() | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2451,8 +2342,7 @@ void m68k_op_and_8_er_pcix(void)
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_PCIX_8() | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2461,8 +2351,7 @@ void m68k_op_and_8_er_i(void)
 	FLAG_Z = MASK_OUT_ABOVE_8(DX &= (OPER_I_8() | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2471,8 +2360,7 @@ void m68k_op_and_16_er_d(void)
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (DY | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2481,8 +2369,7 @@ void m68k_op_and_16_er_ai(void)
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_AI_16() | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2491,8 +2378,7 @@ void m68k_op_and_16_er_pi(void)
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_PI_16() | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2501,8 +2387,7 @@ void m68k_op_and_16_er_pd(void)
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_PD_16() | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2511,8 +2396,7 @@ void m68k_op_and_16_er_di(void)
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_DI_16() | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2521,8 +2405,7 @@ void m68k_op_and_16_er_ix(void)
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AY_IX_16() | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2531,8 +2414,7 @@ void m68k_op_and_16_er_aw(void)
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AW_16() | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2541,8 +2423,7 @@ void m68k_op_and_16_er_al(void)
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_AL_16() | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2551,8 +2432,7 @@ void m68k_op_and_16_er_pcdi(void)
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_PCDI_16() | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2561,8 +2441,7 @@ void m68k_op_and_16_er_pcix(void)
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_PCIX_16() | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2571,8 +2450,7 @@ void m68k_op_and_16_er_i(void)
 	FLAG_Z = MASK_OUT_ABOVE_16(DX &= (OPER_I_16() | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2581,8 +2459,7 @@ void m68k_op_and_32_er_d(void)
 	FLAG_Z = DX &= DY;
 
 	FLAG_N = NFLAG_32(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2591,8 +2468,7 @@ void m68k_op_and_32_er_ai(void)
 	FLAG_Z = DX &= OPER_AY_AI_32();
 
 	FLAG_N = NFLAG_32(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2601,8 +2477,7 @@ void m68k_op_and_32_er_pi(void)
 	FLAG_Z = DX &= OPER_AY_PI_32();
 
 	FLAG_N = NFLAG_32(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2611,8 +2486,7 @@ void m68k_op_and_32_er_pd(void)
 	FLAG_Z = DX &= OPER_AY_PD_32();
 
 	FLAG_N = NFLAG_32(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2621,8 +2495,7 @@ void m68k_op_and_32_er_di(void)
 	FLAG_Z = DX &= OPER_AY_DI_32();
 
 	FLAG_N = NFLAG_32(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2631,8 +2504,7 @@ void m68k_op_and_32_er_ix(void)
 	FLAG_Z = DX &= OPER_AY_IX_32();
 
 	FLAG_N = NFLAG_32(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2641,8 +2513,7 @@ void m68k_op_and_32_er_aw(void)
 	FLAG_Z = DX &= OPER_AW_32();
 
 	FLAG_N = NFLAG_32(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2651,8 +2522,7 @@ void m68k_op_and_32_er_al(void)
 	FLAG_Z = DX &= OPER_AL_32();
 
 	FLAG_N = NFLAG_32(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2661,8 +2531,7 @@ void m68k_op_and_32_er_pcdi(void)
 	FLAG_Z = DX &= OPER_PCDI_32();
 
 	FLAG_N = NFLAG_32(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2671,8 +2540,7 @@ void m68k_op_and_32_er_pcix(void)
 	FLAG_Z = DX &= OPER_PCIX_32();
 
 	FLAG_N = NFLAG_32(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2681,8 +2549,7 @@ void m68k_op_and_32_er_i(void)
 	FLAG_Z = DX &= OPER_I_32();
 
 	FLAG_N = NFLAG_32(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2692,8 +2559,7 @@ void m68k_op_and_8_re_ai(void)
 	uint res = DX & m68ki_read_8(ea);
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -2706,8 +2572,7 @@ void m68k_op_and_8_re_pi(void)
 	uint res = DX & m68ki_read_8(ea);
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -2720,8 +2585,7 @@ void m68k_op_and_8_re_pi7(void)
 	uint res = DX & m68ki_read_8(ea);
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -2734,8 +2598,7 @@ void m68k_op_and_8_re_pd(void)
 	uint res = DX & m68ki_read_8(ea);
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -2748,8 +2611,7 @@ void m68k_op_and_8_re_pd7(void)
 	uint res = DX & m68ki_read_8(ea);
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -2762,8 +2624,7 @@ void m68k_op_and_8_re_di(void)
 	uint res = DX & m68ki_read_8(ea);
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -2776,8 +2637,7 @@ void m68k_op_and_8_re_ix(void)
 	uint res = DX & m68ki_read_8(ea);
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -2790,8 +2650,7 @@ void m68k_op_and_8_re_aw(void)
 	uint res = DX & m68ki_read_8(ea);
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -2804,8 +2663,7 @@ void m68k_op_and_8_re_al(void)
 	uint res = DX & m68ki_read_8(ea);
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	m68ki_write_8(ea, FLAG_Z);
@@ -2818,8 +2676,7 @@ void m68k_op_and_16_re_ai(void)
 	uint res = DX & m68ki_read_16(ea);
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -2832,8 +2689,7 @@ void m68k_op_and_16_re_pi(void)
 	uint res = DX & m68ki_read_16(ea);
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -2846,8 +2702,7 @@ void m68k_op_and_16_re_pd(void)
 	uint res = DX & m68ki_read_16(ea);
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -2860,8 +2715,7 @@ void m68k_op_and_16_re_di(void)
 	uint res = DX & m68ki_read_16(ea);
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -2874,8 +2728,7 @@ void m68k_op_and_16_re_ix(void)
 	uint res = DX & m68ki_read_16(ea);
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -2888,8 +2741,7 @@ void m68k_op_and_16_re_aw(void)
 	uint res = DX & m68ki_read_16(ea);
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -2902,8 +2754,7 @@ void m68k_op_and_16_re_al(void)
 	uint res = DX & m68ki_read_16(ea);
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	m68ki_write_16(ea, FLAG_Z);
@@ -2917,8 +2768,7 @@ void m68k_op_and_32_re_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_32(ea, res);
 }
@@ -2931,8 +2781,7 @@ void m68k_op_and_32_re_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_32(ea, res);
 }
@@ -2945,8 +2794,7 @@ void m68k_op_and_32_re_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_32(ea, res);
 }
@@ -2959,8 +2807,7 @@ void m68k_op_and_32_re_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_32(ea, res);
 }
@@ -2973,8 +2820,7 @@ void m68k_op_and_32_re_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_32(ea, res);
 }
@@ -2987,8 +2833,7 @@ void m68k_op_and_32_re_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_32(ea, res);
 }
@@ -3001,8 +2846,7 @@ void m68k_op_and_32_re_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_32(ea, res);
 }
@@ -3013,8 +2857,7 @@ void m68k_op_andi_8_d(void)
 	FLAG_Z = MASK_OUT_ABOVE_8(DY &= (OPER_I_8() | 0xffffff00));
 
 	FLAG_N = NFLAG_8(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3026,8 +2869,7 @@ void m68k_op_andi_8_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_8(ea, res);
 }
@@ -3041,8 +2883,7 @@ void m68k_op_andi_8_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_8(ea, res);
 }
@@ -3056,8 +2897,7 @@ void m68k_op_andi_8_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_8(ea, res);
 }
@@ -3071,8 +2911,7 @@ void m68k_op_andi_8_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_8(ea, res);
 }
@@ -3086,8 +2925,7 @@ void m68k_op_andi_8_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_8(ea, res);
 }
@@ -3101,8 +2939,7 @@ void m68k_op_andi_8_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_8(ea, res);
 }
@@ -3116,8 +2953,7 @@ void m68k_op_andi_8_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_8(ea, res);
 }
@@ -3131,8 +2967,7 @@ void m68k_op_andi_8_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_8(ea, res);
 }
@@ -3146,8 +2981,7 @@ void m68k_op_andi_8_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_8(ea, res);
 }
@@ -3158,8 +2992,7 @@ void m68k_op_andi_16_d(void)
 	FLAG_Z = MASK_OUT_ABOVE_16(DY &= (OPER_I_16() | 0xffff0000));
 
 	FLAG_N = NFLAG_16(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3171,8 +3004,7 @@ void m68k_op_andi_16_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_16(ea, res);
 }
@@ -3186,8 +3018,7 @@ void m68k_op_andi_16_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_16(ea, res);
 }
@@ -3201,8 +3032,7 @@ void m68k_op_andi_16_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_16(ea, res);
 }
@@ -3216,8 +3046,7 @@ void m68k_op_andi_16_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_16(ea, res);
 }
@@ -3231,8 +3060,7 @@ void m68k_op_andi_16_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_16(ea, res);
 }
@@ -3246,8 +3074,7 @@ void m68k_op_andi_16_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_16(ea, res);
 }
@@ -3261,8 +3088,7 @@ void m68k_op_andi_16_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_16(ea, res);
 }
@@ -3273,8 +3099,7 @@ void m68k_op_andi_32_d(void)
 	FLAG_Z = DY &= (OPER_I_32());
 
 	FLAG_N = NFLAG_32(FLAG_Z);
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3286,8 +3111,7 @@ void m68k_op_andi_32_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_32(ea, res);
 }
@@ -3301,8 +3125,7 @@ void m68k_op_andi_32_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_32(ea, res);
 }
@@ -3316,8 +3139,7 @@ void m68k_op_andi_32_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_32(ea, res);
 }
@@ -3331,8 +3153,7 @@ void m68k_op_andi_32_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_32(ea, res);
 }
@@ -3346,8 +3167,7 @@ void m68k_op_andi_32_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_32(ea, res);
 }
@@ -3361,8 +3181,7 @@ void m68k_op_andi_32_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_32(ea, res);
 }
@@ -3376,8 +3195,7 @@ void m68k_op_andi_32_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 
 	m68ki_write_32(ea, res);
 }
@@ -3385,12 +3203,14 @@ void m68k_op_andi_32_al(void)
 
 void m68k_op_andi_8_toc(void)
 {
+	m68ki_sync_flags();
 	m68ki_set_ccr(m68ki_get_ccr() & OPER_I_8());
 }
 
 
 void m68k_op_andi_16_tos(void)
 {
+	m68ki_sync_flags();
 	if(FLAG_S)
 	{
 		uint src = OPER_I_16();
@@ -3404,6 +3224,7 @@ void m68k_op_andi_16_tos(void)
 
 void m68k_op_asr_8_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = MASK_OUT_ABOVE_8(*r_dst);
@@ -3423,6 +3244,7 @@ void m68k_op_asr_8_s(void)
 
 void m68k_op_asr_16_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = MASK_OUT_ABOVE_16(*r_dst);
@@ -3442,6 +3264,7 @@ void m68k_op_asr_16_s(void)
 
 void m68k_op_asr_32_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = *r_dst;
@@ -3461,6 +3284,7 @@ void m68k_op_asr_32_s(void)
 
 void m68k_op_asr_8_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
 	uint src = MASK_OUT_ABOVE_8(*r_dst);
@@ -3513,6 +3337,7 @@ void m68k_op_asr_8_r(void)
 
 void m68k_op_asr_16_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
 	uint src = MASK_OUT_ABOVE_16(*r_dst);
@@ -3565,6 +3390,7 @@ void m68k_op_asr_16_r(void)
 
 void m68k_op_asr_32_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
 	uint src = *r_dst;
@@ -3617,6 +3443,7 @@ void m68k_op_asr_32_r(void)
 
 void m68k_op_asr_16_ai(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = src >> 1;
@@ -3635,6 +3462,7 @@ void m68k_op_asr_16_ai(void)
 
 void m68k_op_asr_16_pi(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = src >> 1;
@@ -3653,6 +3481,7 @@ void m68k_op_asr_16_pi(void)
 
 void m68k_op_asr_16_pd(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
 	uint res = src >> 1;
@@ -3671,6 +3500,7 @@ void m68k_op_asr_16_pd(void)
 
 void m68k_op_asr_16_di(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = src >> 1;
@@ -3689,6 +3519,7 @@ void m68k_op_asr_16_di(void)
 
 void m68k_op_asr_16_ix(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
 	uint res = src >> 1;
@@ -3707,6 +3538,7 @@ void m68k_op_asr_16_ix(void)
 
 void m68k_op_asr_16_aw(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
 	uint res = src >> 1;
@@ -3725,6 +3557,7 @@ void m68k_op_asr_16_aw(void)
 
 void m68k_op_asr_16_al(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
 	uint res = src >> 1;
@@ -3743,6 +3576,7 @@ void m68k_op_asr_16_al(void)
 
 void m68k_op_asl_8_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = MASK_OUT_ABOVE_8(*r_dst);
@@ -3760,6 +3594,7 @@ void m68k_op_asl_8_s(void)
 
 void m68k_op_asl_16_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = MASK_OUT_ABOVE_16(*r_dst);
@@ -3777,6 +3612,7 @@ void m68k_op_asl_16_s(void)
 
 void m68k_op_asl_32_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = *r_dst;
@@ -3794,6 +3630,7 @@ void m68k_op_asl_32_s(void)
 
 void m68k_op_asl_8_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
 	uint src = MASK_OUT_ABOVE_8(*r_dst);
@@ -3831,6 +3668,7 @@ void m68k_op_asl_8_r(void)
 
 void m68k_op_asl_16_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
 	uint src = MASK_OUT_ABOVE_16(*r_dst);
@@ -3868,6 +3706,7 @@ void m68k_op_asl_16_r(void)
 
 void m68k_op_asl_32_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
 	uint src = *r_dst;
@@ -3905,6 +3744,7 @@ void m68k_op_asl_32_r(void)
 
 void m68k_op_asl_16_ai(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(src << 1);
@@ -3921,6 +3761,7 @@ void m68k_op_asl_16_ai(void)
 
 void m68k_op_asl_16_pi(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(src << 1);
@@ -3937,6 +3778,7 @@ void m68k_op_asl_16_pi(void)
 
 void m68k_op_asl_16_pd(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(src << 1);
@@ -3953,6 +3795,7 @@ void m68k_op_asl_16_pd(void)
 
 void m68k_op_asl_16_di(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(src << 1);
@@ -3969,6 +3812,7 @@ void m68k_op_asl_16_di(void)
 
 void m68k_op_asl_16_ix(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(src << 1);
@@ -3985,6 +3829,7 @@ void m68k_op_asl_16_ix(void)
 
 void m68k_op_asl_16_aw(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(src << 1);
@@ -4001,6 +3846,7 @@ void m68k_op_asl_16_aw(void)
 
 void m68k_op_asl_16_al(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(src << 1);
@@ -4017,6 +3863,7 @@ void m68k_op_asl_16_al(void)
 
 void m68k_op_bhi_8(void)
 {
+	m68ki_sync_flags();
 	if(COND_HI())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4029,6 +3876,7 @@ void m68k_op_bhi_8(void)
 
 void m68k_op_bls_8(void)
 {
+	m68ki_sync_flags();
 	if(COND_LS())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4041,6 +3889,7 @@ void m68k_op_bls_8(void)
 
 void m68k_op_bcc_8(void)
 {
+	m68ki_sync_flags();
 	if(COND_CC())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4053,6 +3902,7 @@ void m68k_op_bcc_8(void)
 
 void m68k_op_bcs_8(void)
 {
+	m68ki_sync_flags();
 	if(COND_CS())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4089,6 +3939,7 @@ void m68k_op_beq_8(void)
 
 void m68k_op_bvc_8(void)
 {
+	m68ki_sync_flags();
 	if(COND_VC())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4101,6 +3952,7 @@ void m68k_op_bvc_8(void)
 
 void m68k_op_bvs_8(void)
 {
+	m68ki_sync_flags();
 	if(COND_VS())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4137,6 +3989,7 @@ void m68k_op_bmi_8(void)
 
 void m68k_op_bge_8(void)
 {
+	m68ki_sync_flags();
 	if(COND_GE())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4149,6 +4002,7 @@ void m68k_op_bge_8(void)
 
 void m68k_op_blt_8(void)
 {
+	m68ki_sync_flags();
 	if(COND_LT())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4161,6 +4015,7 @@ void m68k_op_blt_8(void)
 
 void m68k_op_bgt_8(void)
 {
+	m68ki_sync_flags();
 	if(COND_GT())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4173,6 +4028,7 @@ void m68k_op_bgt_8(void)
 
 void m68k_op_ble_8(void)
 {
+	m68ki_sync_flags();
 	if(COND_LE())
 	{
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
@@ -4185,6 +4041,7 @@ void m68k_op_ble_8(void)
 
 void m68k_op_bhi_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_HI())
 	{
 		uint offset = OPER_I_16();
@@ -4200,6 +4057,7 @@ void m68k_op_bhi_16(void)
 
 void m68k_op_bls_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_LS())
 	{
 		uint offset = OPER_I_16();
@@ -4215,6 +4073,7 @@ void m68k_op_bls_16(void)
 
 void m68k_op_bcc_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_CC())
 	{
 		uint offset = OPER_I_16();
@@ -4230,6 +4089,7 @@ void m68k_op_bcc_16(void)
 
 void m68k_op_bcs_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_CS())
 	{
 		uint offset = OPER_I_16();
@@ -4275,6 +4135,7 @@ void m68k_op_beq_16(void)
 
 void m68k_op_bvc_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_VC())
 	{
 		uint offset = OPER_I_16();
@@ -4290,6 +4151,7 @@ void m68k_op_bvc_16(void)
 
 void m68k_op_bvs_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_VS())
 	{
 		uint offset = OPER_I_16();
@@ -4335,6 +4197,7 @@ void m68k_op_bmi_16(void)
 
 void m68k_op_bge_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_GE())
 	{
 		uint offset = OPER_I_16();
@@ -4350,6 +4213,7 @@ void m68k_op_bge_16(void)
 
 void m68k_op_blt_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_LT())
 	{
 		uint offset = OPER_I_16();
@@ -4365,6 +4229,7 @@ void m68k_op_blt_16(void)
 
 void m68k_op_bgt_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_GT())
 	{
 		uint offset = OPER_I_16();
@@ -4380,6 +4245,7 @@ void m68k_op_bgt_16(void)
 
 void m68k_op_ble_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_LE())
 	{
 		uint offset = OPER_I_16();
@@ -4395,6 +4261,7 @@ void m68k_op_ble_16(void)
 
 void m68k_op_bhi_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_HI())
@@ -4414,6 +4281,7 @@ void m68k_op_bhi_32(void)
 
 void m68k_op_bls_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_LS())
@@ -4433,6 +4301,7 @@ void m68k_op_bls_32(void)
 
 void m68k_op_bcc_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_CC())
@@ -4452,6 +4321,7 @@ void m68k_op_bcc_32(void)
 
 void m68k_op_bcs_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_CS())
@@ -4509,6 +4379,7 @@ void m68k_op_beq_32(void)
 
 void m68k_op_bvc_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_VC())
@@ -4528,6 +4399,7 @@ void m68k_op_bvc_32(void)
 
 void m68k_op_bvs_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_VS())
@@ -4585,6 +4457,7 @@ void m68k_op_bmi_32(void)
 
 void m68k_op_bge_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_GE())
@@ -4604,6 +4477,7 @@ void m68k_op_bge_32(void)
 
 void m68k_op_blt_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_LT())
@@ -4623,6 +4497,7 @@ void m68k_op_blt_32(void)
 
 void m68k_op_bgt_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_GT())
@@ -4642,6 +4517,7 @@ void m68k_op_bgt_32(void)
 
 void m68k_op_ble_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_LE())
@@ -5097,6 +4973,7 @@ void m68k_op_bclr_8_s_al(void)
 
 void m68k_op_bfchg_32_d(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5132,6 +5009,7 @@ void m68k_op_bfchg_32_d(void)
 
 void m68k_op_bfchg_32_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5186,6 +5064,7 @@ void m68k_op_bfchg_32_ai(void)
 
 void m68k_op_bfchg_32_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5240,6 +5119,7 @@ void m68k_op_bfchg_32_di(void)
 
 void m68k_op_bfchg_32_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5294,6 +5174,7 @@ void m68k_op_bfchg_32_ix(void)
 
 void m68k_op_bfchg_32_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5348,6 +5229,7 @@ void m68k_op_bfchg_32_aw(void)
 
 void m68k_op_bfchg_32_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5402,6 +5284,7 @@ void m68k_op_bfchg_32_al(void)
 
 void m68k_op_bfclr_32_d(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5439,6 +5322,7 @@ void m68k_op_bfclr_32_d(void)
 
 void m68k_op_bfclr_32_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5493,6 +5377,7 @@ void m68k_op_bfclr_32_ai(void)
 
 void m68k_op_bfclr_32_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5547,6 +5432,7 @@ void m68k_op_bfclr_32_di(void)
 
 void m68k_op_bfclr_32_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5601,6 +5487,7 @@ void m68k_op_bfclr_32_ix(void)
 
 void m68k_op_bfclr_32_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5655,6 +5542,7 @@ void m68k_op_bfclr_32_aw(void)
 
 void m68k_op_bfclr_32_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5709,6 +5597,7 @@ void m68k_op_bfclr_32_al(void)
 
 void m68k_op_bfexts_32_d(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5743,6 +5632,7 @@ void m68k_op_bfexts_32_d(void)
 
 void m68k_op_bfexts_32_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5791,6 +5681,7 @@ void m68k_op_bfexts_32_ai(void)
 
 void m68k_op_bfexts_32_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5839,6 +5730,7 @@ void m68k_op_bfexts_32_di(void)
 
 void m68k_op_bfexts_32_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5887,6 +5779,7 @@ void m68k_op_bfexts_32_ix(void)
 
 void m68k_op_bfexts_32_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5935,6 +5828,7 @@ void m68k_op_bfexts_32_aw(void)
 
 void m68k_op_bfexts_32_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -5983,6 +5877,7 @@ void m68k_op_bfexts_32_al(void)
 
 void m68k_op_bfexts_32_pcdi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6031,6 +5926,7 @@ void m68k_op_bfexts_32_pcdi(void)
 
 void m68k_op_bfexts_32_pcix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6079,6 +5975,7 @@ void m68k_op_bfexts_32_pcix(void)
 
 void m68k_op_bfextu_32_d(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6113,6 +6010,7 @@ void m68k_op_bfextu_32_d(void)
 
 void m68k_op_bfextu_32_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6160,6 +6058,7 @@ void m68k_op_bfextu_32_ai(void)
 
 void m68k_op_bfextu_32_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6207,6 +6106,7 @@ void m68k_op_bfextu_32_di(void)
 
 void m68k_op_bfextu_32_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6254,6 +6154,7 @@ void m68k_op_bfextu_32_ix(void)
 
 void m68k_op_bfextu_32_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6301,6 +6202,7 @@ void m68k_op_bfextu_32_aw(void)
 
 void m68k_op_bfextu_32_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6348,6 +6250,7 @@ void m68k_op_bfextu_32_al(void)
 
 void m68k_op_bfextu_32_pcdi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6395,6 +6298,7 @@ void m68k_op_bfextu_32_pcdi(void)
 
 void m68k_op_bfextu_32_pcix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6442,6 +6346,7 @@ void m68k_op_bfextu_32_pcix(void)
 
 void m68k_op_bfffo_32_d(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6480,6 +6385,7 @@ void m68k_op_bfffo_32_d(void)
 
 void m68k_op_bfffo_32_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6532,6 +6438,7 @@ void m68k_op_bfffo_32_ai(void)
 
 void m68k_op_bfffo_32_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6584,6 +6491,7 @@ void m68k_op_bfffo_32_di(void)
 
 void m68k_op_bfffo_32_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6636,6 +6544,7 @@ void m68k_op_bfffo_32_ix(void)
 
 void m68k_op_bfffo_32_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6688,6 +6597,7 @@ void m68k_op_bfffo_32_aw(void)
 
 void m68k_op_bfffo_32_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6740,6 +6650,7 @@ void m68k_op_bfffo_32_al(void)
 
 void m68k_op_bfffo_32_pcdi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6792,6 +6703,7 @@ void m68k_op_bfffo_32_pcdi(void)
 
 void m68k_op_bfffo_32_pcix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6844,6 +6756,7 @@ void m68k_op_bfffo_32_pcix(void)
 
 void m68k_op_bfins_32_d(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6886,6 +6799,7 @@ void m68k_op_bfins_32_d(void)
 
 void m68k_op_bfins_32_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -6947,6 +6861,7 @@ void m68k_op_bfins_32_ai(void)
 
 void m68k_op_bfins_32_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7008,6 +6923,7 @@ void m68k_op_bfins_32_di(void)
 
 void m68k_op_bfins_32_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7069,6 +6985,7 @@ void m68k_op_bfins_32_ix(void)
 
 void m68k_op_bfins_32_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7130,6 +7047,7 @@ void m68k_op_bfins_32_aw(void)
 
 void m68k_op_bfins_32_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7191,6 +7109,7 @@ void m68k_op_bfins_32_al(void)
 
 void m68k_op_bfset_32_d(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7228,6 +7147,7 @@ void m68k_op_bfset_32_d(void)
 
 void m68k_op_bfset_32_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7283,6 +7203,7 @@ void m68k_op_bfset_32_ai(void)
 
 void m68k_op_bfset_32_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7338,6 +7259,7 @@ void m68k_op_bfset_32_di(void)
 
 void m68k_op_bfset_32_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7393,6 +7315,7 @@ void m68k_op_bfset_32_ix(void)
 
 void m68k_op_bfset_32_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7448,6 +7371,7 @@ void m68k_op_bfset_32_aw(void)
 
 void m68k_op_bfset_32_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7503,6 +7427,7 @@ void m68k_op_bfset_32_al(void)
 
 void m68k_op_bftst_32_d(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7538,6 +7463,7 @@ void m68k_op_bftst_32_d(void)
 
 void m68k_op_bftst_32_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7589,6 +7515,7 @@ void m68k_op_bftst_32_ai(void)
 
 void m68k_op_bftst_32_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7640,6 +7567,7 @@ void m68k_op_bftst_32_di(void)
 
 void m68k_op_bftst_32_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7691,6 +7619,7 @@ void m68k_op_bftst_32_ix(void)
 
 void m68k_op_bftst_32_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7742,6 +7671,7 @@ void m68k_op_bftst_32_aw(void)
 
 void m68k_op_bftst_32_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7793,6 +7723,7 @@ void m68k_op_bftst_32_al(void)
 
 void m68k_op_bftst_32_pcdi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -7844,6 +7775,7 @@ void m68k_op_bftst_32_pcdi(void)
 
 void m68k_op_bftst_32_pcix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8497,6 +8429,7 @@ void m68k_op_callm_32_pcix(void)
 
 void m68k_op_cas_8_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8526,6 +8459,7 @@ void m68k_op_cas_8_ai(void)
 
 void m68k_op_cas_8_pi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8555,6 +8489,7 @@ void m68k_op_cas_8_pi(void)
 
 void m68k_op_cas_8_pi7(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8584,6 +8519,7 @@ void m68k_op_cas_8_pi7(void)
 
 void m68k_op_cas_8_pd(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8613,6 +8549,7 @@ void m68k_op_cas_8_pd(void)
 
 void m68k_op_cas_8_pd7(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8642,6 +8579,7 @@ void m68k_op_cas_8_pd7(void)
 
 void m68k_op_cas_8_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8671,6 +8609,7 @@ void m68k_op_cas_8_di(void)
 
 void m68k_op_cas_8_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8700,6 +8639,7 @@ void m68k_op_cas_8_ix(void)
 
 void m68k_op_cas_8_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8729,6 +8669,7 @@ void m68k_op_cas_8_aw(void)
 
 void m68k_op_cas_8_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8758,6 +8699,7 @@ void m68k_op_cas_8_al(void)
 
 void m68k_op_cas_16_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8787,6 +8729,7 @@ void m68k_op_cas_16_ai(void)
 
 void m68k_op_cas_16_pi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8816,6 +8759,7 @@ void m68k_op_cas_16_pi(void)
 
 void m68k_op_cas_16_pd(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8845,6 +8789,7 @@ void m68k_op_cas_16_pd(void)
 
 void m68k_op_cas_16_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8874,6 +8819,7 @@ void m68k_op_cas_16_di(void)
 
 void m68k_op_cas_16_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8903,6 +8849,7 @@ void m68k_op_cas_16_ix(void)
 
 void m68k_op_cas_16_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8932,6 +8879,7 @@ void m68k_op_cas_16_aw(void)
 
 void m68k_op_cas_16_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8961,6 +8909,7 @@ void m68k_op_cas_16_al(void)
 
 void m68k_op_cas_32_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -8990,6 +8939,7 @@ void m68k_op_cas_32_ai(void)
 
 void m68k_op_cas_32_pi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -9019,6 +8969,7 @@ void m68k_op_cas_32_pi(void)
 
 void m68k_op_cas_32_pd(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -9048,6 +8999,7 @@ void m68k_op_cas_32_pd(void)
 
 void m68k_op_cas_32_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -9077,6 +9029,7 @@ void m68k_op_cas_32_di(void)
 
 void m68k_op_cas_32_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -9106,6 +9059,7 @@ void m68k_op_cas_32_ix(void)
 
 void m68k_op_cas_32_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -9135,6 +9089,7 @@ void m68k_op_cas_32_aw(void)
 
 void m68k_op_cas_32_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -9164,6 +9119,7 @@ void m68k_op_cas_32_al(void)
 
 void m68k_op_cas2_16(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_32();
@@ -9209,6 +9165,7 @@ void m68k_op_cas2_16(void)
 
 void m68k_op_cas2_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_32();
@@ -9254,6 +9211,7 @@ void m68k_op_cas2_32(void)
 
 void m68k_op_chk_16_d(void)
 {
+	m68ki_sync_flags();
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(DY);
 
@@ -9272,6 +9230,7 @@ void m68k_op_chk_16_d(void)
 
 void m68k_op_chk_16_ai(void)
 {
+	m68ki_sync_flags();
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_AY_AI_16());
 
@@ -9290,6 +9249,7 @@ void m68k_op_chk_16_ai(void)
 
 void m68k_op_chk_16_pi(void)
 {
+	m68ki_sync_flags();
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_AY_PI_16());
 
@@ -9308,6 +9268,7 @@ void m68k_op_chk_16_pi(void)
 
 void m68k_op_chk_16_pd(void)
 {
+	m68ki_sync_flags();
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_AY_PD_16());
 
@@ -9326,6 +9287,7 @@ void m68k_op_chk_16_pd(void)
 
 void m68k_op_chk_16_di(void)
 {
+	m68ki_sync_flags();
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_AY_DI_16());
 
@@ -9344,6 +9306,7 @@ void m68k_op_chk_16_di(void)
 
 void m68k_op_chk_16_ix(void)
 {
+	m68ki_sync_flags();
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_AY_IX_16());
 
@@ -9362,6 +9325,7 @@ void m68k_op_chk_16_ix(void)
 
 void m68k_op_chk_16_aw(void)
 {
+	m68ki_sync_flags();
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_AW_16());
 
@@ -9380,6 +9344,7 @@ void m68k_op_chk_16_aw(void)
 
 void m68k_op_chk_16_al(void)
 {
+	m68ki_sync_flags();
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_AL_16());
 
@@ -9398,6 +9363,7 @@ void m68k_op_chk_16_al(void)
 
 void m68k_op_chk_16_pcdi(void)
 {
+	m68ki_sync_flags();
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_PCDI_16());
 
@@ -9416,6 +9382,7 @@ void m68k_op_chk_16_pcdi(void)
 
 void m68k_op_chk_16_pcix(void)
 {
+	m68ki_sync_flags();
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_PCIX_16());
 
@@ -9434,6 +9401,7 @@ void m68k_op_chk_16_pcix(void)
 
 void m68k_op_chk_16_i(void)
 {
+	m68ki_sync_flags();
 	sint src = MAKE_INT_16(DX);
 	sint bound = MAKE_INT_16(OPER_I_16());
 
@@ -9452,6 +9420,7 @@ void m68k_op_chk_16_i(void)
 
 void m68k_op_chk_32_d(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
@@ -9475,6 +9444,7 @@ void m68k_op_chk_32_d(void)
 
 void m68k_op_chk_32_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
@@ -9498,6 +9468,7 @@ void m68k_op_chk_32_ai(void)
 
 void m68k_op_chk_32_pi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
@@ -9521,6 +9492,7 @@ void m68k_op_chk_32_pi(void)
 
 void m68k_op_chk_32_pd(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
@@ -9544,6 +9516,7 @@ void m68k_op_chk_32_pd(void)
 
 void m68k_op_chk_32_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
@@ -9567,6 +9540,7 @@ void m68k_op_chk_32_di(void)
 
 void m68k_op_chk_32_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
@@ -9590,6 +9564,7 @@ void m68k_op_chk_32_ix(void)
 
 void m68k_op_chk_32_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
@@ -9613,6 +9588,7 @@ void m68k_op_chk_32_aw(void)
 
 void m68k_op_chk_32_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
@@ -9636,6 +9612,7 @@ void m68k_op_chk_32_al(void)
 
 void m68k_op_chk_32_pcdi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
@@ -9659,6 +9636,7 @@ void m68k_op_chk_32_pcdi(void)
 
 void m68k_op_chk_32_pcix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
@@ -9682,6 +9660,7 @@ void m68k_op_chk_32_pcix(void)
 
 void m68k_op_chk_32_i(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		sint src = MAKE_INT_32(DX);
@@ -9705,6 +9684,7 @@ void m68k_op_chk_32_i(void)
 
 void m68k_op_chk2cmp2_8_pcdi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -9736,6 +9716,7 @@ void m68k_op_chk2cmp2_8_pcdi(void)
 
 void m68k_op_chk2cmp2_8_pcix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -9767,6 +9748,7 @@ void m68k_op_chk2cmp2_8_pcix(void)
 
 void m68k_op_chk2cmp2_8_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -9798,6 +9780,7 @@ void m68k_op_chk2cmp2_8_ai(void)
 
 void m68k_op_chk2cmp2_8_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -9829,6 +9812,7 @@ void m68k_op_chk2cmp2_8_di(void)
 
 void m68k_op_chk2cmp2_8_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -9860,6 +9844,7 @@ void m68k_op_chk2cmp2_8_ix(void)
 
 void m68k_op_chk2cmp2_8_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -9891,6 +9876,7 @@ void m68k_op_chk2cmp2_8_aw(void)
 
 void m68k_op_chk2cmp2_8_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -9922,6 +9908,7 @@ void m68k_op_chk2cmp2_8_al(void)
 
 void m68k_op_chk2cmp2_16_pcdi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -9958,6 +9945,7 @@ void m68k_op_chk2cmp2_16_pcdi(void)
 
 void m68k_op_chk2cmp2_16_pcix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -9994,6 +9982,7 @@ void m68k_op_chk2cmp2_16_pcix(void)
 
 void m68k_op_chk2cmp2_16_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -10031,6 +10020,7 @@ void m68k_op_chk2cmp2_16_ai(void)
 
 void m68k_op_chk2cmp2_16_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -10068,6 +10058,7 @@ void m68k_op_chk2cmp2_16_di(void)
 
 void m68k_op_chk2cmp2_16_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -10105,6 +10096,7 @@ void m68k_op_chk2cmp2_16_ix(void)
 
 void m68k_op_chk2cmp2_16_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -10142,6 +10134,7 @@ void m68k_op_chk2cmp2_16_aw(void)
 
 void m68k_op_chk2cmp2_16_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -10179,6 +10172,7 @@ void m68k_op_chk2cmp2_16_al(void)
 
 void m68k_op_chk2cmp2_32_pcdi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -10209,6 +10203,7 @@ void m68k_op_chk2cmp2_32_pcdi(void)
 
 void m68k_op_chk2cmp2_32_pcix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -10239,6 +10234,7 @@ void m68k_op_chk2cmp2_32_pcix(void)
 
 void m68k_op_chk2cmp2_32_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -10269,6 +10265,7 @@ void m68k_op_chk2cmp2_32_ai(void)
 
 void m68k_op_chk2cmp2_32_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -10299,6 +10296,7 @@ void m68k_op_chk2cmp2_32_di(void)
 
 void m68k_op_chk2cmp2_32_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -10329,6 +10327,7 @@ void m68k_op_chk2cmp2_32_ix(void)
 
 void m68k_op_chk2cmp2_32_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -10359,6 +10358,7 @@ void m68k_op_chk2cmp2_32_aw(void)
 
 void m68k_op_chk2cmp2_32_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint word2 = OPER_I_16();
@@ -10392,8 +10392,7 @@ void m68k_op_clr_8_d(void)
 	DY &= 0xffffff00;
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10403,8 +10402,7 @@ void m68k_op_clr_8_ai(void)
 	m68ki_write_8(EA_AY_AI_8(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10414,8 +10412,7 @@ void m68k_op_clr_8_pi(void)
 	m68ki_write_8(EA_AY_PI_8(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10425,8 +10422,7 @@ void m68k_op_clr_8_pi7(void)
 	m68ki_write_8(EA_A7_PI_8(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10436,8 +10432,7 @@ void m68k_op_clr_8_pd(void)
 	m68ki_write_8(EA_AY_PD_8(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10447,8 +10442,7 @@ void m68k_op_clr_8_pd7(void)
 	m68ki_write_8(EA_A7_PD_8(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10458,8 +10452,7 @@ void m68k_op_clr_8_di(void)
 	m68ki_write_8(EA_AY_DI_8(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10469,8 +10462,7 @@ void m68k_op_clr_8_ix(void)
 	m68ki_write_8(EA_AY_IX_8(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10480,8 +10472,7 @@ void m68k_op_clr_8_aw(void)
 	m68ki_write_8(EA_AW_8(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10491,8 +10482,7 @@ void m68k_op_clr_8_al(void)
 	m68ki_write_8(EA_AL_8(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10502,8 +10492,7 @@ void m68k_op_clr_16_d(void)
 	DY &= 0xffff0000;
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10513,8 +10502,7 @@ void m68k_op_clr_16_ai(void)
 	m68ki_write_16(EA_AY_AI_16(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10524,8 +10512,7 @@ void m68k_op_clr_16_pi(void)
 	m68ki_write_16(EA_AY_PI_16(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10535,8 +10522,7 @@ void m68k_op_clr_16_pd(void)
 	m68ki_write_16(EA_AY_PD_16(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10546,8 +10532,7 @@ void m68k_op_clr_16_di(void)
 	m68ki_write_16(EA_AY_DI_16(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10557,8 +10542,7 @@ void m68k_op_clr_16_ix(void)
 	m68ki_write_16(EA_AY_IX_16(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10568,8 +10552,7 @@ void m68k_op_clr_16_aw(void)
 	m68ki_write_16(EA_AW_16(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10579,8 +10562,7 @@ void m68k_op_clr_16_al(void)
 	m68ki_write_16(EA_AL_16(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10590,8 +10572,7 @@ void m68k_op_clr_32_d(void)
 	DY = 0;
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10601,8 +10582,7 @@ void m68k_op_clr_32_ai(void)
 	m68ki_write_32(EA_AY_AI_32(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10612,8 +10592,7 @@ void m68k_op_clr_32_pi(void)
 	m68ki_write_32(EA_AY_PI_32(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10623,8 +10602,7 @@ void m68k_op_clr_32_pd(void)
 	m68ki_write_32(EA_AY_PD_32(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10634,8 +10612,7 @@ void m68k_op_clr_32_di(void)
 	m68ki_write_32(EA_AY_DI_32(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10645,8 +10622,7 @@ void m68k_op_clr_32_ix(void)
 	m68ki_write_32(EA_AY_IX_32(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10656,8 +10632,7 @@ void m68k_op_clr_32_aw(void)
 	m68ki_write_32(EA_AW_32(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
@@ -10667,14 +10642,14 @@ void m68k_op_clr_32_al(void)
 	m68ki_write_32(EA_AL_32(), 0);
 
 	FLAG_N = NFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	FLAG_Z = ZFLAG_SET;
 }
 
 
 void m68k_op_cmp_8_d(void)
 {
+	m68ki_sync_flags();
 	uint src = MASK_OUT_ABOVE_8(DY);
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
@@ -10688,6 +10663,7 @@ void m68k_op_cmp_8_d(void)
 
 void m68k_op_cmp_8_ai(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_AI_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
@@ -10701,6 +10677,7 @@ void m68k_op_cmp_8_ai(void)
 
 void m68k_op_cmp_8_pi(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PI_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
@@ -10714,6 +10691,7 @@ void m68k_op_cmp_8_pi(void)
 
 void m68k_op_cmp_8_pi7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_A7_PI_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
@@ -10727,6 +10705,7 @@ void m68k_op_cmp_8_pi7(void)
 
 void m68k_op_cmp_8_pd(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PD_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
@@ -10740,6 +10719,7 @@ void m68k_op_cmp_8_pd(void)
 
 void m68k_op_cmp_8_pd7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_A7_PD_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
@@ -10753,6 +10733,7 @@ void m68k_op_cmp_8_pd7(void)
 
 void m68k_op_cmp_8_di(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_DI_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
@@ -10766,6 +10747,7 @@ void m68k_op_cmp_8_di(void)
 
 void m68k_op_cmp_8_ix(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_IX_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
@@ -10779,6 +10761,7 @@ void m68k_op_cmp_8_ix(void)
 
 void m68k_op_cmp_8_aw(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AW_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
@@ -10792,6 +10775,7 @@ void m68k_op_cmp_8_aw(void)
 
 void m68k_op_cmp_8_al(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AL_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
@@ -10805,6 +10789,7 @@ void m68k_op_cmp_8_al(void)
 
 void m68k_op_cmp_8_pcdi(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_PCDI_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
@@ -10818,6 +10803,7 @@ void m68k_op_cmp_8_pcdi(void)
 
 void m68k_op_cmp_8_pcix(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_PCIX_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
@@ -10831,6 +10817,7 @@ void m68k_op_cmp_8_pcix(void)
 
 void m68k_op_cmp_8_i(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_8();
 	uint dst = MASK_OUT_ABOVE_8(DX);
 	uint res = dst - src;
@@ -10844,6 +10831,7 @@ void m68k_op_cmp_8_i(void)
 
 void m68k_op_cmp_16_d(void)
 {
+	m68ki_sync_flags();
 	uint src = MASK_OUT_ABOVE_16(DY);
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
@@ -10857,6 +10845,7 @@ void m68k_op_cmp_16_d(void)
 
 void m68k_op_cmp_16_a(void)
 {
+	m68ki_sync_flags();
 	uint src = MASK_OUT_ABOVE_16(AY);
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
@@ -10870,6 +10859,7 @@ void m68k_op_cmp_16_a(void)
 
 void m68k_op_cmp_16_ai(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_AI_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
@@ -10883,6 +10873,7 @@ void m68k_op_cmp_16_ai(void)
 
 void m68k_op_cmp_16_pi(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PI_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
@@ -10896,6 +10887,7 @@ void m68k_op_cmp_16_pi(void)
 
 void m68k_op_cmp_16_pd(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PD_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
@@ -10909,6 +10901,7 @@ void m68k_op_cmp_16_pd(void)
 
 void m68k_op_cmp_16_di(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_DI_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
@@ -10922,6 +10915,7 @@ void m68k_op_cmp_16_di(void)
 
 void m68k_op_cmp_16_ix(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_IX_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
@@ -10935,6 +10929,7 @@ void m68k_op_cmp_16_ix(void)
 
 void m68k_op_cmp_16_aw(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AW_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
@@ -10948,6 +10943,7 @@ void m68k_op_cmp_16_aw(void)
 
 void m68k_op_cmp_16_al(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AL_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
@@ -10961,6 +10957,7 @@ void m68k_op_cmp_16_al(void)
 
 void m68k_op_cmp_16_pcdi(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_PCDI_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
@@ -10974,6 +10971,7 @@ void m68k_op_cmp_16_pcdi(void)
 
 void m68k_op_cmp_16_pcix(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_PCIX_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
@@ -10987,6 +10985,7 @@ void m68k_op_cmp_16_pcix(void)
 
 void m68k_op_cmp_16_i(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_16();
 	uint dst = MASK_OUT_ABOVE_16(DX);
 	uint res = dst - src;
@@ -11000,6 +10999,7 @@ void m68k_op_cmp_16_i(void)
 
 void m68k_op_cmp_32_d(void)
 {
+	m68ki_sync_flags();
 	uint src = DY;
 	uint dst = DX;
 	uint res = dst - src;
@@ -11013,6 +11013,7 @@ void m68k_op_cmp_32_d(void)
 
 void m68k_op_cmp_32_a(void)
 {
+	m68ki_sync_flags();
 	uint src = AY;
 	uint dst = DX;
 	uint res = dst - src;
@@ -11026,6 +11027,7 @@ void m68k_op_cmp_32_a(void)
 
 void m68k_op_cmp_32_ai(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_AI_32();
 	uint dst = DX;
 	uint res = dst - src;
@@ -11039,6 +11041,7 @@ void m68k_op_cmp_32_ai(void)
 
 void m68k_op_cmp_32_pi(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PI_32();
 	uint dst = DX;
 	uint res = dst - src;
@@ -11052,6 +11055,7 @@ void m68k_op_cmp_32_pi(void)
 
 void m68k_op_cmp_32_pd(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PD_32();
 	uint dst = DX;
 	uint res = dst - src;
@@ -11065,6 +11069,7 @@ void m68k_op_cmp_32_pd(void)
 
 void m68k_op_cmp_32_di(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_DI_32();
 	uint dst = DX;
 	uint res = dst - src;
@@ -11078,6 +11083,7 @@ void m68k_op_cmp_32_di(void)
 
 void m68k_op_cmp_32_ix(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_IX_32();
 	uint dst = DX;
 	uint res = dst - src;
@@ -11091,6 +11097,7 @@ void m68k_op_cmp_32_ix(void)
 
 void m68k_op_cmp_32_aw(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AW_32();
 	uint dst = DX;
 	uint res = dst - src;
@@ -11104,6 +11111,7 @@ void m68k_op_cmp_32_aw(void)
 
 void m68k_op_cmp_32_al(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AL_32();
 	uint dst = DX;
 	uint res = dst - src;
@@ -11117,6 +11125,7 @@ void m68k_op_cmp_32_al(void)
 
 void m68k_op_cmp_32_pcdi(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_PCDI_32();
 	uint dst = DX;
 	uint res = dst - src;
@@ -11130,6 +11139,7 @@ void m68k_op_cmp_32_pcdi(void)
 
 void m68k_op_cmp_32_pcix(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_PCIX_32();
 	uint dst = DX;
 	uint res = dst - src;
@@ -11143,6 +11153,7 @@ void m68k_op_cmp_32_pcix(void)
 
 void m68k_op_cmp_32_i(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_32();
 	uint dst = DX;
 	uint res = dst - src;
@@ -11156,6 +11167,7 @@ void m68k_op_cmp_32_i(void)
 
 void m68k_op_cmpa_16_d(void)
 {
+	m68ki_sync_flags();
 	uint src = MAKE_INT_16(DY);
 	uint dst = AX;
 	uint res = dst - src;
@@ -11169,6 +11181,7 @@ void m68k_op_cmpa_16_d(void)
 
 void m68k_op_cmpa_16_a(void)
 {
+	m68ki_sync_flags();
 	uint src = MAKE_INT_16(AY);
 	uint dst = AX;
 	uint res = dst - src;
@@ -11182,6 +11195,7 @@ void m68k_op_cmpa_16_a(void)
 
 void m68k_op_cmpa_16_ai(void)
 {
+	m68ki_sync_flags();
 	uint src = MAKE_INT_16(OPER_AY_AI_16());
 	uint dst = AX;
 	uint res = dst - src;
@@ -11195,6 +11209,7 @@ void m68k_op_cmpa_16_ai(void)
 
 void m68k_op_cmpa_16_pi(void)
 {
+	m68ki_sync_flags();
 	uint src = MAKE_INT_16(OPER_AY_PI_16());
 	uint dst = AX;
 	uint res = dst - src;
@@ -11208,6 +11223,7 @@ void m68k_op_cmpa_16_pi(void)
 
 void m68k_op_cmpa_16_pd(void)
 {
+	m68ki_sync_flags();
 	uint src = MAKE_INT_16(OPER_AY_PD_16());
 	uint dst = AX;
 	uint res = dst - src;
@@ -11221,6 +11237,7 @@ void m68k_op_cmpa_16_pd(void)
 
 void m68k_op_cmpa_16_di(void)
 {
+	m68ki_sync_flags();
 	uint src = MAKE_INT_16(OPER_AY_DI_16());
 	uint dst = AX;
 	uint res = dst - src;
@@ -11234,6 +11251,7 @@ void m68k_op_cmpa_16_di(void)
 
 void m68k_op_cmpa_16_ix(void)
 {
+	m68ki_sync_flags();
 	uint src = MAKE_INT_16(OPER_AY_IX_16());
 	uint dst = AX;
 	uint res = dst - src;
@@ -11247,6 +11265,7 @@ void m68k_op_cmpa_16_ix(void)
 
 void m68k_op_cmpa_16_aw(void)
 {
+	m68ki_sync_flags();
 	uint src = MAKE_INT_16(OPER_AW_16());
 	uint dst = AX;
 	uint res = dst - src;
@@ -11260,6 +11279,7 @@ void m68k_op_cmpa_16_aw(void)
 
 void m68k_op_cmpa_16_al(void)
 {
+	m68ki_sync_flags();
 	uint src = MAKE_INT_16(OPER_AL_16());
 	uint dst = AX;
 	uint res = dst - src;
@@ -11273,6 +11293,7 @@ void m68k_op_cmpa_16_al(void)
 
 void m68k_op_cmpa_16_pcdi(void)
 {
+	m68ki_sync_flags();
 	uint src = MAKE_INT_16(OPER_PCDI_16());
 	uint dst = AX;
 	uint res = dst - src;
@@ -11286,6 +11307,7 @@ void m68k_op_cmpa_16_pcdi(void)
 
 void m68k_op_cmpa_16_pcix(void)
 {
+	m68ki_sync_flags();
 	uint src = MAKE_INT_16(OPER_PCIX_16());
 	uint dst = AX;
 	uint res = dst - src;
@@ -11299,6 +11321,7 @@ void m68k_op_cmpa_16_pcix(void)
 
 void m68k_op_cmpa_16_i(void)
 {
+	m68ki_sync_flags();
 	uint src = MAKE_INT_16(OPER_I_16());
 	uint dst = AX;
 	uint res = dst - src;
@@ -11312,6 +11335,7 @@ void m68k_op_cmpa_16_i(void)
 
 void m68k_op_cmpa_32_d(void)
 {
+	m68ki_sync_flags();
 	uint src = DY;
 	uint dst = AX;
 	uint res = dst - src;
@@ -11325,6 +11349,7 @@ void m68k_op_cmpa_32_d(void)
 
 void m68k_op_cmpa_32_a(void)
 {
+	m68ki_sync_flags();
 	uint src = AY;
 	uint dst = AX;
 	uint res = dst - src;
@@ -11338,6 +11363,7 @@ void m68k_op_cmpa_32_a(void)
 
 void m68k_op_cmpa_32_ai(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_AI_32();
 	uint dst = AX;
 	uint res = dst - src;
@@ -11351,6 +11377,7 @@ void m68k_op_cmpa_32_ai(void)
 
 void m68k_op_cmpa_32_pi(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PI_32();
 	uint dst = AX;
 	uint res = dst - src;
@@ -11364,6 +11391,7 @@ void m68k_op_cmpa_32_pi(void)
 
 void m68k_op_cmpa_32_pd(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PD_32();
 	uint dst = AX;
 	uint res = dst - src;
@@ -11377,6 +11405,7 @@ void m68k_op_cmpa_32_pd(void)
 
 void m68k_op_cmpa_32_di(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_DI_32();
 	uint dst = AX;
 	uint res = dst - src;
@@ -11390,6 +11419,7 @@ void m68k_op_cmpa_32_di(void)
 
 void m68k_op_cmpa_32_ix(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_IX_32();
 	uint dst = AX;
 	uint res = dst - src;
@@ -11403,6 +11433,7 @@ void m68k_op_cmpa_32_ix(void)
 
 void m68k_op_cmpa_32_aw(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AW_32();
 	uint dst = AX;
 	uint res = dst - src;
@@ -11416,6 +11447,7 @@ void m68k_op_cmpa_32_aw(void)
 
 void m68k_op_cmpa_32_al(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AL_32();
 	uint dst = AX;
 	uint res = dst - src;
@@ -11429,6 +11461,7 @@ void m68k_op_cmpa_32_al(void)
 
 void m68k_op_cmpa_32_pcdi(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_PCDI_32();
 	uint dst = AX;
 	uint res = dst - src;
@@ -11442,6 +11475,7 @@ void m68k_op_cmpa_32_pcdi(void)
 
 void m68k_op_cmpa_32_pcix(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_PCIX_32();
 	uint dst = AX;
 	uint res = dst - src;
@@ -11455,6 +11489,7 @@ void m68k_op_cmpa_32_pcix(void)
 
 void m68k_op_cmpa_32_i(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_32();
 	uint dst = AX;
 	uint res = dst - src;
@@ -11468,6 +11503,7 @@ void m68k_op_cmpa_32_i(void)
 
 void m68k_op_cmpi_8_d(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_8();
 	uint dst = MASK_OUT_ABOVE_8(DY);
 	uint res = dst - src;
@@ -11481,6 +11517,7 @@ void m68k_op_cmpi_8_d(void)
 
 void m68k_op_cmpi_8_ai(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_8();
 	uint dst = OPER_AY_AI_8();
 	uint res = dst - src;
@@ -11494,6 +11531,7 @@ void m68k_op_cmpi_8_ai(void)
 
 void m68k_op_cmpi_8_pi(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_8();
 	uint dst = OPER_AY_PI_8();
 	uint res = dst - src;
@@ -11507,6 +11545,7 @@ void m68k_op_cmpi_8_pi(void)
 
 void m68k_op_cmpi_8_pi7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_8();
 	uint dst = OPER_A7_PI_8();
 	uint res = dst - src;
@@ -11520,6 +11559,7 @@ void m68k_op_cmpi_8_pi7(void)
 
 void m68k_op_cmpi_8_pd(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_8();
 	uint dst = OPER_AY_PD_8();
 	uint res = dst - src;
@@ -11533,6 +11573,7 @@ void m68k_op_cmpi_8_pd(void)
 
 void m68k_op_cmpi_8_pd7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_8();
 	uint dst = OPER_A7_PD_8();
 	uint res = dst - src;
@@ -11546,6 +11587,7 @@ void m68k_op_cmpi_8_pd7(void)
 
 void m68k_op_cmpi_8_di(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_8();
 	uint dst = OPER_AY_DI_8();
 	uint res = dst - src;
@@ -11559,6 +11601,7 @@ void m68k_op_cmpi_8_di(void)
 
 void m68k_op_cmpi_8_ix(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_8();
 	uint dst = OPER_AY_IX_8();
 	uint res = dst - src;
@@ -11572,6 +11615,7 @@ void m68k_op_cmpi_8_ix(void)
 
 void m68k_op_cmpi_8_aw(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_8();
 	uint dst = OPER_AW_8();
 	uint res = dst - src;
@@ -11585,6 +11629,7 @@ void m68k_op_cmpi_8_aw(void)
 
 void m68k_op_cmpi_8_al(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_8();
 	uint dst = OPER_AL_8();
 	uint res = dst - src;
@@ -11598,6 +11643,7 @@ void m68k_op_cmpi_8_al(void)
 
 void m68k_op_cmpi_8_pcdi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_8();
@@ -11616,6 +11662,7 @@ void m68k_op_cmpi_8_pcdi(void)
 
 void m68k_op_cmpi_8_pcix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_8();
@@ -11634,6 +11681,7 @@ void m68k_op_cmpi_8_pcix(void)
 
 void m68k_op_cmpi_16_d(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_16();
 	uint dst = MASK_OUT_ABOVE_16(DY);
 	uint res = dst - src;
@@ -11647,6 +11695,7 @@ void m68k_op_cmpi_16_d(void)
 
 void m68k_op_cmpi_16_ai(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_16();
 	uint dst = OPER_AY_AI_16();
 	uint res = dst - src;
@@ -11660,6 +11709,7 @@ void m68k_op_cmpi_16_ai(void)
 
 void m68k_op_cmpi_16_pi(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_16();
 	uint dst = OPER_AY_PI_16();
 	uint res = dst - src;
@@ -11673,6 +11723,7 @@ void m68k_op_cmpi_16_pi(void)
 
 void m68k_op_cmpi_16_pd(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_16();
 	uint dst = OPER_AY_PD_16();
 	uint res = dst - src;
@@ -11686,6 +11737,7 @@ void m68k_op_cmpi_16_pd(void)
 
 void m68k_op_cmpi_16_di(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_16();
 	uint dst = OPER_AY_DI_16();
 	uint res = dst - src;
@@ -11699,6 +11751,7 @@ void m68k_op_cmpi_16_di(void)
 
 void m68k_op_cmpi_16_ix(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_16();
 	uint dst = OPER_AY_IX_16();
 	uint res = dst - src;
@@ -11712,6 +11765,7 @@ void m68k_op_cmpi_16_ix(void)
 
 void m68k_op_cmpi_16_aw(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_16();
 	uint dst = OPER_AW_16();
 	uint res = dst - src;
@@ -11725,6 +11779,7 @@ void m68k_op_cmpi_16_aw(void)
 
 void m68k_op_cmpi_16_al(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_16();
 	uint dst = OPER_AL_16();
 	uint res = dst - src;
@@ -11738,6 +11793,7 @@ void m68k_op_cmpi_16_al(void)
 
 void m68k_op_cmpi_16_pcdi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_16();
@@ -11756,6 +11812,7 @@ void m68k_op_cmpi_16_pcdi(void)
 
 void m68k_op_cmpi_16_pcix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_16();
@@ -11774,6 +11831,7 @@ void m68k_op_cmpi_16_pcix(void)
 
 void m68k_op_cmpi_32_d(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_32();
 	uint dst = DY;
 	uint res = dst - src;
@@ -11787,6 +11845,7 @@ void m68k_op_cmpi_32_d(void)
 
 void m68k_op_cmpi_32_ai(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_32();
 	uint dst = OPER_AY_AI_32();
 	uint res = dst - src;
@@ -11800,6 +11859,7 @@ void m68k_op_cmpi_32_ai(void)
 
 void m68k_op_cmpi_32_pi(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_32();
 	uint dst = OPER_AY_PI_32();
 	uint res = dst - src;
@@ -11813,6 +11873,7 @@ void m68k_op_cmpi_32_pi(void)
 
 void m68k_op_cmpi_32_pd(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_32();
 	uint dst = OPER_AY_PD_32();
 	uint res = dst - src;
@@ -11826,6 +11887,7 @@ void m68k_op_cmpi_32_pd(void)
 
 void m68k_op_cmpi_32_di(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_32();
 	uint dst = OPER_AY_DI_32();
 	uint res = dst - src;
@@ -11839,6 +11901,7 @@ void m68k_op_cmpi_32_di(void)
 
 void m68k_op_cmpi_32_ix(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_32();
 	uint dst = OPER_AY_IX_32();
 	uint res = dst - src;
@@ -11852,6 +11915,7 @@ void m68k_op_cmpi_32_ix(void)
 
 void m68k_op_cmpi_32_aw(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_32();
 	uint dst = OPER_AW_32();
 	uint res = dst - src;
@@ -11865,6 +11929,7 @@ void m68k_op_cmpi_32_aw(void)
 
 void m68k_op_cmpi_32_al(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_I_32();
 	uint dst = OPER_AL_32();
 	uint res = dst - src;
@@ -11878,6 +11943,7 @@ void m68k_op_cmpi_32_al(void)
 
 void m68k_op_cmpi_32_pcdi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_32();
@@ -11896,6 +11962,7 @@ void m68k_op_cmpi_32_pcdi(void)
 
 void m68k_op_cmpi_32_pcix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint src = OPER_I_32();
@@ -11914,6 +11981,7 @@ void m68k_op_cmpi_32_pcix(void)
 
 void m68k_op_cmpm_8_ax7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PI_8();
 	uint dst = OPER_A7_PI_8();
 	uint res = dst - src;
@@ -11927,6 +11995,7 @@ void m68k_op_cmpm_8_ax7(void)
 
 void m68k_op_cmpm_8_ay7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_A7_PI_8();
 	uint dst = OPER_AX_PI_8();
 	uint res = dst - src;
@@ -11940,6 +12009,7 @@ void m68k_op_cmpm_8_ay7(void)
 
 void m68k_op_cmpm_8_axy7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_A7_PI_8();
 	uint dst = OPER_A7_PI_8();
 	uint res = dst - src;
@@ -11953,6 +12023,7 @@ void m68k_op_cmpm_8_axy7(void)
 
 void m68k_op_cmpm_8(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PI_8();
 	uint dst = OPER_AX_PI_8();
 	uint res = dst - src;
@@ -11966,6 +12037,7 @@ void m68k_op_cmpm_8(void)
 
 void m68k_op_cmpm_16(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PI_16();
 	uint dst = OPER_AX_PI_16();
 	uint res = dst - src;
@@ -11979,6 +12051,7 @@ void m68k_op_cmpm_16(void)
 
 void m68k_op_cmpm_32(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PI_32();
 	uint dst = OPER_AX_PI_32();
 	uint res = dst - src;
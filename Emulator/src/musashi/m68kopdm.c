@@ -24,6 +24,7 @@ void m68k_op_dbf_16(void)
 		m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 		m68ki_branch_16(offset);
 		USE_CYCLES(CYC_DBCC_F_NOEXP);
+		m68ki_dbcc_skip_loop(); /* auto-disable (see m68kcpu.h) */
 		return;
 	}
 	REG_PC += 2;
@@ -33,6 +34,7 @@ void m68k_op_dbf_16(void)
 
 void m68k_op_dbhi_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_NOT_HI())
 	{
 		uint* r_dst = &DY;
@@ -46,6 +48,7 @@ void m68k_op_dbhi_16(void)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_16(offset);
 			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			m68ki_dbcc_skip_loop(); /* auto-disable (see m68kcpu.h) */
 			return;
 		}
 		REG_PC += 2;
@@ -58,6 +61,7 @@ void m68k_op_dbhi_16(void)
 
 void m68k_op_dbls_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_NOT_LS())
 	{
 		uint* r_dst = &DY;
@@ -71,6 +75,7 @@ void m68k_op_dbls_16(void)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_16(offset);
 			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			m68ki_dbcc_skip_loop(); /* auto-disable (see m68kcpu.h) */
 			return;
 		}
 		REG_PC += 2;
@@ -83,6 +88,7 @@ void m68k_op_dbls_16(void)
 
 void m68k_op_dbcc_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_NOT_CC())
 	{
 		uint* r_dst = &DY;
@@ -96,6 +102,7 @@ void m68k_op_dbcc_16(void)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_16(offset);
 			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			m68ki_dbcc_skip_loop(); /* auto-disable (see m68kcpu.h) */
 			return;
 		}
 		REG_PC += 2;
@@ -108,6 +115,7 @@ void m68k_op_dbcc_16(void)
 
 void m68k_op_dbcs_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_NOT_CS())
 	{
 		uint* r_dst = &DY;
@@ -121,6 +129,7 @@ void m68k_op_dbcs_16(void)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_16(offset);
 			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			m68ki_dbcc_skip_loop(); /* auto-disable (see m68kcpu.h) */
 			return;
 		}
 		REG_PC += 2;
@@ -146,6 +155,7 @@ void m68k_op_dbne_16(void)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_16(offset);
 			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			m68ki_dbcc_skip_loop(); /* auto-disable (see m68kcpu.h) */
 			return;
 		}
 		REG_PC += 2;
@@ -171,6 +181,7 @@ void m68k_op_dbeq_16(void)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_16(offset);
 			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			m68ki_dbcc_skip_loop(); /* auto-disable (see m68kcpu.h) */
 			return;
 		}
 		REG_PC += 2;
@@ -183,6 +194,7 @@ void m68k_op_dbeq_16(void)
 
 void m68k_op_dbvc_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_NOT_VC())
 	{
 		uint* r_dst = &DY;
@@ -196,6 +208,7 @@ void m68k_op_dbvc_16(void)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_16(offset);
 			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			m68ki_dbcc_skip_loop(); /* auto-disable (see m68kcpu.h) */
 			return;
 		}
 		REG_PC += 2;
@@ -208,6 +221,7 @@ void m68k_op_dbvc_16(void)
 
 void m68k_op_dbvs_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_NOT_VS())
 	{
 		uint* r_dst = &DY;
@@ -221,6 +235,7 @@ void m68k_op_dbvs_16(void)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_16(offset);
 			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			m68ki_dbcc_skip_loop(); /* auto-disable (see m68kcpu.h) */
 			return;
 		}
 		REG_PC += 2;
@@ -246,6 +261,7 @@ void m68k_op_dbpl_16(void)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_16(offset);
 			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			m68ki_dbcc_skip_loop(); /* auto-disable (see m68kcpu.h) */
 			return;
 		}
 		REG_PC += 2;
@@ -271,6 +287,7 @@ void m68k_op_dbmi_16(void)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_16(offset);
 			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			m68ki_dbcc_skip_loop(); /* auto-disable (see m68kcpu.h) */
 			return;
 		}
 		REG_PC += 2;
@@ -283,6 +300,7 @@ void m68k_op_dbmi_16(void)
 
 void m68k_op_dbge_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_NOT_GE())
 	{
 		uint* r_dst = &DY;
@@ -296,6 +314,7 @@ void m68k_op_dbge_16(void)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_16(offset);
 			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			m68ki_dbcc_skip_loop(); /* auto-disable (see m68kcpu.h) */
 			return;
 		}
 		REG_PC += 2;
@@ -308,6 +327,7 @@ void m68k_op_dbge_16(void)
 
 void m68k_op_dblt_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_NOT_LT())
 	{
 		uint* r_dst = &DY;
@@ -321,6 +341,7 @@ void m68k_op_dblt_16(void)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_16(offset);
 			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			m68ki_dbcc_skip_loop(); /* auto-disable (see m68kcpu.h) */
 			return;
 		}
 		REG_PC += 2;
@@ -333,6 +354,7 @@ void m68k_op_dblt_16(void)
 
 void m68k_op_dbgt_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_NOT_GT())
 	{
 		uint* r_dst = &DY;
@@ -346,6 +368,7 @@ void m68k_op_dbgt_16(void)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_16(offset);
 			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			m68ki_dbcc_skip_loop(); /* auto-disable (see m68kcpu.h) */
 			return;
 		}
 		REG_PC += 2;
@@ -358,6 +381,7 @@ void m68k_op_dbgt_16(void)
 
 void m68k_op_dble_16(void)
 {
+	m68ki_sync_flags();
 	if(COND_NOT_LE())
 	{
 		uint* r_dst = &DY;
@@ -371,6 +395,7 @@ void m68k_op_dble_16(void)
 			m68ki_trace_t0();			   /* auto-disable (see m68kcpu.h) */
 			m68ki_branch_16(offset);
 			USE_CYCLES(CYC_DBCC_F_NOEXP);
+			m68ki_dbcc_skip_loop(); /* auto-disable (see m68kcpu.h) */
 			return;
 		}
 		REG_PC += 2;
@@ -383,6 +408,7 @@ void m68k_op_dble_16(void)
 
 void m68k_op_divs_16_d(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(DY);
 	sint quotient;
@@ -421,6 +447,7 @@ void m68k_op_divs_16_d(void)
 
 void m68k_op_divs_16_ai(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_AY_AI_16());
 	sint quotient;
@@ -459,6 +486,7 @@ void m68k_op_divs_16_ai(void)
 
 void m68k_op_divs_16_pi(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_AY_PI_16());
 	sint quotient;
@@ -497,6 +525,7 @@ void m68k_op_divs_16_pi(void)
 
 void m68k_op_divs_16_pd(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_AY_PD_16());
 	sint quotient;
@@ -535,6 +564,7 @@ void m68k_op_divs_16_pd(void)
 
 void m68k_op_divs_16_di(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_AY_DI_16());
 	sint quotient;
@@ -573,6 +603,7 @@ void m68k_op_divs_16_di(void)
 
 void m68k_op_divs_16_ix(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_AY_IX_16());
 	sint quotient;
@@ -611,6 +642,7 @@ void m68k_op_divs_16_ix(void)
 
 void m68k_op_divs_16_aw(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_AW_16());
 	sint quotient;
@@ -649,6 +681,7 @@ void m68k_op_divs_16_aw(void)
 
 void m68k_op_divs_16_al(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_AL_16());
 	sint quotient;
@@ -687,6 +720,7 @@ void m68k_op_divs_16_al(void)
 
 void m68k_op_divs_16_pcdi(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_PCDI_16());
 	sint quotient;
@@ -725,6 +759,7 @@ void m68k_op_divs_16_pcdi(void)
 
 void m68k_op_divs_16_pcix(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_PCIX_16());
 	sint quotient;
@@ -763,6 +798,7 @@ void m68k_op_divs_16_pcix(void)
 
 void m68k_op_divs_16_i(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	sint src = MAKE_INT_16(OPER_I_16());
 	sint quotient;
@@ -801,6 +837,7 @@ void m68k_op_divs_16_i(void)
 
 void m68k_op_divu_16_d(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_16(DY);
 
@@ -827,6 +864,7 @@ void m68k_op_divu_16_d(void)
 
 void m68k_op_divu_16_ai(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = OPER_AY_AI_16();
 
@@ -853,6 +891,7 @@ void m68k_op_divu_16_ai(void)
 
 void m68k_op_divu_16_pi(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = OPER_AY_PI_16();
 
@@ -879,6 +918,7 @@ void m68k_op_divu_16_pi(void)
 
 void m68k_op_divu_16_pd(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = OPER_AY_PD_16();
 
@@ -905,6 +945,7 @@ void m68k_op_divu_16_pd(void)
 
 void m68k_op_divu_16_di(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = OPER_AY_DI_16();
 
@@ -931,6 +972,7 @@ void m68k_op_divu_16_di(void)
 
 void m68k_op_divu_16_ix(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = OPER_AY_IX_16();
 
@@ -957,6 +999,7 @@ void m68k_op_divu_16_ix(void)
 
 void m68k_op_divu_16_aw(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = OPER_AW_16();
 
@@ -983,6 +1026,7 @@ void m68k_op_divu_16_aw(void)
 
 void m68k_op_divu_16_al(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = OPER_AL_16();
 
@@ -1009,6 +1053,7 @@ void m68k_op_divu_16_al(void)
 
 void m68k_op_divu_16_pcdi(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = OPER_PCDI_16();
 
@@ -1035,6 +1080,7 @@ void m68k_op_divu_16_pcdi(void)
 
 void m68k_op_divu_16_pcix(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = OPER_PCIX_16();
 
@@ -1061,6 +1107,7 @@ void m68k_op_divu_16_pcix(void)
 
 void m68k_op_divu_16_i(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = OPER_I_16();
 
@@ -1087,6 +1134,7 @@ void m68k_op_divu_16_i(void)
 
 void m68k_op_divl_32_d(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -1298,6 +1346,7 @@ void m68k_op_divl_32_d(void)
 
 void m68k_op_divl_32_ai(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -1509,6 +1558,7 @@ void m68k_op_divl_32_ai(void)
 
 void m68k_op_divl_32_pi(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -1720,6 +1770,7 @@ void m68k_op_divl_32_pi(void)
 
 void m68k_op_divl_32_pd(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -1931,6 +1982,7 @@ void m68k_op_divl_32_pd(void)
 
 void m68k_op_divl_32_di(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -2142,6 +2194,7 @@ void m68k_op_divl_32_di(void)
 
 void m68k_op_divl_32_ix(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -2353,6 +2406,7 @@ void m68k_op_divl_32_ix(void)
 
 void m68k_op_divl_32_aw(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -2564,6 +2618,7 @@ void m68k_op_divl_32_aw(void)
 
 void m68k_op_divl_32_al(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -2775,6 +2830,7 @@ void m68k_op_divl_32_al(void)
 
 void m68k_op_divl_32_pcdi(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -2986,6 +3042,7 @@ void m68k_op_divl_32_pcdi(void)
 
 void m68k_op_divl_32_pcix(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -3197,6 +3254,7 @@ void m68k_op_divl_32_pcix(void)
 
 void m68k_op_divl_32_i(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -3412,8 +3470,7 @@ void m68k_op_eor_8_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3426,8 +3483,7 @@ void m68k_op_eor_8_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3440,8 +3496,7 @@ void m68k_op_eor_8_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3454,8 +3509,7 @@ void m68k_op_eor_8_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3468,8 +3522,7 @@ void m68k_op_eor_8_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3482,8 +3535,7 @@ void m68k_op_eor_8_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3496,8 +3548,7 @@ void m68k_op_eor_8_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3510,8 +3561,7 @@ void m68k_op_eor_8_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3524,8 +3574,7 @@ void m68k_op_eor_8_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3538,8 +3587,7 @@ void m68k_op_eor_8_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3549,8 +3597,7 @@ void m68k_op_eor_16_d(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3563,8 +3610,7 @@ void m68k_op_eor_16_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3577,8 +3623,7 @@ void m68k_op_eor_16_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3591,8 +3636,7 @@ void m68k_op_eor_16_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3605,8 +3649,7 @@ void m68k_op_eor_16_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3619,8 +3662,7 @@ void m68k_op_eor_16_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3633,8 +3675,7 @@ void m68k_op_eor_16_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3647,8 +3688,7 @@ void m68k_op_eor_16_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3658,8 +3698,7 @@ void m68k_op_eor_32_d(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3672,8 +3711,7 @@ void m68k_op_eor_32_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3686,8 +3724,7 @@ void m68k_op_eor_32_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3700,8 +3737,7 @@ void m68k_op_eor_32_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3714,8 +3750,7 @@ void m68k_op_eor_32_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3728,8 +3763,7 @@ void m68k_op_eor_32_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3742,8 +3776,7 @@ void m68k_op_eor_32_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3756,8 +3789,7 @@ void m68k_op_eor_32_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3767,8 +3799,7 @@ void m68k_op_eori_8_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3782,8 +3813,7 @@ void m68k_op_eori_8_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3797,8 +3827,7 @@ void m68k_op_eori_8_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3812,8 +3841,7 @@ void m68k_op_eori_8_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3827,8 +3855,7 @@ void m68k_op_eori_8_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3842,8 +3869,7 @@ void m68k_op_eori_8_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3857,8 +3883,7 @@ void m68k_op_eori_8_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3872,8 +3897,7 @@ void m68k_op_eori_8_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3887,8 +3911,7 @@ void m68k_op_eori_8_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3902,8 +3925,7 @@ void m68k_op_eori_8_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3913,8 +3935,7 @@ void m68k_op_eori_16_d(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3928,8 +3949,7 @@ void m68k_op_eori_16_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3943,8 +3963,7 @@ void m68k_op_eori_16_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3958,8 +3977,7 @@ void m68k_op_eori_16_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3973,8 +3991,7 @@ void m68k_op_eori_16_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -3988,8 +4005,7 @@ void m68k_op_eori_16_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -4003,8 +4019,7 @@ void m68k_op_eori_16_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -4018,8 +4033,7 @@ void m68k_op_eori_16_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -4029,8 +4043,7 @@ void m68k_op_eori_32_d(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -4044,8 +4057,7 @@ void m68k_op_eori_32_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -4059,8 +4071,7 @@ void m68k_op_eori_32_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -4074,8 +4085,7 @@ void m68k_op_eori_32_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -4089,8 +4099,7 @@ void m68k_op_eori_32_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -4104,8 +4113,7 @@ void m68k_op_eori_32_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -4119,8 +4127,7 @@ void m68k_op_eori_32_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -4134,19 +4141,20 @@ void m68k_op_eori_32_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
 void m68k_op_eori_8_toc(void)
 {
+	m68ki_sync_flags();
 	m68ki_set_ccr(m68ki_get_ccr() ^ OPER_I_8());
 }
 
 
 void m68k_op_eori_16_tos(void)
 {
+	m68ki_sync_flags();
 	if(FLAG_S)
 	{
 		uint src = OPER_I_16();
@@ -4196,8 +4204,7 @@ void m68k_op_ext_16(void)
 
 	FLAG_N = NFLAG_16(*r_dst);
 	FLAG_Z = MASK_OUT_ABOVE_16(*r_dst);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -4209,13 +4216,13 @@ void m68k_op_ext_32(void)
 
 	FLAG_N = NFLAG_32(*r_dst);
 	FLAG_Z = *r_dst;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
 void m68k_op_extb_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint* r_dst = &DY;
@@ -4454,6 +4461,7 @@ void m68k_op_link_32(void)
 
 void m68k_op_lsr_8_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = MASK_OUT_ABOVE_8(*r_dst);
@@ -4470,6 +4478,7 @@ void m68k_op_lsr_8_s(void)
 
 void m68k_op_lsr_16_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = MASK_OUT_ABOVE_16(*r_dst);
@@ -4486,6 +4495,7 @@ void m68k_op_lsr_16_s(void)
 
 void m68k_op_lsr_32_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = *r_dst;
@@ -4502,6 +4512,7 @@ void m68k_op_lsr_32_s(void)
 
 void m68k_op_lsr_8_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
 	uint src = MASK_OUT_ABOVE_8(*r_dst);
@@ -4539,6 +4550,7 @@ void m68k_op_lsr_8_r(void)
 
 void m68k_op_lsr_16_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
 	uint src = MASK_OUT_ABOVE_16(*r_dst);
@@ -4576,6 +4588,7 @@ void m68k_op_lsr_16_r(void)
 
 void m68k_op_lsr_32_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
 	uint src = *r_dst;
@@ -4612,6 +4625,7 @@ void m68k_op_lsr_32_r(void)
 
 void m68k_op_lsr_16_ai(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = src >> 1;
@@ -4627,6 +4641,7 @@ void m68k_op_lsr_16_ai(void)
 
 void m68k_op_lsr_16_pi(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = src >> 1;
@@ -4642,6 +4657,7 @@ void m68k_op_lsr_16_pi(void)
 
 void m68k_op_lsr_16_pd(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
 	uint res = src >> 1;
@@ -4657,6 +4673,7 @@ void m68k_op_lsr_16_pd(void)
 
 void m68k_op_lsr_16_di(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = src >> 1;
@@ -4672,6 +4689,7 @@ void m68k_op_lsr_16_di(void)
 
 void m68k_op_lsr_16_ix(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
 	uint res = src >> 1;
@@ -4687,6 +4705,7 @@ void m68k_op_lsr_16_ix(void)
 
 void m68k_op_lsr_16_aw(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
 	uint res = src >> 1;
@@ -4702,6 +4721,7 @@ void m68k_op_lsr_16_aw(void)
 
 void m68k_op_lsr_16_al(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
 	uint res = src >> 1;
@@ -4717,6 +4737,7 @@ void m68k_op_lsr_16_al(void)
 
 void m68k_op_lsl_8_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = MASK_OUT_ABOVE_8(*r_dst);
@@ -4733,6 +4754,7 @@ void m68k_op_lsl_8_s(void)
 
 void m68k_op_lsl_16_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = MASK_OUT_ABOVE_16(*r_dst);
@@ -4749,6 +4771,7 @@ void m68k_op_lsl_16_s(void)
 
 void m68k_op_lsl_32_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = *r_dst;
@@ -4765,6 +4788,7 @@ void m68k_op_lsl_32_s(void)
 
 void m68k_op_lsl_8_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
 	uint src = MASK_OUT_ABOVE_8(*r_dst);
@@ -4802,6 +4826,7 @@ void m68k_op_lsl_8_r(void)
 
 void m68k_op_lsl_16_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
 	uint src = MASK_OUT_ABOVE_16(*r_dst);
@@ -4839,6 +4864,7 @@ void m68k_op_lsl_16_r(void)
 
 void m68k_op_lsl_32_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = DX & 0x3f;
 	uint src = *r_dst;
@@ -4875,6 +4901,7 @@ void m68k_op_lsl_32_r(void)
 
 void m68k_op_lsl_16_ai(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(src << 1);
@@ -4890,6 +4917,7 @@ void m68k_op_lsl_16_ai(void)
 
 void m68k_op_lsl_16_pi(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(src << 1);
@@ -4905,6 +4933,7 @@ void m68k_op_lsl_16_pi(void)
 
 void m68k_op_lsl_16_pd(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(src << 1);
@@ -4920,6 +4949,7 @@ void m68k_op_lsl_16_pd(void)
 
 void m68k_op_lsl_16_di(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(src << 1);
@@ -4935,6 +4965,7 @@ void m68k_op_lsl_16_di(void)
 
 void m68k_op_lsl_16_ix(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(src << 1);
@@ -4950,6 +4981,7 @@ void m68k_op_lsl_16_ix(void)
 
 void m68k_op_lsl_16_aw(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(src << 1);
@@ -4965,6 +4997,7 @@ void m68k_op_lsl_16_aw(void)
 
 void m68k_op_lsl_16_al(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(src << 1);
@@ -4987,8 +5020,7 @@ void m68k_op_move_8_d_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5001,8 +5033,7 @@ void m68k_op_move_8_d_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5015,8 +5046,7 @@ void m68k_op_move_8_d_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5029,8 +5059,7 @@ void m68k_op_move_8_d_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5043,8 +5072,7 @@ void m68k_op_move_8_d_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5057,8 +5085,7 @@ void m68k_op_move_8_d_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5071,8 +5098,7 @@ void m68k_op_move_8_d_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5085,8 +5111,7 @@ void m68k_op_move_8_d_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5099,8 +5124,7 @@ void m68k_op_move_8_d_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5113,8 +5137,7 @@ void m68k_op_move_8_d_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5127,8 +5150,7 @@ void m68k_op_move_8_d_pcdi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5141,8 +5163,7 @@ void m68k_op_move_8_d_pcix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5155,8 +5176,7 @@ void m68k_op_move_8_d_i(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5169,8 +5189,7 @@ void m68k_op_move_8_ai_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5183,8 +5202,7 @@ void m68k_op_move_8_ai_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5197,8 +5215,7 @@ void m68k_op_move_8_ai_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5211,8 +5228,7 @@ void m68k_op_move_8_ai_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5225,8 +5241,7 @@ void m68k_op_move_8_ai_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5239,8 +5254,7 @@ void m68k_op_move_8_ai_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5253,8 +5267,7 @@ void m68k_op_move_8_ai_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5267,8 +5280,7 @@ void m68k_op_move_8_ai_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5281,8 +5293,7 @@ void m68k_op_move_8_ai_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5295,8 +5306,7 @@ void m68k_op_move_8_ai_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5309,8 +5319,7 @@ void m68k_op_move_8_ai_pcdi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5323,8 +5332,7 @@ void m68k_op_move_8_ai_pcix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5337,8 +5345,7 @@ void m68k_op_move_8_ai_i(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5351,8 +5358,7 @@ void m68k_op_move_8_pi7_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5365,8 +5371,7 @@ void m68k_op_move_8_pi_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5379,8 +5384,7 @@ void m68k_op_move_8_pi7_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5393,8 +5397,7 @@ void m68k_op_move_8_pi7_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5407,8 +5410,7 @@ void m68k_op_move_8_pi7_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5421,8 +5423,7 @@ void m68k_op_move_8_pi7_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5435,8 +5436,7 @@ void m68k_op_move_8_pi7_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5449,8 +5449,7 @@ void m68k_op_move_8_pi7_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5463,8 +5462,7 @@ void m68k_op_move_8_pi7_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5477,8 +5475,7 @@ void m68k_op_move_8_pi7_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5491,8 +5488,7 @@ void m68k_op_move_8_pi7_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5505,8 +5501,7 @@ void m68k_op_move_8_pi7_pcdi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5519,8 +5514,7 @@ void m68k_op_move_8_pi7_pcix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5533,8 +5527,7 @@ void m68k_op_move_8_pi7_i(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5547,8 +5540,7 @@ void m68k_op_move_8_pi_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5561,8 +5553,7 @@ void m68k_op_move_8_pi_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5575,8 +5566,7 @@ void m68k_op_move_8_pi_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5589,8 +5579,7 @@ void m68k_op_move_8_pi_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5603,8 +5592,7 @@ void m68k_op_move_8_pi_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5617,8 +5605,7 @@ void m68k_op_move_8_pi_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5631,8 +5618,7 @@ void m68k_op_move_8_pi_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5645,8 +5631,7 @@ void m68k_op_move_8_pi_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5659,8 +5644,7 @@ void m68k_op_move_8_pi_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5673,8 +5657,7 @@ void m68k_op_move_8_pi_pcdi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5687,8 +5670,7 @@ void m68k_op_move_8_pi_pcix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5701,8 +5683,7 @@ void m68k_op_move_8_pi_i(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5715,8 +5696,7 @@ void m68k_op_move_8_pd7_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5729,8 +5709,7 @@ void m68k_op_move_8_pd_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5743,8 +5722,7 @@ void m68k_op_move_8_pd7_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5757,8 +5735,7 @@ void m68k_op_move_8_pd7_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5771,8 +5748,7 @@ void m68k_op_move_8_pd7_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5785,8 +5761,7 @@ void m68k_op_move_8_pd7_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5799,8 +5774,7 @@ void m68k_op_move_8_pd7_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5813,8 +5787,7 @@ void m68k_op_move_8_pd7_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5827,8 +5800,7 @@ void m68k_op_move_8_pd7_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5841,8 +5813,7 @@ void m68k_op_move_8_pd7_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5855,8 +5826,7 @@ void m68k_op_move_8_pd7_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5869,8 +5839,7 @@ void m68k_op_move_8_pd7_pcdi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5883,8 +5852,7 @@ void m68k_op_move_8_pd7_pcix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5897,8 +5865,7 @@ void m68k_op_move_8_pd7_i(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5911,8 +5878,7 @@ void m68k_op_move_8_pd_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5925,8 +5891,7 @@ void m68k_op_move_8_pd_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5939,8 +5904,7 @@ void m68k_op_move_8_pd_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5953,8 +5917,7 @@ void m68k_op_move_8_pd_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5967,8 +5930,7 @@ void m68k_op_move_8_pd_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5981,8 +5943,7 @@ void m68k_op_move_8_pd_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -5995,8 +5956,7 @@ void m68k_op_move_8_pd_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6009,8 +5969,7 @@ void m68k_op_move_8_pd_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6023,8 +5982,7 @@ void m68k_op_move_8_pd_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6037,8 +5995,7 @@ void m68k_op_move_8_pd_pcdi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6051,8 +6008,7 @@ void m68k_op_move_8_pd_pcix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6065,8 +6021,7 @@ void m68k_op_move_8_pd_i(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6079,8 +6034,7 @@ void m68k_op_move_8_di_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6093,8 +6047,7 @@ void m68k_op_move_8_di_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6107,8 +6060,7 @@ void m68k_op_move_8_di_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6121,8 +6073,7 @@ void m68k_op_move_8_di_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6135,8 +6086,7 @@ void m68k_op_move_8_di_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6149,8 +6099,7 @@ void m68k_op_move_8_di_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6163,8 +6112,7 @@ void m68k_op_move_8_di_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6177,8 +6125,7 @@ void m68k_op_move_8_di_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6191,8 +6138,7 @@ void m68k_op_move_8_di_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6205,8 +6151,7 @@ void m68k_op_move_8_di_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6219,8 +6164,7 @@ void m68k_op_move_8_di_pcdi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6233,8 +6177,7 @@ void m68k_op_move_8_di_pcix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6247,8 +6190,7 @@ void m68k_op_move_8_di_i(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6261,8 +6203,7 @@ void m68k_op_move_8_ix_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6275,8 +6216,7 @@ void m68k_op_move_8_ix_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6289,8 +6229,7 @@ void m68k_op_move_8_ix_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6303,8 +6242,7 @@ void m68k_op_move_8_ix_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6317,8 +6255,7 @@ void m68k_op_move_8_ix_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6331,8 +6268,7 @@ void m68k_op_move_8_ix_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6345,8 +6281,7 @@ void m68k_op_move_8_ix_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6359,8 +6294,7 @@ void m68k_op_move_8_ix_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6373,8 +6307,7 @@ void m68k_op_move_8_ix_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6387,8 +6320,7 @@ void m68k_op_move_8_ix_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6401,8 +6333,7 @@ void m68k_op_move_8_ix_pcdi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6415,8 +6346,7 @@ void m68k_op_move_8_ix_pcix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6429,8 +6359,7 @@ void m68k_op_move_8_ix_i(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6443,8 +6372,7 @@ void m68k_op_move_8_aw_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6457,8 +6385,7 @@ void m68k_op_move_8_aw_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6471,8 +6398,7 @@ void m68k_op_move_8_aw_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6485,8 +6411,7 @@ void m68k_op_move_8_aw_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6499,8 +6424,7 @@ void m68k_op_move_8_aw_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6513,8 +6437,7 @@ void m68k_op_move_8_aw_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6527,8 +6450,7 @@ void m68k_op_move_8_aw_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6541,8 +6463,7 @@ void m68k_op_move_8_aw_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6555,8 +6476,7 @@ void m68k_op_move_8_aw_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6569,8 +6489,7 @@ void m68k_op_move_8_aw_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6583,8 +6502,7 @@ void m68k_op_move_8_aw_pcdi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6597,8 +6515,7 @@ void m68k_op_move_8_aw_pcix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6611,8 +6528,7 @@ void m68k_op_move_8_aw_i(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6625,8 +6541,7 @@ void m68k_op_move_8_al_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6639,8 +6554,7 @@ void m68k_op_move_8_al_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6653,8 +6567,7 @@ void m68k_op_move_8_al_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6667,8 +6580,7 @@ void m68k_op_move_8_al_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6681,8 +6593,7 @@ void m68k_op_move_8_al_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6695,8 +6606,7 @@ void m68k_op_move_8_al_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6709,8 +6619,7 @@ void m68k_op_move_8_al_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6723,8 +6632,7 @@ void m68k_op_move_8_al_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6737,8 +6645,7 @@ void m68k_op_move_8_al_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6751,8 +6658,7 @@ void m68k_op_move_8_al_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6765,8 +6671,7 @@ void m68k_op_move_8_al_pcdi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6779,8 +6684,7 @@ void m68k_op_move_8_al_pcix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6793,8 +6697,7 @@ void m68k_op_move_8_al_i(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6807,8 +6710,7 @@ void m68k_op_move_16_d_d(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6821,8 +6723,7 @@ void m68k_op_move_16_d_a(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6835,8 +6736,7 @@ void m68k_op_move_16_d_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6849,8 +6749,7 @@ void m68k_op_move_16_d_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6863,8 +6762,7 @@ void m68k_op_move_16_d_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6877,8 +6775,7 @@ void m68k_op_move_16_d_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6891,8 +6788,7 @@ void m68k_op_move_16_d_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6905,8 +6801,7 @@ void m68k_op_move_16_d_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6919,8 +6814,7 @@ void m68k_op_move_16_d_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6933,8 +6827,7 @@ void m68k_op_move_16_d_pcdi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6947,8 +6840,7 @@ void m68k_op_move_16_d_pcix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6961,8 +6853,7 @@ void m68k_op_move_16_d_i(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6975,8 +6866,7 @@ void m68k_op_move_16_ai_d(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -6989,8 +6879,7 @@ void m68k_op_move_16_ai_a(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7003,8 +6892,7 @@ void m68k_op_move_16_ai_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7017,8 +6905,7 @@ void m68k_op_move_16_ai_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7031,8 +6918,7 @@ void m68k_op_move_16_ai_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7045,8 +6931,7 @@ void m68k_op_move_16_ai_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7059,8 +6944,7 @@ void m68k_op_move_16_ai_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7073,8 +6957,7 @@ void m68k_op_move_16_ai_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7087,8 +6970,7 @@ void m68k_op_move_16_ai_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7101,8 +6983,7 @@ void m68k_op_move_16_ai_pcdi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7115,8 +6996,7 @@ void m68k_op_move_16_ai_pcix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7129,8 +7009,7 @@ void m68k_op_move_16_ai_i(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7143,8 +7022,7 @@ void m68k_op_move_16_pi_d(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7157,8 +7035,7 @@ void m68k_op_move_16_pi_a(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7171,8 +7048,7 @@ void m68k_op_move_16_pi_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7185,8 +7061,7 @@ void m68k_op_move_16_pi_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7199,8 +7074,7 @@ void m68k_op_move_16_pi_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7213,8 +7087,7 @@ void m68k_op_move_16_pi_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7227,8 +7100,7 @@ void m68k_op_move_16_pi_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7241,8 +7113,7 @@ void m68k_op_move_16_pi_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7255,8 +7126,7 @@ void m68k_op_move_16_pi_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7269,8 +7139,7 @@ void m68k_op_move_16_pi_pcdi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7283,8 +7152,7 @@ void m68k_op_move_16_pi_pcix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7297,8 +7165,7 @@ void m68k_op_move_16_pi_i(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7311,8 +7178,7 @@ void m68k_op_move_16_pd_d(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7325,8 +7191,7 @@ void m68k_op_move_16_pd_a(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7339,8 +7204,7 @@ void m68k_op_move_16_pd_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7353,8 +7217,7 @@ void m68k_op_move_16_pd_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7367,8 +7230,7 @@ void m68k_op_move_16_pd_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7381,8 +7243,7 @@ void m68k_op_move_16_pd_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7395,8 +7256,7 @@ void m68k_op_move_16_pd_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7409,8 +7269,7 @@ void m68k_op_move_16_pd_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7423,8 +7282,7 @@ void m68k_op_move_16_pd_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7437,8 +7295,7 @@ void m68k_op_move_16_pd_pcdi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7451,8 +7308,7 @@ void m68k_op_move_16_pd_pcix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7465,8 +7321,7 @@ void m68k_op_move_16_pd_i(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7479,8 +7334,7 @@ void m68k_op_move_16_di_d(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7493,8 +7347,7 @@ void m68k_op_move_16_di_a(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7507,8 +7360,7 @@ void m68k_op_move_16_di_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7521,8 +7373,7 @@ void m68k_op_move_16_di_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7535,8 +7386,7 @@ void m68k_op_move_16_di_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7549,8 +7399,7 @@ void m68k_op_move_16_di_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7563,8 +7412,7 @@ void m68k_op_move_16_di_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7577,8 +7425,7 @@ void m68k_op_move_16_di_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7591,8 +7438,7 @@ void m68k_op_move_16_di_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7605,8 +7451,7 @@ void m68k_op_move_16_di_pcdi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7619,8 +7464,7 @@ void m68k_op_move_16_di_pcix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7633,8 +7477,7 @@ void m68k_op_move_16_di_i(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7647,8 +7490,7 @@ void m68k_op_move_16_ix_d(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7661,8 +7503,7 @@ void m68k_op_move_16_ix_a(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7675,8 +7516,7 @@ void m68k_op_move_16_ix_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7689,8 +7529,7 @@ void m68k_op_move_16_ix_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7703,8 +7542,7 @@ void m68k_op_move_16_ix_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7717,8 +7555,7 @@ void m68k_op_move_16_ix_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7731,8 +7568,7 @@ void m68k_op_move_16_ix_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7745,8 +7581,7 @@ void m68k_op_move_16_ix_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7759,8 +7594,7 @@ void m68k_op_move_16_ix_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7773,8 +7607,7 @@ void m68k_op_move_16_ix_pcdi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7787,8 +7620,7 @@ void m68k_op_move_16_ix_pcix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7801,8 +7633,7 @@ void m68k_op_move_16_ix_i(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7815,8 +7646,7 @@ void m68k_op_move_16_aw_d(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7829,8 +7659,7 @@ void m68k_op_move_16_aw_a(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7843,8 +7672,7 @@ void m68k_op_move_16_aw_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7857,8 +7685,7 @@ void m68k_op_move_16_aw_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7871,8 +7698,7 @@ void m68k_op_move_16_aw_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7885,8 +7711,7 @@ void m68k_op_move_16_aw_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7899,8 +7724,7 @@ void m68k_op_move_16_aw_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7913,8 +7737,7 @@ void m68k_op_move_16_aw_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7927,8 +7750,7 @@ void m68k_op_move_16_aw_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7941,8 +7763,7 @@ void m68k_op_move_16_aw_pcdi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7955,8 +7776,7 @@ void m68k_op_move_16_aw_pcix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7969,8 +7789,7 @@ void m68k_op_move_16_aw_i(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7983,8 +7802,7 @@ void m68k_op_move_16_al_d(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -7997,8 +7815,7 @@ void m68k_op_move_16_al_a(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8011,8 +7828,7 @@ void m68k_op_move_16_al_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8025,8 +7841,7 @@ void m68k_op_move_16_al_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8039,8 +7854,7 @@ void m68k_op_move_16_al_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8053,8 +7867,7 @@ void m68k_op_move_16_al_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8067,8 +7880,7 @@ void m68k_op_move_16_al_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8081,8 +7893,7 @@ void m68k_op_move_16_al_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8095,8 +7906,7 @@ void m68k_op_move_16_al_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8109,8 +7919,7 @@ void m68k_op_move_16_al_pcdi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8123,8 +7932,7 @@ void m68k_op_move_16_al_pcix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8137,8 +7945,7 @@ void m68k_op_move_16_al_i(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8151,8 +7958,7 @@ void m68k_op_move_32_d_d(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8165,8 +7971,7 @@ void m68k_op_move_32_d_a(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8179,8 +7984,7 @@ void m68k_op_move_32_d_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8193,8 +7997,7 @@ void m68k_op_move_32_d_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8207,8 +8010,7 @@ void m68k_op_move_32_d_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8221,8 +8023,7 @@ void m68k_op_move_32_d_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8235,8 +8036,7 @@ void m68k_op_move_32_d_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8249,8 +8049,7 @@ void m68k_op_move_32_d_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8263,8 +8062,7 @@ void m68k_op_move_32_d_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8277,8 +8075,7 @@ void m68k_op_move_32_d_pcdi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8291,8 +8088,7 @@ void m68k_op_move_32_d_pcix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8305,8 +8101,7 @@ void m68k_op_move_32_d_i(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8319,8 +8114,7 @@ void m68k_op_move_32_ai_d(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8333,8 +8127,7 @@ void m68k_op_move_32_ai_a(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8347,8 +8140,7 @@ void m68k_op_move_32_ai_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8361,8 +8153,7 @@ void m68k_op_move_32_ai_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8375,8 +8166,7 @@ void m68k_op_move_32_ai_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8389,8 +8179,7 @@ void m68k_op_move_32_ai_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8403,8 +8192,7 @@ void m68k_op_move_32_ai_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8417,8 +8205,7 @@ void m68k_op_move_32_ai_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8431,8 +8218,7 @@ void m68k_op_move_32_ai_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8445,8 +8231,7 @@ void m68k_op_move_32_ai_pcdi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8459,8 +8244,7 @@ void m68k_op_move_32_ai_pcix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8473,8 +8257,7 @@ void m68k_op_move_32_ai_i(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8487,8 +8270,7 @@ void m68k_op_move_32_pi_d(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8501,8 +8283,7 @@ void m68k_op_move_32_pi_a(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8515,8 +8296,7 @@ void m68k_op_move_32_pi_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8529,8 +8309,7 @@ void m68k_op_move_32_pi_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8543,8 +8322,7 @@ void m68k_op_move_32_pi_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8557,8 +8335,7 @@ void m68k_op_move_32_pi_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8571,8 +8348,7 @@ void m68k_op_move_32_pi_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8585,8 +8361,7 @@ void m68k_op_move_32_pi_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8599,8 +8374,7 @@ void m68k_op_move_32_pi_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8613,8 +8387,7 @@ void m68k_op_move_32_pi_pcdi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8627,8 +8400,7 @@ void m68k_op_move_32_pi_pcix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8641,8 +8413,7 @@ void m68k_op_move_32_pi_i(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8655,8 +8426,7 @@ void m68k_op_move_32_pd_d(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8669,8 +8439,7 @@ void m68k_op_move_32_pd_a(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8683,8 +8452,7 @@ void m68k_op_move_32_pd_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8697,8 +8465,7 @@ void m68k_op_move_32_pd_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8711,8 +8478,7 @@ void m68k_op_move_32_pd_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8725,8 +8491,7 @@ void m68k_op_move_32_pd_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8739,8 +8504,7 @@ void m68k_op_move_32_pd_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8753,8 +8517,7 @@ void m68k_op_move_32_pd_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8767,8 +8530,7 @@ void m68k_op_move_32_pd_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8781,8 +8543,7 @@ void m68k_op_move_32_pd_pcdi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8795,8 +8556,7 @@ void m68k_op_move_32_pd_pcix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8809,8 +8569,7 @@ void m68k_op_move_32_pd_i(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8823,8 +8582,7 @@ void m68k_op_move_32_di_d(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8837,8 +8595,7 @@ void m68k_op_move_32_di_a(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8851,8 +8608,7 @@ void m68k_op_move_32_di_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8865,8 +8621,7 @@ void m68k_op_move_32_di_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8879,8 +8634,7 @@ void m68k_op_move_32_di_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8893,8 +8647,7 @@ void m68k_op_move_32_di_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8907,8 +8660,7 @@ void m68k_op_move_32_di_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8921,8 +8673,7 @@ void m68k_op_move_32_di_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8935,8 +8686,7 @@ void m68k_op_move_32_di_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8949,8 +8699,7 @@ void m68k_op_move_32_di_pcdi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8963,8 +8712,7 @@ void m68k_op_move_32_di_pcix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8977,8 +8725,7 @@ void m68k_op_move_32_di_i(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8991,8 +8738,7 @@ void m68k_op_move_32_ix_d(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9005,8 +8751,7 @@ void m68k_op_move_32_ix_a(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9019,8 +8764,7 @@ void m68k_op_move_32_ix_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9033,8 +8777,7 @@ void m68k_op_move_32_ix_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9047,8 +8790,7 @@ void m68k_op_move_32_ix_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9061,8 +8803,7 @@ void m68k_op_move_32_ix_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9075,8 +8816,7 @@ void m68k_op_move_32_ix_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9089,8 +8829,7 @@ void m68k_op_move_32_ix_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9103,8 +8842,7 @@ void m68k_op_move_32_ix_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9117,8 +8855,7 @@ void m68k_op_move_32_ix_pcdi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9131,8 +8868,7 @@ void m68k_op_move_32_ix_pcix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9145,8 +8881,7 @@ void m68k_op_move_32_ix_i(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9159,8 +8894,7 @@ void m68k_op_move_32_aw_d(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9173,8 +8907,7 @@ void m68k_op_move_32_aw_a(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9187,8 +8920,7 @@ void m68k_op_move_32_aw_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9201,8 +8933,7 @@ void m68k_op_move_32_aw_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9215,8 +8946,7 @@ void m68k_op_move_32_aw_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9229,8 +8959,7 @@ void m68k_op_move_32_aw_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9243,8 +8972,7 @@ void m68k_op_move_32_aw_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9257,8 +8985,7 @@ void m68k_op_move_32_aw_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9271,8 +8998,7 @@ void m68k_op_move_32_aw_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9285,8 +9011,7 @@ void m68k_op_move_32_aw_pcdi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9299,8 +9024,7 @@ void m68k_op_move_32_aw_pcix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9313,8 +9037,7 @@ void m68k_op_move_32_aw_i(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9327,8 +9050,7 @@ void m68k_op_move_32_al_d(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9341,8 +9063,7 @@ void m68k_op_move_32_al_a(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9355,8 +9076,7 @@ void m68k_op_move_32_al_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9369,8 +9089,7 @@ void m68k_op_move_32_al_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9383,8 +9102,7 @@ void m68k_op_move_32_al_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9397,8 +9115,7 @@ void m68k_op_move_32_al_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9411,8 +9128,7 @@ void m68k_op_move_32_al_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9425,8 +9141,7 @@ void m68k_op_move_32_al_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9439,8 +9154,7 @@ void m68k_op_move_32_al_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9453,8 +9167,7 @@ void m68k_op_move_32_al_pcdi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9467,8 +9180,7 @@ void m68k_op_move_32_al_pcix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9481,8 +9193,7 @@ void m68k_op_move_32_al_i(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -9632,6 +9343,7 @@ void m68k_op_movea_32_i(void)
 
 void m68k_op_move_16_frc_d(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
 		DY = MASK_OUT_BELOW_16(DY) | m68ki_get_ccr();
@@ -9643,6 +9355,7 @@ void m68k_op_move_16_frc_d(void)
 
 void m68k_op_move_16_frc_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
 		m68ki_write_16(EA_AY_AI_16(), m68ki_get_ccr());
@@ -9654,6 +9367,7 @@ void m68k_op_move_16_frc_ai(void)
 
 void m68k_op_move_16_frc_pi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
 		m68ki_write_16(EA_AY_PI_16(), m68ki_get_ccr());
@@ -9665,6 +9379,7 @@ void m68k_op_move_16_frc_pi(void)
 
 void m68k_op_move_16_frc_pd(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
 		m68ki_write_16(EA_AY_PD_16(), m68ki_get_ccr());
@@ -9676,6 +9391,7 @@ void m68k_op_move_16_frc_pd(void)
 
 void m68k_op_move_16_frc_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
 		m68ki_write_16(EA_AY_DI_16(), m68ki_get_ccr());
@@ -9687,6 +9403,7 @@ void m68k_op_move_16_frc_di(void)
 
 void m68k_op_move_16_frc_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
 		m68ki_write_16(EA_AY_IX_16(), m68ki_get_ccr());
@@ -9698,6 +9415,7 @@ void m68k_op_move_16_frc_ix(void)
 
 void m68k_op_move_16_frc_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
 		m68ki_write_16(EA_AW_16(), m68ki_get_ccr());
@@ -9709,6 +9427,7 @@ void m68k_op_move_16_frc_aw(void)
 
 void m68k_op_move_16_frc_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_010_PLUS(CPU_TYPE))
 	{
 		m68ki_write_16(EA_AL_16(), m68ki_get_ccr());
@@ -9720,72 +9439,84 @@ void m68k_op_move_16_frc_al(void)
 
 void m68k_op_move_16_toc_d(void)
 {
+	m68ki_sync_flags();
 	m68ki_set_ccr(DY);
 }
 
 
 void m68k_op_move_16_toc_ai(void)
 {
+	m68ki_sync_flags();
 	m68ki_set_ccr(OPER_AY_AI_16());
 }
 
 
 void m68k_op_move_16_toc_pi(void)
 {
+	m68ki_sync_flags();
 	m68ki_set_ccr(OPER_AY_PI_16());
 }
 
 
 void m68k_op_move_16_toc_pd(void)
 {
+	m68ki_sync_flags();
 	m68ki_set_ccr(OPER_AY_PD_16());
 }
 
 
 void m68k_op_move_16_toc_di(void)
 {
+	m68ki_sync_flags();
 	m68ki_set_ccr(OPER_AY_DI_16());
 }
 
 
 void m68k_op_move_16_toc_ix(void)
 {
+	m68ki_sync_flags();
 	m68ki_set_ccr(OPER_AY_IX_16());
 }
 
 
 void m68k_op_move_16_toc_aw(void)
 {
+	m68ki_sync_flags();
 	m68ki_set_ccr(OPER_AW_16());
 }
 
 
 void m68k_op_move_16_toc_al(void)
 {
+	m68ki_sync_flags();
 	m68ki_set_ccr(OPER_AL_16());
 }
 
 
 void m68k_op_move_16_toc_pcdi(void)
 {
+	m68ki_sync_flags();
 	m68ki_set_ccr(OPER_PCDI_16());
 }
 
 
 void m68k_op_move_16_toc_pcix(void)
 {
+	m68ki_sync_flags();
 	m68ki_set_ccr(OPER_PCIX_16());
 }
 
 
 void m68k_op_move_16_toc_i(void)
 {
+	m68ki_sync_flags();
 	m68ki_set_ccr(OPER_I_16());
 }
 
 
 void m68k_op_move_16_frs_d(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
 	{
 		DY = MASK_OUT_BELOW_16(DY) | m68ki_get_sr();
@@ -9797,6 +9528,7 @@ void m68k_op_move_16_frs_d(void)
 
 void m68k_op_move_16_frs_ai(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
 	{
 		uint ea = EA_AY_AI_16();
@@ -9809,6 +9541,7 @@ void m68k_op_move_16_frs_ai(void)
 
 void m68k_op_move_16_frs_pi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
 	{
 		uint ea = EA_AY_PI_16();
@@ -9821,6 +9554,7 @@ void m68k_op_move_16_frs_pi(void)
 
 void m68k_op_move_16_frs_pd(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
 	{
 		uint ea = EA_AY_PD_16();
@@ -9833,6 +9567,7 @@ void m68k_op_move_16_frs_pd(void)
 
 void m68k_op_move_16_frs_di(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
 	{
 		uint ea = EA_AY_DI_16();
@@ -9845,6 +9580,7 @@ void m68k_op_move_16_frs_di(void)
 
 void m68k_op_move_16_frs_ix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
 	{
 		uint ea = EA_AY_IX_16();
@@ -9857,6 +9593,7 @@ void m68k_op_move_16_frs_ix(void)
 
 void m68k_op_move_16_frs_aw(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
 	{
 		uint ea = EA_AW_16();
@@ -9869,6 +9606,7 @@ void m68k_op_move_16_frs_aw(void)
 
 void m68k_op_move_16_frs_al(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_000(CPU_TYPE) || FLAG_S)	/* NS990408 */
 	{
 		uint ea = EA_AL_16();
@@ -9881,6 +9619,7 @@ void m68k_op_move_16_frs_al(void)
 
 void m68k_op_move_16_tos_d(void)
 {
+	m68ki_sync_flags();
 	if(FLAG_S)
 	{
 		m68ki_set_sr(DY);
@@ -9892,6 +9631,7 @@ void m68k_op_move_16_tos_d(void)
 
 void m68k_op_move_16_tos_ai(void)
 {
+	m68ki_sync_flags();
 	if(FLAG_S)
 	{
 		uint new_sr = OPER_AY_AI_16();
@@ -9905,6 +9645,7 @@ void m68k_op_move_16_tos_ai(void)
 
 void m68k_op_move_16_tos_pi(void)
 {
+	m68ki_sync_flags();
 	if(FLAG_S)
 	{
 		uint new_sr = OPER_AY_PI_16();
@@ -9918,6 +9659,7 @@ void m68k_op_move_16_tos_pi(void)
 
 void m68k_op_move_16_tos_pd(void)
 {
+	m68ki_sync_flags();
 	if(FLAG_S)
 	{
 		uint new_sr = OPER_AY_PD_16();
@@ -9931,6 +9673,7 @@ void m68k_op_move_16_tos_pd(void)
 
 void m68k_op_move_16_tos_di(void)
 {
+	m68ki_sync_flags();
 	if(FLAG_S)
 	{
 		uint new_sr = OPER_AY_DI_16();
@@ -9944,6 +9687,7 @@ void m68k_op_move_16_tos_di(void)
 
 void m68k_op_move_16_tos_ix(void)
 {
+	m68ki_sync_flags();
 	if(FLAG_S)
 	{
 		uint new_sr = OPER_AY_IX_16();
@@ -9957,6 +9701,7 @@ void m68k_op_move_16_tos_ix(void)
 
 void m68k_op_move_16_tos_aw(void)
 {
+	m68ki_sync_flags();
 	if(FLAG_S)
 	{
 		uint new_sr = OPER_AW_16();
@@ -9970,6 +9715,7 @@ void m68k_op_move_16_tos_aw(void)
 
 void m68k_op_move_16_tos_al(void)
 {
+	m68ki_sync_flags();
 	if(FLAG_S)
 	{
 		uint new_sr = OPER_AL_16();
@@ -9983,6 +9729,7 @@ void m68k_op_move_16_tos_al(void)
 
 void m68k_op_move_16_tos_pcdi(void)
 {
+	m68ki_sync_flags();
 	if(FLAG_S)
 	{
 		uint new_sr = OPER_PCDI_16();
@@ -9996,6 +9743,7 @@ void m68k_op_move_16_tos_pcdi(void)
 
 void m68k_op_move_16_tos_pcix(void)
 {
+	m68ki_sync_flags();
 	if(FLAG_S)
 	{
 		uint new_sr = OPER_PCIX_16();
@@ -10009,6 +9757,7 @@ void m68k_op_move_16_tos_pcix(void)
 
 void m68k_op_move_16_tos_i(void)
 {
+	m68ki_sync_flags();
 	if(FLAG_S)
 	{
 		uint new_sr = OPER_I_16();
@@ -11539,8 +11288,7 @@ void m68k_op_moveq_32(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11553,8 +11301,7 @@ void m68k_op_muls_16_d(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11567,8 +11314,7 @@ void m68k_op_muls_16_ai(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11581,8 +11327,7 @@ void m68k_op_muls_16_pi(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11595,8 +11340,7 @@ void m68k_op_muls_16_pd(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11609,8 +11353,7 @@ void m68k_op_muls_16_di(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11623,8 +11366,7 @@ void m68k_op_muls_16_ix(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11637,8 +11379,7 @@ void m68k_op_muls_16_aw(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11651,8 +11392,7 @@ void m68k_op_muls_16_al(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11665,8 +11405,7 @@ void m68k_op_muls_16_pcdi(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11679,8 +11418,7 @@ void m68k_op_muls_16_pcix(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11693,8 +11431,7 @@ void m68k_op_muls_16_i(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11707,8 +11444,7 @@ void m68k_op_mulu_16_d(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11721,8 +11457,7 @@ void m68k_op_mulu_16_ai(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11735,8 +11470,7 @@ void m68k_op_mulu_16_pi(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11749,8 +11483,7 @@ void m68k_op_mulu_16_pd(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11763,8 +11496,7 @@ void m68k_op_mulu_16_di(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11777,8 +11509,7 @@ void m68k_op_mulu_16_ix(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11791,8 +11522,7 @@ void m68k_op_mulu_16_aw(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11805,8 +11535,7 @@ void m68k_op_mulu_16_al(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11819,8 +11548,7 @@ void m68k_op_mulu_16_pcdi(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11833,8 +11561,7 @@ void m68k_op_mulu_16_pcix(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -11847,13 +11574,13 @@ void m68k_op_mulu_16_i(void)
 
 	FLAG_Z = res;
 	FLAG_N = NFLAG_32(res);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
 void m68k_op_mull_32_d(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -11978,6 +11705,7 @@ void m68k_op_mull_32_d(void)
 
 void m68k_op_mull_32_ai(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -12102,6 +11830,7 @@ void m68k_op_mull_32_ai(void)
 
 void m68k_op_mull_32_pi(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -12226,6 +11955,7 @@ void m68k_op_mull_32_pi(void)
 
 void m68k_op_mull_32_pd(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -12350,6 +12080,7 @@ void m68k_op_mull_32_pd(void)
 
 void m68k_op_mull_32_di(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -12474,6 +12205,7 @@ void m68k_op_mull_32_di(void)
 
 void m68k_op_mull_32_ix(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -12598,6 +12330,7 @@ void m68k_op_mull_32_ix(void)
 
 void m68k_op_mull_32_aw(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -12722,6 +12455,7 @@ void m68k_op_mull_32_aw(void)
 
 void m68k_op_mull_32_al(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -12846,6 +12580,7 @@ void m68k_op_mull_32_al(void)
 
 void m68k_op_mull_32_pcdi(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -12970,6 +12705,7 @@ void m68k_op_mull_32_pcdi(void)
 
 void m68k_op_mull_32_pcix(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -13094,6 +12830,7 @@ void m68k_op_mull_32_pcix(void)
 
 void m68k_op_mull_32_i(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
@@ -7,6 +7,7 @@
 
 void m68k_op_nbcd_8_d(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint dst = *r_dst;
 	uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
@@ -40,6 +41,7 @@ void m68k_op_nbcd_8_d(void)
 
 void m68k_op_nbcd_8_ai(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_AI_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
@@ -73,6 +75,7 @@ void m68k_op_nbcd_8_ai(void)
 
 void m68k_op_nbcd_8_pi(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PI_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
@@ -106,6 +109,7 @@ void m68k_op_nbcd_8_pi(void)
 
 void m68k_op_nbcd_8_pi7(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_A7_PI_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
@@ -139,6 +143,7 @@ void m68k_op_nbcd_8_pi7(void)
 
 void m68k_op_nbcd_8_pd(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
@@ -172,6 +177,7 @@ void m68k_op_nbcd_8_pd(void)
 
 void m68k_op_nbcd_8_pd7(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
@@ -205,6 +211,7 @@ void m68k_op_nbcd_8_pd7(void)
 
 void m68k_op_nbcd_8_di(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_DI_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
@@ -238,6 +245,7 @@ void m68k_op_nbcd_8_di(void)
 
 void m68k_op_nbcd_8_ix(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_IX_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
@@ -271,6 +279,7 @@ void m68k_op_nbcd_8_ix(void)
 
 void m68k_op_nbcd_8_aw(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AW_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
@@ -304,6 +313,7 @@ void m68k_op_nbcd_8_aw(void)
 
 void m68k_op_nbcd_8_al(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AL_8();
 	uint dst = m68ki_read_8(ea);
 	uint res = MASK_OUT_ABOVE_8(0x9a - dst - XFLAG_AS_1());
@@ -337,6 +347,7 @@ void m68k_op_nbcd_8_al(void)
 
 void m68k_op_neg_8_d(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint res = 0 - MASK_OUT_ABOVE_8(*r_dst);
 
@@ -351,6 +362,7 @@ void m68k_op_neg_8_d(void)
 
 void m68k_op_neg_8_ai(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_AI_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src;
@@ -366,6 +378,7 @@ void m68k_op_neg_8_ai(void)
 
 void m68k_op_neg_8_pi(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PI_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src;
@@ -381,6 +394,7 @@ void m68k_op_neg_8_pi(void)
 
 void m68k_op_neg_8_pi7(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_A7_PI_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src;
@@ -396,6 +410,7 @@ void m68k_op_neg_8_pi7(void)
 
 void m68k_op_neg_8_pd(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PD_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src;
@@ -411,6 +426,7 @@ void m68k_op_neg_8_pd(void)
 
 void m68k_op_neg_8_pd7(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_A7_PD_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src;
@@ -426,6 +442,7 @@ void m68k_op_neg_8_pd7(void)
 
 void m68k_op_neg_8_di(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_DI_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src;
@@ -441,6 +458,7 @@ void m68k_op_neg_8_di(void)
 
 void m68k_op_neg_8_ix(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_IX_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src;
@@ -456,6 +474,7 @@ void m68k_op_neg_8_ix(void)
 
 void m68k_op_neg_8_aw(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AW_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src;
@@ -471,6 +490,7 @@ void m68k_op_neg_8_aw(void)
 
 void m68k_op_neg_8_al(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AL_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src;
@@ -486,6 +506,7 @@ void m68k_op_neg_8_al(void)
 
 void m68k_op_neg_16_d(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint res = 0 - MASK_OUT_ABOVE_16(*r_dst);
 
@@ -500,6 +521,7 @@ void m68k_op_neg_16_d(void)
 
 void m68k_op_neg_16_ai(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = 0 - src;
@@ -515,6 +537,7 @@ void m68k_op_neg_16_ai(void)
 
 void m68k_op_neg_16_pi(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = 0 - src;
@@ -530,6 +553,7 @@ void m68k_op_neg_16_pi(void)
 
 void m68k_op_neg_16_pd(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
 	uint res = 0 - src;
@@ -545,6 +569,7 @@ void m68k_op_neg_16_pd(void)
 
 void m68k_op_neg_16_di(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = 0 - src;
@@ -560,6 +585,7 @@ void m68k_op_neg_16_di(void)
 
 void m68k_op_neg_16_ix(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
 	uint res = 0 - src;
@@ -575,6 +601,7 @@ void m68k_op_neg_16_ix(void)
 
 void m68k_op_neg_16_aw(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
 	uint res = 0 - src;
@@ -590,6 +617,7 @@ void m68k_op_neg_16_aw(void)
 
 void m68k_op_neg_16_al(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
 	uint res = 0 - src;
@@ -605,6 +633,7 @@ void m68k_op_neg_16_al(void)
 
 void m68k_op_neg_32_d(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint res = 0 - *r_dst;
 
@@ -619,6 +648,7 @@ void m68k_op_neg_32_d(void)
 
 void m68k_op_neg_32_ai(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_AI_32();
 	uint src = m68ki_read_32(ea);
 	uint res = 0 - src;
@@ -634,6 +664,7 @@ void m68k_op_neg_32_ai(void)
 
 void m68k_op_neg_32_pi(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PI_32();
 	uint src = m68ki_read_32(ea);
 	uint res = 0 - src;
@@ -649,6 +680,7 @@ void m68k_op_neg_32_pi(void)
 
 void m68k_op_neg_32_pd(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PD_32();
 	uint src = m68ki_read_32(ea);
 	uint res = 0 - src;
@@ -664,6 +696,7 @@ void m68k_op_neg_32_pd(void)
 
 void m68k_op_neg_32_di(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_DI_32();
 	uint src = m68ki_read_32(ea);
 	uint res = 0 - src;
@@ -679,6 +712,7 @@ void m68k_op_neg_32_di(void)
 
 void m68k_op_neg_32_ix(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_IX_32();
 	uint src = m68ki_read_32(ea);
 	uint res = 0 - src;
@@ -694,6 +728,7 @@ void m68k_op_neg_32_ix(void)
 
 void m68k_op_neg_32_aw(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AW_32();
 	uint src = m68ki_read_32(ea);
 	uint res = 0 - src;
@@ -709,6 +744,7 @@ void m68k_op_neg_32_aw(void)
 
 void m68k_op_neg_32_al(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AL_32();
 	uint src = m68ki_read_32(ea);
 	uint res = 0 - src;
@@ -724,6 +760,7 @@ void m68k_op_neg_32_al(void)
 
 void m68k_op_negx_8_d(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint res = 0 - MASK_OUT_ABOVE_8(*r_dst) - XFLAG_AS_1();
 
@@ -740,6 +777,7 @@ void m68k_op_negx_8_d(void)
 
 void m68k_op_negx_8_ai(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_AI_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src - XFLAG_AS_1();
@@ -757,6 +795,7 @@ void m68k_op_negx_8_ai(void)
 
 void m68k_op_negx_8_pi(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PI_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src - XFLAG_AS_1();
@@ -774,6 +813,7 @@ void m68k_op_negx_8_pi(void)
 
 void m68k_op_negx_8_pi7(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_A7_PI_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src - XFLAG_AS_1();
@@ -791,6 +831,7 @@ void m68k_op_negx_8_pi7(void)
 
 void m68k_op_negx_8_pd(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PD_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src - XFLAG_AS_1();
@@ -808,6 +849,7 @@ void m68k_op_negx_8_pd(void)
 
 void m68k_op_negx_8_pd7(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_A7_PD_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src - XFLAG_AS_1();
@@ -825,6 +867,7 @@ void m68k_op_negx_8_pd7(void)
 
 void m68k_op_negx_8_di(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_DI_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src - XFLAG_AS_1();
@@ -842,6 +885,7 @@ void m68k_op_negx_8_di(void)
 
 void m68k_op_negx_8_ix(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_IX_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src - XFLAG_AS_1();
@@ -859,6 +903,7 @@ void m68k_op_negx_8_ix(void)
 
 void m68k_op_negx_8_aw(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AW_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src - XFLAG_AS_1();
@@ -876,6 +921,7 @@ void m68k_op_negx_8_aw(void)
 
 void m68k_op_negx_8_al(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AL_8();
 	uint src = m68ki_read_8(ea);
 	uint res = 0 - src - XFLAG_AS_1();
@@ -893,6 +939,7 @@ void m68k_op_negx_8_al(void)
 
 void m68k_op_negx_16_d(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint res = 0 - MASK_OUT_ABOVE_16(*r_dst) - XFLAG_AS_1();
 
@@ -909,6 +956,7 @@ void m68k_op_negx_16_d(void)
 
 void m68k_op_negx_16_ai(void)
 {
+	m68ki_sync_flags();
 	uint ea  = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
@@ -926,6 +974,7 @@ void m68k_op_negx_16_ai(void)
 
 void m68k_op_negx_16_pi(void)
 {
+	m68ki_sync_flags();
 	uint ea  = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
@@ -943,6 +992,7 @@ void m68k_op_negx_16_pi(void)
 
 void m68k_op_negx_16_pd(void)
 {
+	m68ki_sync_flags();
 	uint ea  = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
 	uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
@@ -960,6 +1010,7 @@ void m68k_op_negx_16_pd(void)
 
 void m68k_op_negx_16_di(void)
 {
+	m68ki_sync_flags();
 	uint ea  = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
@@ -977,6 +1028,7 @@ void m68k_op_negx_16_di(void)
 
 void m68k_op_negx_16_ix(void)
 {
+	m68ki_sync_flags();
 	uint ea  = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
 	uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
@@ -994,6 +1046,7 @@ void m68k_op_negx_16_ix(void)
 
 void m68k_op_negx_16_aw(void)
 {
+	m68ki_sync_flags();
 	uint ea  = EA_AW_16();
 	uint src = m68ki_read_16(ea);
 	uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
@@ -1011,6 +1064,7 @@ void m68k_op_negx_16_aw(void)
 
 void m68k_op_negx_16_al(void)
 {
+	m68ki_sync_flags();
 	uint ea  = EA_AL_16();
 	uint src = m68ki_read_16(ea);
 	uint res = 0 - MASK_OUT_ABOVE_16(src) - XFLAG_AS_1();
@@ -1028,6 +1082,7 @@ void m68k_op_negx_16_al(void)
 
 void m68k_op_negx_32_d(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint res = 0 - MASK_OUT_ABOVE_32(*r_dst) - XFLAG_AS_1();
 
@@ -1044,6 +1099,7 @@ void m68k_op_negx_32_d(void)
 
 void m68k_op_negx_32_ai(void)
 {
+	m68ki_sync_flags();
 	uint ea  = EA_AY_AI_32();
 	uint src = m68ki_read_32(ea);
 	uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
@@ -1061,6 +1117,7 @@ void m68k_op_negx_32_ai(void)
 
 void m68k_op_negx_32_pi(void)
 {
+	m68ki_sync_flags();
 	uint ea  = EA_AY_PI_32();
 	uint src = m68ki_read_32(ea);
 	uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
@@ -1078,6 +1135,7 @@ void m68k_op_negx_32_pi(void)
 
 void m68k_op_negx_32_pd(void)
 {
+	m68ki_sync_flags();
 	uint ea  = EA_AY_PD_32();
 	uint src = m68ki_read_32(ea);
 	uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
@@ -1095,6 +1153,7 @@ void m68k_op_negx_32_pd(void)
 
 void m68k_op_negx_32_di(void)
 {
+	m68ki_sync_flags();
 	uint ea  = EA_AY_DI_32();
 	uint src = m68ki_read_32(ea);
 	uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
@@ -1112,6 +1171,7 @@ void m68k_op_negx_32_di(void)
 
 void m68k_op_negx_32_ix(void)
 {
+	m68ki_sync_flags();
 	uint ea  = EA_AY_IX_32();
 	uint src = m68ki_read_32(ea);
 	uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
@@ -1129,6 +1189,7 @@ void m68k_op_negx_32_ix(void)
 
 void m68k_op_negx_32_aw(void)
 {
+	m68ki_sync_flags();
 	uint ea  = EA_AW_32();
 	uint src = m68ki_read_32(ea);
 	uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
@@ -1146,6 +1207,7 @@ void m68k_op_negx_32_aw(void)
 
 void m68k_op_negx_32_al(void)
 {
+	m68ki_sync_flags();
 	uint ea  = EA_AL_32();
 	uint src = m68ki_read_32(ea);
 	uint res = 0 - MASK_OUT_ABOVE_32(src) - XFLAG_AS_1();
@@ -1176,8 +1238,7 @@ void m68k_op_not_8_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1190,8 +1251,7 @@ void m68k_op_not_8_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1204,8 +1264,7 @@ void m68k_op_not_8_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1218,8 +1277,7 @@ void m68k_op_not_8_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1232,8 +1290,7 @@ void m68k_op_not_8_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1246,8 +1303,7 @@ void m68k_op_not_8_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1260,8 +1316,7 @@ void m68k_op_not_8_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1274,8 +1329,7 @@ void m68k_op_not_8_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1288,8 +1342,7 @@ void m68k_op_not_8_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1302,8 +1355,7 @@ void m68k_op_not_8_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1316,8 +1368,7 @@ void m68k_op_not_16_d(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1330,8 +1381,7 @@ void m68k_op_not_16_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1344,8 +1394,7 @@ void m68k_op_not_16_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1358,8 +1407,7 @@ void m68k_op_not_16_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1372,8 +1420,7 @@ void m68k_op_not_16_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1386,8 +1433,7 @@ void m68k_op_not_16_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1400,8 +1446,7 @@ void m68k_op_not_16_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1414,8 +1459,7 @@ void m68k_op_not_16_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1426,8 +1470,7 @@ void m68k_op_not_32_d(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1440,8 +1483,7 @@ void m68k_op_not_32_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1454,8 +1496,7 @@ void m68k_op_not_32_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1468,8 +1509,7 @@ void m68k_op_not_32_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1482,8 +1522,7 @@ void m68k_op_not_32_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1496,8 +1535,7 @@ void m68k_op_not_32_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1510,8 +1548,7 @@ void m68k_op_not_32_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1524,8 +1561,7 @@ void m68k_op_not_32_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1535,8 +1571,7 @@ void m68k_op_or_8_er_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1546,8 +1581,7 @@ void m68k_op_or_8_er_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1557,8 +1591,7 @@ void m68k_op_or_8_er_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1568,8 +1601,7 @@ void m68k_op_or_8_er_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1579,8 +1611,7 @@ void m68k_op_or_8_er_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1590,8 +1621,7 @@ void m68k_op_or_8_er_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1601,8 +1631,7 @@ void m68k_op_or_8_er_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1612,8 +1641,7 @@ void m68k_op_or_8_er_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1623,8 +1651,7 @@ void m68k_op_or_8_er_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1634,8 +1661,7 @@ void m68k_op_or_8_er_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1645,8 +1671,7 @@ void m68k_op_or_8_er_pcdi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1656,8 +1681,7 @@ void m68k_op_or_8_er_pcix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1667,8 +1691,7 @@ void m68k_op_or_8_er_i(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1678,8 +1701,7 @@ void m68k_op_or_16_er_d(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1689,8 +1711,7 @@ void m68k_op_or_16_er_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1700,8 +1721,7 @@ void m68k_op_or_16_er_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1711,8 +1731,7 @@ void m68k_op_or_16_er_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1722,8 +1741,7 @@ void m68k_op_or_16_er_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1733,8 +1751,7 @@ void m68k_op_or_16_er_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1744,8 +1761,7 @@ void m68k_op_or_16_er_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1755,8 +1771,7 @@ void m68k_op_or_16_er_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1766,8 +1781,7 @@ void m68k_op_or_16_er_pcdi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1777,8 +1791,7 @@ void m68k_op_or_16_er_pcix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1788,8 +1801,7 @@ void m68k_op_or_16_er_i(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1799,8 +1811,7 @@ void m68k_op_or_32_er_d(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1810,8 +1821,7 @@ void m68k_op_or_32_er_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1821,8 +1831,7 @@ void m68k_op_or_32_er_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1832,8 +1841,7 @@ void m68k_op_or_32_er_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1843,8 +1851,7 @@ void m68k_op_or_32_er_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1854,8 +1861,7 @@ void m68k_op_or_32_er_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1865,8 +1871,7 @@ void m68k_op_or_32_er_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1876,8 +1881,7 @@ void m68k_op_or_32_er_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1887,8 +1891,7 @@ void m68k_op_or_32_er_pcdi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1898,8 +1901,7 @@ void m68k_op_or_32_er_pcix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1909,8 +1911,7 @@ void m68k_op_or_32_er_i(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1923,8 +1924,7 @@ void m68k_op_or_8_re_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1937,8 +1937,7 @@ void m68k_op_or_8_re_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1951,8 +1950,7 @@ void m68k_op_or_8_re_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1965,8 +1963,7 @@ void m68k_op_or_8_re_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1979,8 +1976,7 @@ void m68k_op_or_8_re_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -1993,8 +1989,7 @@ void m68k_op_or_8_re_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2007,8 +2002,7 @@ void m68k_op_or_8_re_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2021,8 +2015,7 @@ void m68k_op_or_8_re_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2035,8 +2028,7 @@ void m68k_op_or_8_re_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2049,8 +2041,7 @@ void m68k_op_or_16_re_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2063,8 +2054,7 @@ void m68k_op_or_16_re_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2077,8 +2067,7 @@ void m68k_op_or_16_re_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2091,8 +2080,7 @@ void m68k_op_or_16_re_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2105,8 +2093,7 @@ void m68k_op_or_16_re_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2119,8 +2106,7 @@ void m68k_op_or_16_re_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2133,8 +2119,7 @@ void m68k_op_or_16_re_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2147,8 +2132,7 @@ void m68k_op_or_32_re_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2161,8 +2145,7 @@ void m68k_op_or_32_re_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2175,8 +2158,7 @@ void m68k_op_or_32_re_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2189,8 +2171,7 @@ void m68k_op_or_32_re_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2203,8 +2184,7 @@ void m68k_op_or_32_re_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2217,8 +2197,7 @@ void m68k_op_or_32_re_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2231,8 +2210,7 @@ void m68k_op_or_32_re_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2242,8 +2220,7 @@ void m68k_op_ori_8_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2257,8 +2234,7 @@ void m68k_op_ori_8_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2272,8 +2248,7 @@ void m68k_op_ori_8_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2287,8 +2262,7 @@ void m68k_op_ori_8_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2302,8 +2276,7 @@ void m68k_op_ori_8_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2317,8 +2290,7 @@ void m68k_op_ori_8_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2332,8 +2304,7 @@ void m68k_op_ori_8_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2347,8 +2318,7 @@ void m68k_op_ori_8_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2362,8 +2332,7 @@ void m68k_op_ori_8_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2377,8 +2346,7 @@ void m68k_op_ori_8_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2388,8 +2356,7 @@ void m68k_op_ori_16_d(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2403,8 +2370,7 @@ void m68k_op_ori_16_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2418,8 +2384,7 @@ void m68k_op_ori_16_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2433,8 +2398,7 @@ void m68k_op_ori_16_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2448,8 +2412,7 @@ void m68k_op_ori_16_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2463,8 +2426,7 @@ void m68k_op_ori_16_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2478,8 +2440,7 @@ void m68k_op_ori_16_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2493,8 +2454,7 @@ void m68k_op_ori_16_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2504,8 +2464,7 @@ void m68k_op_ori_32_d(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2519,8 +2478,7 @@ void m68k_op_ori_32_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2534,8 +2492,7 @@ void m68k_op_ori_32_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2549,8 +2506,7 @@ void m68k_op_ori_32_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2564,8 +2520,7 @@ void m68k_op_ori_32_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2579,8 +2534,7 @@ void m68k_op_ori_32_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2594,8 +2548,7 @@ void m68k_op_ori_32_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -2609,19 +2562,20 @@ void m68k_op_ori_32_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_C = CFLAG_CLEAR;
-	FLAG_V = VFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
 void m68k_op_ori_8_toc(void)
 {
+	m68ki_sync_flags();
 	m68ki_set_ccr(m68ki_get_ccr() | OPER_I_8());
 }
 
 
 void m68k_op_ori_16_tos(void)
 {
+	m68ki_sync_flags();
 	if(FLAG_S)
 	{
 		uint src = OPER_I_16();
@@ -2785,6 +2739,7 @@ void m68k_op_reset(void)
 
 void m68k_op_ror_8_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint orig_shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint shift = orig_shift & 7;
@@ -2802,6 +2757,7 @@ void m68k_op_ror_8_s(void)
 
 void m68k_op_ror_16_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = MASK_OUT_ABOVE_16(*r_dst);
@@ -2818,6 +2774,7 @@ void m68k_op_ror_16_s(void)
 
 void m68k_op_ror_32_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint64 src = *r_dst;
@@ -2834,6 +2791,7 @@ void m68k_op_ror_32_s(void)
 
 void m68k_op_ror_8_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
 	uint shift = orig_shift & 7;
@@ -2861,6 +2819,7 @@ void m68k_op_ror_8_r(void)
 
 void m68k_op_ror_16_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
 	uint shift = orig_shift & 15;
@@ -2888,6 +2847,7 @@ void m68k_op_ror_16_r(void)
 
 void m68k_op_ror_32_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
 	uint shift = orig_shift & 31;
@@ -2915,6 +2875,7 @@ void m68k_op_ror_32_r(void)
 
 void m68k_op_ror_16_ai(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROR_16(src, 1);
@@ -2930,6 +2891,7 @@ void m68k_op_ror_16_ai(void)
 
 void m68k_op_ror_16_pi(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROR_16(src, 1);
@@ -2945,6 +2907,7 @@ void m68k_op_ror_16_pi(void)
 
 void m68k_op_ror_16_pd(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROR_16(src, 1);
@@ -2960,6 +2923,7 @@ void m68k_op_ror_16_pd(void)
 
 void m68k_op_ror_16_di(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROR_16(src, 1);
@@ -2975,6 +2939,7 @@ void m68k_op_ror_16_di(void)
 
 void m68k_op_ror_16_ix(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROR_16(src, 1);
@@ -2990,6 +2955,7 @@ void m68k_op_ror_16_ix(void)
 
 void m68k_op_ror_16_aw(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROR_16(src, 1);
@@ -3005,6 +2971,7 @@ void m68k_op_ror_16_aw(void)
 
 void m68k_op_ror_16_al(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROR_16(src, 1);
@@ -3020,6 +2987,7 @@ void m68k_op_ror_16_al(void)
 
 void m68k_op_rol_8_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint orig_shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint shift = orig_shift & 7;
@@ -3037,6 +3005,7 @@ void m68k_op_rol_8_s(void)
 
 void m68k_op_rol_16_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = MASK_OUT_ABOVE_16(*r_dst);
@@ -3053,6 +3022,7 @@ void m68k_op_rol_16_s(void)
 
 void m68k_op_rol_32_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint64 src = *r_dst;
@@ -3069,6 +3039,7 @@ void m68k_op_rol_32_s(void)
 
 void m68k_op_rol_8_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
 	uint shift = orig_shift & 7;
@@ -3104,6 +3075,7 @@ void m68k_op_rol_8_r(void)
 
 void m68k_op_rol_16_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
 	uint shift = orig_shift & 15;
@@ -3139,6 +3111,7 @@ void m68k_op_rol_16_r(void)
 
 void m68k_op_rol_32_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
 	uint shift = orig_shift & 31;
@@ -3167,6 +3140,7 @@ void m68k_op_rol_32_r(void)
 
 void m68k_op_rol_16_ai(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
@@ -3182,6 +3156,7 @@ void m68k_op_rol_16_ai(void)
 
 void m68k_op_rol_16_pi(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
@@ -3197,6 +3172,7 @@ void m68k_op_rol_16_pi(void)
 
 void m68k_op_rol_16_pd(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
@@ -3212,6 +3188,7 @@ void m68k_op_rol_16_pd(void)
 
 void m68k_op_rol_16_di(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
@@ -3227,6 +3204,7 @@ void m68k_op_rol_16_di(void)
 
 void m68k_op_rol_16_ix(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
@@ -3242,6 +3220,7 @@ void m68k_op_rol_16_ix(void)
 
 void m68k_op_rol_16_aw(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
@@ -3257,6 +3236,7 @@ void m68k_op_rol_16_aw(void)
 
 void m68k_op_rol_16_al(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
 	uint res = MASK_OUT_ABOVE_16(ROL_16(src, 1));
@@ -3272,6 +3252,7 @@ void m68k_op_rol_16_al(void)
 
 void m68k_op_roxr_8_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = MASK_OUT_ABOVE_8(*r_dst);
@@ -3290,6 +3271,7 @@ void m68k_op_roxr_8_s(void)
 
 void m68k_op_roxr_16_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = MASK_OUT_ABOVE_16(*r_dst);
@@ -3308,6 +3290,7 @@ void m68k_op_roxr_16_s(void)
 
 void m68k_op_roxr_32_s(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	uint*  r_dst = &DY;
@@ -3347,6 +3330,7 @@ void m68k_op_roxr_32_s(void)
 
 void m68k_op_roxr_8_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
 
@@ -3377,6 +3361,7 @@ void m68k_op_roxr_8_r(void)
 
 void m68k_op_roxr_16_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
 
@@ -3407,6 +3392,7 @@ void m68k_op_roxr_16_r(void)
 
 void m68k_op_roxr_32_r(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	uint*  r_dst = &DY;
@@ -3467,6 +3453,7 @@ void m68k_op_roxr_32_r(void)
 
 void m68k_op_roxr_16_ai(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
@@ -3484,6 +3471,7 @@ void m68k_op_roxr_16_ai(void)
 
 void m68k_op_roxr_16_pi(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
@@ -3501,6 +3489,7 @@ void m68k_op_roxr_16_pi(void)
 
 void m68k_op_roxr_16_pd(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
@@ -3518,6 +3507,7 @@ void m68k_op_roxr_16_pd(void)
 
 void m68k_op_roxr_16_di(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
@@ -3535,6 +3525,7 @@ void m68k_op_roxr_16_di(void)
 
 void m68k_op_roxr_16_ix(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
@@ -3552,6 +3543,7 @@ void m68k_op_roxr_16_ix(void)
 
 void m68k_op_roxr_16_aw(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
@@ -3569,6 +3561,7 @@ void m68k_op_roxr_16_aw(void)
 
 void m68k_op_roxr_16_al(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROR_17(src | (XFLAG_AS_1() << 16), 1);
@@ -3586,6 +3579,7 @@ void m68k_op_roxr_16_al(void)
 
 void m68k_op_roxl_8_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = MASK_OUT_ABOVE_8(*r_dst);
@@ -3604,6 +3598,7 @@ void m68k_op_roxl_8_s(void)
 
 void m68k_op_roxl_16_s(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint shift = (((REG_IR >> 9) - 1) & 7) + 1;
 	uint src = MASK_OUT_ABOVE_16(*r_dst);
@@ -3622,6 +3617,7 @@ void m68k_op_roxl_16_s(void)
 
 void m68k_op_roxl_32_s(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	uint*  r_dst = &DY;
@@ -3661,6 +3657,7 @@ void m68k_op_roxl_32_s(void)
 
 void m68k_op_roxl_8_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
 
@@ -3692,6 +3689,7 @@ void m68k_op_roxl_8_r(void)
 
 void m68k_op_roxl_16_r(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 	uint orig_shift = DX & 0x3f;
 
@@ -3722,6 +3720,7 @@ void m68k_op_roxl_16_r(void)
 
 void m68k_op_roxl_32_r(void)
 {
+	m68ki_sync_flags();
 #if M68K_USE_64_BIT
 
 	uint*  r_dst = &DY;
@@ -3782,6 +3781,7 @@ void m68k_op_roxl_32_r(void)
 
 void m68k_op_roxl_16_ai(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_AI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
@@ -3799,6 +3799,7 @@ void m68k_op_roxl_16_ai(void)
 
 void m68k_op_roxl_16_pi(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
@@ -3816,6 +3817,7 @@ void m68k_op_roxl_16_pi(void)
 
 void m68k_op_roxl_16_pd(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_PD_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
@@ -3833,6 +3835,7 @@ void m68k_op_roxl_16_pd(void)
 
 void m68k_op_roxl_16_di(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_DI_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
@@ -3850,6 +3853,7 @@ void m68k_op_roxl_16_di(void)
 
 void m68k_op_roxl_16_ix(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AY_IX_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
@@ -3867,6 +3871,7 @@ void m68k_op_roxl_16_ix(void)
 
 void m68k_op_roxl_16_aw(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AW_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
@@ -3884,6 +3889,7 @@ void m68k_op_roxl_16_aw(void)
 
 void m68k_op_roxl_16_al(void)
 {
+	m68ki_sync_flags();
 	uint ea = EA_AL_16();
 	uint src = m68ki_read_16(ea);
 	uint res = ROL_17(src | (XFLAG_AS_1() << 16), 1);
@@ -3916,6 +3922,7 @@ void m68k_op_rtd_32(void)
 
 void m68k_op_rte_32(void)
 {
+	m68ki_sync_flags();
 	if(FLAG_S)
 	{
 		uint new_sr;
@@ -4015,6 +4022,7 @@ void m68k_op_rtm_32(void)
 
 void m68k_op_rtr_32(void)
 {
+	m68ki_sync_flags();
 	m68ki_trace_t0();				   /* auto-disable (see m68kcpu.h) */
 	m68ki_set_ccr(m68ki_pull_16());
 	m68ki_jump(m68ki_pull_32());
@@ -4030,6 +4038,7 @@ void m68k_op_rts_32(void)
 
 void m68k_op_sbcd_8_rr(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = DY;
 	uint dst = *r_dst;
@@ -4056,6 +4065,7 @@ void m68k_op_sbcd_8_rr(void)
 
 void m68k_op_sbcd_8_mm_ax7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PD_8();
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -4082,6 +4092,7 @@ void m68k_op_sbcd_8_mm_ax7(void)
 
 void m68k_op_sbcd_8_mm_ay7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_A7_PD_8();
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -4108,6 +4119,7 @@ void m68k_op_sbcd_8_mm_ay7(void)
 
 void m68k_op_sbcd_8_mm_axy7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_A7_PD_8();
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -4134,6 +4146,7 @@ void m68k_op_sbcd_8_mm_axy7(void)
 
 void m68k_op_sbcd_8_mm(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PD_8();
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -4280,6 +4293,7 @@ void m68k_op_sf_8_al(void)
 
 void m68k_op_shi_8_d(void)
 {
+	m68ki_sync_flags();
 	if(COND_HI())
 	{
 		DY |= 0xff;
@@ -4292,6 +4306,7 @@ void m68k_op_shi_8_d(void)
 
 void m68k_op_sls_8_d(void)
 {
+	m68ki_sync_flags();
 	if(COND_LS())
 	{
 		DY |= 0xff;
@@ -4304,6 +4319,7 @@ void m68k_op_sls_8_d(void)
 
 void m68k_op_scc_8_d(void)
 {
+	m68ki_sync_flags();
 	if(COND_CC())
 	{
 		DY |= 0xff;
@@ -4316,6 +4332,7 @@ void m68k_op_scc_8_d(void)
 
 void m68k_op_scs_8_d(void)
 {
+	m68ki_sync_flags();
 	if(COND_CS())
 	{
 		DY |= 0xff;
@@ -4352,6 +4369,7 @@ void m68k_op_seq_8_d(void)
 
 void m68k_op_svc_8_d(void)
 {
+	m68ki_sync_flags();
 	if(COND_VC())
 	{
 		DY |= 0xff;
@@ -4364,6 +4382,7 @@ void m68k_op_svc_8_d(void)
 
 void m68k_op_svs_8_d(void)
 {
+	m68ki_sync_flags();
 	if(COND_VS())
 	{
 		DY |= 0xff;
@@ -4400,6 +4419,7 @@ void m68k_op_smi_8_d(void)
 
 void m68k_op_sge_8_d(void)
 {
+	m68ki_sync_flags();
 	if(COND_GE())
 	{
 		DY |= 0xff;
@@ -4412,6 +4432,7 @@ void m68k_op_sge_8_d(void)
 
 void m68k_op_slt_8_d(void)
 {
+	m68ki_sync_flags();
 	if(COND_LT())
 	{
 		DY |= 0xff;
@@ -4424,6 +4445,7 @@ void m68k_op_slt_8_d(void)
 
 void m68k_op_sgt_8_d(void)
 {
+	m68ki_sync_flags();
 	if(COND_GT())
 	{
 		DY |= 0xff;
@@ -4436,6 +4458,7 @@ void m68k_op_sgt_8_d(void)
 
 void m68k_op_sle_8_d(void)
 {
+	m68ki_sync_flags();
 	if(COND_LE())
 	{
 		DY |= 0xff;
@@ -4448,216 +4471,252 @@ void m68k_op_sle_8_d(void)
 
 void m68k_op_shi_8_ai(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_AI_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_shi_8_pi(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PI_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_shi_8_pi7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PI_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_shi_8_pd(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PD_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_shi_8_pd7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PD_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_shi_8_di(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_DI_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_shi_8_ix(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_IX_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_shi_8_aw(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AW_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_shi_8_al(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AL_8(), COND_HI() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_ai(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_AI_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_pi(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PI_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_pi7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PI_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_pd(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PD_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_pd7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PD_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_di(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_DI_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_ix(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_IX_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_aw(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AW_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_sls_8_al(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AL_8(), COND_LS() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_ai(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_AI_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_pi(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PI_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_pi7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PI_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_pd(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PD_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_pd7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PD_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_di(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_DI_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_ix(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_IX_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_aw(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AW_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scc_8_al(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AL_8(), COND_CC() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_ai(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_AI_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_pi(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PI_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_pi7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PI_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_pd(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PD_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_pd7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PD_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_di(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_DI_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_ix(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_IX_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_aw(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AW_8(), COND_CS() ? 0xff : 0);
 }
 
 
 void m68k_op_scs_8_al(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AL_8(), COND_CS() ? 0xff : 0);
 }
 
@@ -4772,108 +4831,126 @@ void m68k_op_seq_8_al(void)
 
 void m68k_op_svc_8_ai(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_AI_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_pi(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PI_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_pi7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PI_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_pd(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PD_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_pd7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PD_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_di(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_DI_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_ix(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_IX_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_aw(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AW_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svc_8_al(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AL_8(), COND_VC() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_ai(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_AI_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_pi(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PI_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_pi7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PI_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_pd(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PD_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_pd7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PD_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_di(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_DI_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_ix(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_IX_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_aw(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AW_8(), COND_VS() ? 0xff : 0);
 }
 
 
 void m68k_op_svs_8_al(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AL_8(), COND_VS() ? 0xff : 0);
 }
 
@@ -4988,222 +5065,259 @@ void m68k_op_smi_8_al(void)
 
 void m68k_op_sge_8_ai(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_AI_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_pi(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PI_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_pi7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PI_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_pd(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PD_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_pd7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PD_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_di(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_DI_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_ix(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_IX_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_aw(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AW_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_sge_8_al(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AL_8(), COND_GE() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_ai(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_AI_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_pi(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PI_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_pi7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PI_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_pd(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PD_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_pd7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PD_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_di(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_DI_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_ix(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_IX_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_aw(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AW_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_slt_8_al(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AL_8(), COND_LT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_ai(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_AI_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_pi(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PI_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_pi7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PI_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_pd(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PD_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_pd7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PD_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_di(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_DI_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_ix(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_IX_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_aw(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AW_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sgt_8_al(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AL_8(), COND_GT() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_ai(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_AI_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_pi(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PI_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_pi7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PI_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_pd(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_PD_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_pd7(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_A7_PD_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_di(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_DI_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_ix(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AY_IX_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_aw(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AW_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_sle_8_al(void)
 {
+	m68ki_sync_flags();
 	m68ki_write_8(EA_AL_8(), COND_LE() ? 0xff : 0);
 }
 
 
 void m68k_op_stop(void)
 {
+	m68ki_sync_flags();
 	if(FLAG_S)
 	{
 		uint new_sr = OPER_I_16();
@@ -5228,8 +5342,7 @@ void m68k_op_sub_8_er_d(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -5244,8 +5357,7 @@ void m68k_op_sub_8_er_ai(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -5260,8 +5372,7 @@ void m68k_op_sub_8_er_pi(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -5276,8 +5387,7 @@ void m68k_op_sub_8_er_pi7(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -5292,8 +5402,7 @@ void m68k_op_sub_8_er_pd(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -5308,8 +5417,7 @@ void m68k_op_sub_8_er_pd7(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -5324,8 +5432,7 @@ void m68k_op_sub_8_er_di(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -5340,8 +5447,7 @@ void m68k_op_sub_8_er_ix(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -5356,8 +5462,7 @@ void m68k_op_sub_8_er_aw(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -5372,8 +5477,7 @@ void m68k_op_sub_8_er_al(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -5388,8 +5492,7 @@ void m68k_op_sub_8_er_pcdi(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -5404,8 +5507,7 @@ void m68k_op_sub_8_er_pcix(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -5420,8 +5522,7 @@ void m68k_op_sub_8_er_i(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
@@ -5436,8 +5537,7 @@ void m68k_op_sub_16_er_d(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -5452,8 +5552,7 @@ void m68k_op_sub_16_er_a(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -5468,8 +5567,7 @@ void m68k_op_sub_16_er_ai(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -5484,8 +5582,7 @@ void m68k_op_sub_16_er_pi(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -5500,8 +5597,7 @@ void m68k_op_sub_16_er_pd(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -5516,8 +5612,7 @@ void m68k_op_sub_16_er_di(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -5532,8 +5627,7 @@ void m68k_op_sub_16_er_ix(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -5548,8 +5642,7 @@ void m68k_op_sub_16_er_aw(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -5564,8 +5657,7 @@ void m68k_op_sub_16_er_al(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -5580,8 +5672,7 @@ void m68k_op_sub_16_er_pcdi(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -5596,8 +5687,7 @@ void m68k_op_sub_16_er_pcix(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -5612,8 +5702,7 @@ void m68k_op_sub_16_er_i(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
@@ -5628,8 +5717,7 @@ void m68k_op_sub_32_er_d(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -5644,8 +5732,7 @@ void m68k_op_sub_32_er_a(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -5660,8 +5747,7 @@ void m68k_op_sub_32_er_ai(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -5676,8 +5762,7 @@ void m68k_op_sub_32_er_pi(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -5692,8 +5777,7 @@ void m68k_op_sub_32_er_pd(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -5708,8 +5792,7 @@ void m68k_op_sub_32_er_di(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -5724,8 +5807,7 @@ void m68k_op_sub_32_er_ix(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -5740,8 +5822,7 @@ void m68k_op_sub_32_er_aw(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -5756,8 +5837,7 @@ void m68k_op_sub_32_er_al(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -5772,8 +5852,7 @@ void m68k_op_sub_32_er_pcdi(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -5788,8 +5867,7 @@ void m68k_op_sub_32_er_pcix(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -5804,8 +5882,7 @@ void m68k_op_sub_32_er_i(void)
 	uint res = dst - src;
 
 	FLAG_N = NFLAG_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
 
 	*r_dst = FLAG_Z;
@@ -5821,8 +5898,7 @@ void m68k_op_sub_8_re_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -5837,8 +5913,7 @@ void m68k_op_sub_8_re_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -5853,8 +5928,7 @@ void m68k_op_sub_8_re_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -5869,8 +5943,7 @@ void m68k_op_sub_8_re_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -5885,8 +5958,7 @@ void m68k_op_sub_8_re_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -5901,8 +5973,7 @@ void m68k_op_sub_8_re_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -5917,8 +5988,7 @@ void m68k_op_sub_8_re_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -5933,8 +6003,7 @@ void m68k_op_sub_8_re_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -5949,8 +6018,7 @@ void m68k_op_sub_8_re_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -5965,8 +6033,7 @@ void m68k_op_sub_16_re_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -5981,8 +6048,7 @@ void m68k_op_sub_16_re_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -5997,8 +6063,7 @@ void m68k_op_sub_16_re_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -6013,8 +6078,7 @@ void m68k_op_sub_16_re_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -6029,8 +6093,7 @@ void m68k_op_sub_16_re_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -6045,8 +6108,7 @@ void m68k_op_sub_16_re_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -6061,8 +6123,7 @@ void m68k_op_sub_16_re_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -6077,8 +6138,7 @@ void m68k_op_sub_32_re_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -6093,8 +6153,7 @@ void m68k_op_sub_32_re_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -6109,8 +6168,7 @@ void m68k_op_sub_32_re_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -6125,8 +6183,7 @@ void m68k_op_sub_32_re_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -6141,8 +6198,7 @@ void m68k_op_sub_32_re_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -6157,8 +6213,7 @@ void m68k_op_sub_32_re_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -6173,8 +6228,7 @@ void m68k_op_sub_32_re_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -6401,8 +6455,7 @@ void m68k_op_subi_8_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
 }
@@ -6417,8 +6470,7 @@ void m68k_op_subi_8_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6433,8 +6485,7 @@ void m68k_op_subi_8_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6449,8 +6500,7 @@ void m68k_op_subi_8_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6465,8 +6515,7 @@ void m68k_op_subi_8_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6481,8 +6530,7 @@ void m68k_op_subi_8_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6497,8 +6545,7 @@ void m68k_op_subi_8_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6513,8 +6560,7 @@ void m68k_op_subi_8_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6529,8 +6575,7 @@ void m68k_op_subi_8_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6545,8 +6590,7 @@ void m68k_op_subi_8_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6561,8 +6605,7 @@ void m68k_op_subi_16_d(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
 }
@@ -6577,8 +6620,7 @@ void m68k_op_subi_16_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -6593,8 +6635,7 @@ void m68k_op_subi_16_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -6609,8 +6650,7 @@ void m68k_op_subi_16_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -6625,8 +6665,7 @@ void m68k_op_subi_16_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -6641,8 +6680,7 @@ void m68k_op_subi_16_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -6657,8 +6695,7 @@ void m68k_op_subi_16_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -6673,8 +6710,7 @@ void m68k_op_subi_16_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -6689,8 +6725,7 @@ void m68k_op_subi_32_d(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	*r_dst = FLAG_Z;
 }
@@ -6705,8 +6740,7 @@ void m68k_op_subi_32_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -6721,8 +6755,7 @@ void m68k_op_subi_32_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -6737,8 +6770,7 @@ void m68k_op_subi_32_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -6753,8 +6785,7 @@ void m68k_op_subi_32_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -6769,8 +6800,7 @@ void m68k_op_subi_32_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -6785,8 +6815,7 @@ void m68k_op_subi_32_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -6801,8 +6830,7 @@ void m68k_op_subi_32_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -6817,8 +6845,7 @@ void m68k_op_subq_8_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	*r_dst = MASK_OUT_BELOW_8(*r_dst) | FLAG_Z;
 }
@@ -6833,8 +6860,7 @@ void m68k_op_subq_8_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6849,8 +6875,7 @@ void m68k_op_subq_8_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6865,8 +6890,7 @@ void m68k_op_subq_8_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6881,8 +6905,7 @@ void m68k_op_subq_8_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6897,8 +6920,7 @@ void m68k_op_subq_8_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6913,8 +6935,7 @@ void m68k_op_subq_8_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6929,8 +6950,7 @@ void m68k_op_subq_8_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6945,8 +6965,7 @@ void m68k_op_subq_8_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6961,8 +6980,7 @@ void m68k_op_subq_8_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = MASK_OUT_ABOVE_8(res);
-	FLAG_X = FLAG_C = CFLAG_8(res);
-	FLAG_V = VFLAG_SUB_8(src, dst, res);
+	m68ki_lazy_sub_8(src, dst, res);
 
 	m68ki_write_8(ea, FLAG_Z);
 }
@@ -6977,8 +6995,7 @@ void m68k_op_subq_16_d(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	*r_dst = MASK_OUT_BELOW_16(*r_dst) | FLAG_Z;
 }
@@ -7001,8 +7018,7 @@ void m68k_op_subq_16_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -7017,8 +7033,7 @@ void m68k_op_subq_16_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -7033,8 +7048,7 @@ void m68k_op_subq_16_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -7049,8 +7063,7 @@ void m68k_op_subq_16_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -7065,8 +7078,7 @@ void m68k_op_subq_16_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -7081,8 +7093,7 @@ void m68k_op_subq_16_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -7097,8 +7108,7 @@ void m68k_op_subq_16_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = MASK_OUT_ABOVE_16(res);
-	FLAG_X = FLAG_C = CFLAG_16(res);
-	FLAG_V = VFLAG_SUB_16(src, dst, res);
+	m68ki_lazy_sub_16(src, dst, res);
 
 	m68ki_write_16(ea, FLAG_Z);
 }
@@ -7113,8 +7123,7 @@ void m68k_op_subq_32_d(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	*r_dst = FLAG_Z;
 }
@@ -7137,8 +7146,7 @@ void m68k_op_subq_32_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -7153,8 +7161,7 @@ void m68k_op_subq_32_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -7169,8 +7176,7 @@ void m68k_op_subq_32_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -7185,8 +7191,7 @@ void m68k_op_subq_32_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -7201,8 +7206,7 @@ void m68k_op_subq_32_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -7217,8 +7221,7 @@ void m68k_op_subq_32_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -7233,8 +7236,7 @@ void m68k_op_subq_32_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = MASK_OUT_ABOVE_32(res);
-	FLAG_X = FLAG_C = CFLAG_SUB_32(src, dst, res);
-	FLAG_V = VFLAG_SUB_32(src, dst, res);
+	m68ki_lazy_sub_32(src, dst, res);
 
 	m68ki_write_32(ea, FLAG_Z);
 }
@@ -7242,6 +7244,7 @@ void m68k_op_subq_32_al(void)
 
 void m68k_op_subx_8_rr(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_8(DY);
 	uint dst = MASK_OUT_ABOVE_8(*r_dst);
@@ -7260,6 +7263,7 @@ void m68k_op_subx_8_rr(void)
 
 void m68k_op_subx_16_rr(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = MASK_OUT_ABOVE_16(DY);
 	uint dst = MASK_OUT_ABOVE_16(*r_dst);
@@ -7278,6 +7282,7 @@ void m68k_op_subx_16_rr(void)
 
 void m68k_op_subx_32_rr(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DX;
 	uint src = DY;
 	uint dst = *r_dst;
@@ -7296,6 +7301,7 @@ void m68k_op_subx_32_rr(void)
 
 void m68k_op_subx_8_mm_ax7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PD_8();
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -7314,6 +7320,7 @@ void m68k_op_subx_8_mm_ax7(void)
 
 void m68k_op_subx_8_mm_ay7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_A7_PD_8();
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -7332,6 +7339,7 @@ void m68k_op_subx_8_mm_ay7(void)
 
 void m68k_op_subx_8_mm_axy7(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_A7_PD_8();
 	uint ea  = EA_A7_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -7350,6 +7358,7 @@ void m68k_op_subx_8_mm_axy7(void)
 
 void m68k_op_subx_8_mm(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PD_8();
 	uint ea  = EA_AX_PD_8();
 	uint dst = m68ki_read_8(ea);
@@ -7368,6 +7377,7 @@ void m68k_op_subx_8_mm(void)
 
 void m68k_op_subx_16_mm(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PD_16();
 	uint ea  = EA_AX_PD_16();
 	uint dst = m68ki_read_16(ea);
@@ -7386,6 +7396,7 @@ void m68k_op_subx_16_mm(void)
 
 void m68k_op_subx_32_mm(void)
 {
+	m68ki_sync_flags();
 	uint src = OPER_AY_PD_32();
 	uint ea  = EA_AX_PD_32();
 	uint dst = m68ki_read_32(ea);
@@ -7404,6 +7415,7 @@ void m68k_op_subx_32_mm(void)
 
 void m68k_op_swap_32(void)
 {
+	m68ki_sync_flags();
 	uint* r_dst = &DY;
 
 	FLAG_Z = MASK_OUT_ABOVE_32(*r_dst<<16);
@@ -7422,8 +7434,7 @@ void m68k_op_tas_8_d(void)
 
 	FLAG_Z = MASK_OUT_ABOVE_8(*r_dst);
 	FLAG_N = NFLAG_8(*r_dst);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	*r_dst |= 0x80;
 }
 
@@ -7435,8 +7446,7 @@ void m68k_op_tas_8_ai(void)
 
 	FLAG_Z = dst;
 	FLAG_N = NFLAG_8(dst);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	m68ki_write_8(ea, dst | 0x80);
 }
 
@@ -7448,8 +7458,7 @@ void m68k_op_tas_8_pi(void)
 
 	FLAG_Z = dst;
 	FLAG_N = NFLAG_8(dst);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	m68ki_write_8(ea, dst | 0x80);
 }
 
@@ -7461,8 +7470,7 @@ void m68k_op_tas_8_pi7(void)
 
 	FLAG_Z = dst;
 	FLAG_N = NFLAG_8(dst);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	m68ki_write_8(ea, dst | 0x80);
 }
 
@@ -7474,8 +7482,7 @@ void m68k_op_tas_8_pd(void)
 
 	FLAG_Z = dst;
 	FLAG_N = NFLAG_8(dst);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	m68ki_write_8(ea, dst | 0x80);
 }
 
@@ -7487,8 +7494,7 @@ void m68k_op_tas_8_pd7(void)
 
 	FLAG_Z = dst;
 	FLAG_N = NFLAG_8(dst);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	m68ki_write_8(ea, dst | 0x80);
 }
 
@@ -7500,8 +7506,7 @@ void m68k_op_tas_8_di(void)
 
 	FLAG_Z = dst;
 	FLAG_N = NFLAG_8(dst);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	m68ki_write_8(ea, dst | 0x80);
 }
 
@@ -7513,8 +7518,7 @@ void m68k_op_tas_8_ix(void)
 
 	FLAG_Z = dst;
 	FLAG_N = NFLAG_8(dst);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	m68ki_write_8(ea, dst | 0x80);
 }
 
@@ -7526,8 +7530,7 @@ void m68k_op_tas_8_aw(void)
 
 	FLAG_Z = dst;
 	FLAG_N = NFLAG_8(dst);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	m68ki_write_8(ea, dst | 0x80);
 }
 
@@ -7539,8 +7542,7 @@ void m68k_op_tas_8_al(void)
 
 	FLAG_Z = dst;
 	FLAG_N = NFLAG_8(dst);
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 	m68ki_write_8(ea, dst | 0x80);
 }
 
@@ -7619,6 +7621,7 @@ void m68k_op_trapf_32(void)
 
 void m68k_op_traphi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_HI())
@@ -7631,6 +7634,7 @@ void m68k_op_traphi(void)
 
 void m68k_op_trapls(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_LS())
@@ -7643,6 +7647,7 @@ void m68k_op_trapls(void)
 
 void m68k_op_trapcc(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_CC())
@@ -7655,6 +7660,7 @@ void m68k_op_trapcc(void)
 
 void m68k_op_trapcs(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_CS())
@@ -7691,6 +7697,7 @@ void m68k_op_trapeq(void)
 
 void m68k_op_trapvc(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_VC())
@@ -7703,6 +7710,7 @@ void m68k_op_trapvc(void)
 
 void m68k_op_trapvs(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_VS())
@@ -7739,6 +7747,7 @@ void m68k_op_trapmi(void)
 
 void m68k_op_trapge(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_GE())
@@ -7751,6 +7760,7 @@ void m68k_op_trapge(void)
 
 void m68k_op_traplt(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_LT())
@@ -7763,6 +7773,7 @@ void m68k_op_traplt(void)
 
 void m68k_op_trapgt(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_GT())
@@ -7775,6 +7786,7 @@ void m68k_op_trapgt(void)
 
 void m68k_op_traple(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_LE())
@@ -7787,6 +7799,7 @@ void m68k_op_traple(void)
 
 void m68k_op_traphi_16(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_HI())
@@ -7803,6 +7816,7 @@ void m68k_op_traphi_16(void)
 
 void m68k_op_trapls_16(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_LS())
@@ -7819,6 +7833,7 @@ void m68k_op_trapls_16(void)
 
 void m68k_op_trapcc_16(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_CC())
@@ -7835,6 +7850,7 @@ void m68k_op_trapcc_16(void)
 
 void m68k_op_trapcs_16(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_CS())
@@ -7883,6 +7899,7 @@ void m68k_op_trapeq_16(void)
 
 void m68k_op_trapvc_16(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_VC())
@@ -7899,6 +7916,7 @@ void m68k_op_trapvc_16(void)
 
 void m68k_op_trapvs_16(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_VS())
@@ -7947,6 +7965,7 @@ void m68k_op_trapmi_16(void)
 
 void m68k_op_trapge_16(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_GE())
@@ -7963,6 +7982,7 @@ void m68k_op_trapge_16(void)
 
 void m68k_op_traplt_16(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_LT())
@@ -7979,6 +7999,7 @@ void m68k_op_traplt_16(void)
 
 void m68k_op_trapgt_16(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_GT())
@@ -7995,6 +8016,7 @@ void m68k_op_trapgt_16(void)
 
 void m68k_op_traple_16(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_LE())
@@ -8011,6 +8033,7 @@ void m68k_op_traple_16(void)
 
 void m68k_op_traphi_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_HI())
@@ -8027,6 +8050,7 @@ void m68k_op_traphi_32(void)
 
 void m68k_op_trapls_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_LS())
@@ -8043,6 +8067,7 @@ void m68k_op_trapls_32(void)
 
 void m68k_op_trapcc_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_CC())
@@ -8059,6 +8084,7 @@ void m68k_op_trapcc_32(void)
 
 void m68k_op_trapcs_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_CS())
@@ -8107,6 +8133,7 @@ void m68k_op_trapeq_32(void)
 
 void m68k_op_trapvc_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_VC())
@@ -8123,6 +8150,7 @@ void m68k_op_trapvc_32(void)
 
 void m68k_op_trapvs_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_VS())
@@ -8171,6 +8199,7 @@ void m68k_op_trapmi_32(void)
 
 void m68k_op_trapge_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_GE())
@@ -8187,6 +8216,7 @@ void m68k_op_trapge_32(void)
 
 void m68k_op_traplt_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_LT())
@@ -8203,6 +8233,7 @@ void m68k_op_traplt_32(void)
 
 void m68k_op_trapgt_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_GT())
@@ -8219,6 +8250,7 @@ void m68k_op_trapgt_32(void)
 
 void m68k_op_traple_32(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		if(COND_LE())
@@ -8235,6 +8267,7 @@ void m68k_op_traple_32(void)
 
 void m68k_op_trapv(void)
 {
+	m68ki_sync_flags();
 	if(COND_VC())
 	{
 		return;
@@ -8249,8 +8282,7 @@ void m68k_op_tst_8_d(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8260,8 +8292,7 @@ void m68k_op_tst_8_ai(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8271,8 +8302,7 @@ void m68k_op_tst_8_pi(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8282,8 +8312,7 @@ void m68k_op_tst_8_pi7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8293,8 +8322,7 @@ void m68k_op_tst_8_pd(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8304,8 +8332,7 @@ void m68k_op_tst_8_pd7(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8315,8 +8342,7 @@ void m68k_op_tst_8_di(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8326,8 +8352,7 @@ void m68k_op_tst_8_ix(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8337,8 +8362,7 @@ void m68k_op_tst_8_aw(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8348,13 +8372,13 @@ void m68k_op_tst_8_al(void)
 
 	FLAG_N = NFLAG_8(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
 void m68k_op_tst_8_pcdi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint res = OPER_PCDI_8();
@@ -8371,6 +8395,7 @@ void m68k_op_tst_8_pcdi(void)
 
 void m68k_op_tst_8_pcix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint res = OPER_PCIX_8();
@@ -8387,6 +8412,7 @@ void m68k_op_tst_8_pcix(void)
 
 void m68k_op_tst_8_i(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint res = OPER_I_8();
@@ -8407,13 +8433,13 @@ void m68k_op_tst_16_d(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
 void m68k_op_tst_16_a(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint res = MAKE_INT_16(AY);
@@ -8434,8 +8460,7 @@ void m68k_op_tst_16_ai(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8445,8 +8470,7 @@ void m68k_op_tst_16_pi(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8456,8 +8480,7 @@ void m68k_op_tst_16_pd(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8467,8 +8490,7 @@ void m68k_op_tst_16_di(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8478,8 +8500,7 @@ void m68k_op_tst_16_ix(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8489,8 +8510,7 @@ void m68k_op_tst_16_aw(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8500,13 +8520,13 @@ void m68k_op_tst_16_al(void)
 
 	FLAG_N = NFLAG_16(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
 void m68k_op_tst_16_pcdi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint res = OPER_PCDI_16();
@@ -8523,6 +8543,7 @@ void m68k_op_tst_16_pcdi(void)
 
 void m68k_op_tst_16_pcix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint res = OPER_PCIX_16();
@@ -8539,6 +8560,7 @@ void m68k_op_tst_16_pcix(void)
 
 void m68k_op_tst_16_i(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint res = OPER_I_16();
@@ -8559,13 +8581,13 @@ void m68k_op_tst_32_d(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
 void m68k_op_tst_32_a(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint res = AY;
@@ -8586,8 +8608,7 @@ void m68k_op_tst_32_ai(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8597,8 +8618,7 @@ void m68k_op_tst_32_pi(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8608,8 +8628,7 @@ void m68k_op_tst_32_pd(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8619,8 +8638,7 @@ void m68k_op_tst_32_di(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8630,8 +8648,7 @@ void m68k_op_tst_32_ix(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8641,8 +8658,7 @@ void m68k_op_tst_32_aw(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
@@ -8652,13 +8668,13 @@ void m68k_op_tst_32_al(void)
 
 	FLAG_N = NFLAG_32(res);
 	FLAG_Z = res;
-	FLAG_V = VFLAG_CLEAR;
-	FLAG_C = CFLAG_CLEAR;
+	m68ki_lazy_clear_vc();
 }
 
 
 void m68k_op_tst_32_pcdi(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint res = OPER_PCDI_32();
@@ -8675,6 +8691,7 @@ void m68k_op_tst_32_pcdi(void)
 
 void m68k_op_tst_32_pcix(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint res = OPER_PCIX_32();
@@ -8691,6 +8708,7 @@ void m68k_op_tst_32_pcix(void)
 
 void m68k_op_tst_32_i(void)
 {
+	m68ki_sync_flags();
 	if(CPU_TYPE_IS_EC020_PLUS(CPU_TYPE))
 	{
 		uint res = OPER_I_32();
@@ -2,13 +2,30 @@
 /* ========================= OPCODE TABLE BUILDER ========================= */
 /* ======================================================================== */
 
+#include <string.h>
+
 #include "m68kops.h"
 
 #define NUM_CPU_TYPES 3
 
+#if M68K_GENERATED_TABLES
+
+/* Jump table, cycle and length tables, written at build time by tools/m68kgen.c */
+#include "m68kopstab.h"
+
+#else
+
 void  (*m68ki_instruction_jump_table[0x10000])(void); /* opcode handler jump table */
 unsigned char m68ki_cycles[NUM_CPU_TYPES][0x10000]; /* Cycles used by CPU type */
 
+/* Compact dispatch tables, sized for the worst case */
+m68ki_opcode_entry m68ki_opcode_entries[0x10000];
+unsigned short m68ki_opcode_blocks[0x400][64];
+unsigned short m68ki_opcode_block_map[0x400];
+
+static unsigned int m68ki_opcode_entry_count;
+static unsigned int m68ki_opcode_block_count;
+
 /* This is used to generate the opcode handler jump table */
 typedef struct
 {
@@ -1989,6 +2006,60 @@ static opcode_handler_struct m68k_opcode_handler_table[] =
 };
 
 
+/* Build the compact dispatch tables out of the jump table and cycle tables */
+static void m68ki_build_compact_opcode_table(void)
+{
+	unsigned short block[64];
+	unsigned int last = 0;
+	unsigned int entry;
+	unsigned int instr;
+	unsigned int b;
+	unsigned int i;
+	unsigned int j;
+	int k;
+
+	m68ki_opcode_entry_count = 0;
+	m68ki_opcode_block_count = 0;
+
+	for(b = 0; b < 0x400; b++)
+	{
+		for(i = 0; i < 64; i++)
+		{
+			instr = (b << 6) | i;
+
+			/* look for the same handler and cycles, starting with the last match */
+			for(j = 0; j < m68ki_opcode_entry_count; j++)
+			{
+				entry = (last + j) % m68ki_opcode_entry_count;
+				if(m68ki_opcode_entries[entry].handler != m68ki_instruction_jump_table[instr])
+					continue;
+				for(k = 0; k < NUM_CPU_TYPES; k++)
+					if(m68ki_opcode_entries[entry].cycles[k] != m68ki_cycles[k][instr])
+						break;
+				if(k == NUM_CPU_TYPES)
+					break;
+			}
+			if(j == m68ki_opcode_entry_count)
+			{
+				entry = m68ki_opcode_entry_count++;
+				m68ki_opcode_entries[entry].handler = m68ki_instruction_jump_table[instr];
+				for(k = 0; k < NUM_CPU_TYPES; k++)
+					m68ki_opcode_entries[entry].cycles[k] = m68ki_cycles[k][instr];
+			}
+
+			block[i] = last = entry;
+		}
+
+		for(j = 0; j < m68ki_opcode_block_count; j++)
+			if(memcmp(m68ki_opcode_blocks[j], block, sizeof(block)) == 0)
+				break;
+		if(j == m68ki_opcode_block_count)
+			memcpy(m68ki_opcode_blocks[m68ki_opcode_block_count++], block, sizeof(block));
+
+		m68ki_opcode_block_map[b] = j;
+	}
+}
+
 /* Build the opcode handler jump table */
 void m68ki_build_opcode_table(void)
 {
@@ -2093,8 +2164,12 @@ void m68ki_build_opcode_table(void)
 			m68ki_cycles[k][ostruct->match] = ostruct->cycles[k];
 		ostruct++;
 	}
+
+	m68ki_build_compact_opcode_table();
 }
 
+#endif /* M68K_GENERATED_TABLES */
+
 
 /* ======================================================================== */
 /* ============================== END OF FILE ============================= */
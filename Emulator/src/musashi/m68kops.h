@@ -1968,12 +1968,38 @@ void m68k_op_unpk_16_mm_ax7(void);
 void m68k_op_unpk_16_mm_ay7(void);
 void m68k_op_unpk_16_mm_axy7(void);
 void m68k_op_unpk_16_mm(void);
+/* Compact dispatch tables: opcodes are split into blocks of 64, one for each
+ * effective address, which map to indices into a list of the distinct
+ * handler/cycle count pairs.  Identical blocks are only stored once. */
+typedef struct
+{
+	void (*handler)(void);      /* handler function */
+	unsigned char cycles[3];    /* cycles each cpu type takes */
+} m68ki_opcode_entry;
+
+#define m68ki_opcode_entry_for(OP) \
+	(&m68ki_opcode_entries[m68ki_opcode_blocks[m68ki_opcode_block_map[(OP) >> 6]][(OP) & 0x3f]])
+
+#if M68K_GENERATED_TABLES
+extern void (*const m68ki_instruction_jump_table[0x10000])(void); /* opcode handler jump table */
+extern const unsigned char m68ki_cycles[][0x10000];
+extern const unsigned char m68ki_instruction_lengths[][0x10000]; /* bytes, or 0 if it varies */
+
+extern const m68ki_opcode_entry m68ki_opcode_entries[];
+extern const unsigned short m68ki_opcode_blocks[][64];
+extern const unsigned short m68ki_opcode_block_map[0x400];
+#else
 /* Build the opcode handler table */
 void m68ki_build_opcode_table(void);
 
 extern void (*m68ki_instruction_jump_table[0x10000])(void); /* opcode handler jump table */
 extern unsigned char m68ki_cycles[][0x10000];
 
+extern m68ki_opcode_entry m68ki_opcode_entries[];
+extern unsigned short m68ki_opcode_blocks[][64];
+extern unsigned short m68ki_opcode_block_map[0x400];
+#endif /* M68K_GENERATED_TABLES */
+
 
 /* ======================================================================== */
 /* ============================== END OF FILE ============================= */
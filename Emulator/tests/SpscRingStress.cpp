@@ -0,0 +1,230 @@
+/**
+ * Stress test for SpscRing: a producer and a consumer thread move data through
+ * one ring in chunks of random size, and the consumer checks that every byte
+ * arrives exactly once and in order. This is done through each of the ring's
+ * interfaces: copying in and out, single elements, and in place through
+ * reserve()/commit() and peek()/consume().
+ *
+ * usage: spsc_stress [megabytes]
+ *
+ * Either side yields whenever the ring is full or empty, so this runs in
+ * reasonable time on a single core too. Build with -fsanitize=thread as well,
+ * to catch missing synchronization (`make test-spsc-tsan`).
+ */
+#include "SpscRing.h"
+
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <thread>
+
+/// ring under test; the same size as the UART backends use
+typedef SpscRing<uint8_t, 64 * 1024> ring_t;
+
+/// largest chunk moved at once; bigger than the ring, so it fills up
+static const size_t kMaxChunk = (80 * 1024);
+
+static ring_t gRing;
+
+/**
+ * Byte at the given position of the stream; a hash, so reordered or repeated
+ * chunks don't line up.
+ */
+static uint8_t StreamByte(size_t position) {
+  return (uint8_t) ((position * 2654435761u) >> 13);
+}
+
+/**
+ * Checks the received bytes against the stream, starting at the given
+ * position, and returns how many are wrong.
+ */
+static size_t Check(const uint8_t *data, size_t count, size_t position) {
+  size_t bad = 0;
+
+  for(size_t i = 0; i < count; i++) {
+    if(data[i] != StreamByte(position + i)) {
+      bad++;
+    }
+  }
+
+  return bad;
+}
+
+/**
+ * Pushes total bytes with push(), in chunks of random size.
+ */
+static void ProduceCopies(size_t total) {
+  std::mt19937 random(1);
+  static uint8_t buffer[kMaxChunk];
+  size_t sent = 0;
+
+  while(sent < total) {
+    size_t count = std::min<size_t>(1 + (random() % kMaxChunk), total - sent);
+
+    for(size_t i = 0; i < count; i++) {
+      buffer[i] = StreamByte(sent + i);
+    }
+
+    for(size_t done = 0; done < count; ) {
+      size_t pushed = gRing.push(buffer + done, count - done);
+      done += pushed;
+
+      if(!pushed) {
+        std::this_thread::yield();
+      }
+    }
+
+    sent += count;
+  }
+}
+
+/**
+ * Pops total bytes with pop(), in chunks of random size; returns how many
+ * were wrong.
+ */
+static size_t ConsumeCopies(size_t total) {
+  std::mt19937 random(2);
+  static uint8_t buffer[kMaxChunk];
+  size_t received = 0, bad = 0;
+
+  while(received < total) {
+    size_t count = gRing.pop(buffer, 1 + (random() % kMaxChunk));
+
+    if(!count) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    bad += Check(buffer, count, received);
+    received += count;
+  }
+
+  return bad;
+}
+
+/**
+ * Pushes total bytes one at a time.
+ */
+static void ProduceSingle(size_t total) {
+  for(size_t i = 0; i < total; i++) {
+    while(!gRing.push(StreamByte(i))) {
+      std::this_thread::yield();
+    }
+  }
+}
+
+/**
+ * Pops total bytes one at a time; returns how many were wrong.
+ */
+static size_t ConsumeSingle(size_t total) {
+  size_t bad = 0;
+
+  for(size_t i = 0; i < total; i++) {
+    uint8_t byte;
+    while(!gRing.pop(byte)) {
+      std::this_thread::yield();
+    }
+
+    bad += (byte != StreamByte(i));
+  }
+
+  return bad;
+}
+
+/**
+ * Writes total bytes into the ring in place, committing chunks of random size.
+ */
+static void ProduceInPlace(size_t total) {
+  std::mt19937 random(3);
+  size_t sent = 0;
+
+  while(sent < total) {
+    uint8_t *runs[2];
+    size_t counts[2];
+
+    size_t count = gRing.reserve(runs, counts);
+    count = std::min<size_t>(std::min<size_t>(count, 1 + (random() % kMaxChunk)), total - sent);
+
+    if(!count) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    for(size_t i = 0; i < count; i++) {
+      uint8_t *byte = (i < counts[0]) ? &runs[0][i] : &runs[1][i - counts[0]];
+      *byte = StreamByte(sent + i);
+    }
+
+    gRing.commit(count);
+    sent += count;
+  }
+}
+
+/**
+ * Reads total bytes out of the ring in place, consuming chunks of random
+ * size; returns how many were wrong.
+ */
+static size_t ConsumeInPlace(size_t total) {
+  std::mt19937 random(4);
+  size_t received = 0, bad = 0;
+
+  while(received < total) {
+    const uint8_t *runs[2];
+    size_t counts[2];
+
+    size_t count = gRing.peek(runs, counts);
+    count = std::min<size_t>(count, 1 + (random() % kMaxChunk));
+
+    if(!count) {
+      std::this_thread::yield();
+      continue;
+    }
+
+    size_t first = std::min(count, counts[0]);
+    bad += Check(runs[0], first, received);
+    bad += Check(runs[1], count - first, received + first);
+
+    gRing.consume(count);
+    received += count;
+  }
+
+  return bad;
+}
+
+/**
+ * Runs a producer on its own thread against a consumer on this one, and
+ * prints how it went; returns whether all bytes came through intact.
+ */
+static bool Run(const char *name, size_t total, void (*produce)(size_t),
+                size_t (*consume)(size_t)) {
+  auto start = std::chrono::steady_clock::now();
+
+  std::thread producer(produce, total);
+  size_t bad = consume(total);
+  producer.join();
+
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  bool ok = (bad == 0 && gRing.empty());
+
+  std::cout << (ok ? "PASS  " : "FAIL  ") << name << "  " << (total >> 10)
+            << " KB in " << elapsed.count() << " s, " << bad << " bytes wrong"
+            << (gRing.empty() ? "" : ", ring not empty") << std::endl;
+
+  return ok;
+}
+
+int main(int argc, char *argv[]) {
+  size_t megabytes = (argc > 1) ? std::strtoul(argv[1], nullptr, 10) : 256;
+  size_t total = (megabytes << 20);
+
+  bool ok = true;
+
+  ok &= Run("copies", total, ProduceCopies, ConsumeCopies);
+  ok &= Run("single", total / 32, ProduceSingle, ConsumeSingle);
+  ok &= Run("in place", total, ProduceInPlace, ConsumeInPlace);
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,128 @@
+"""
+Condition code exerciser, for checking M68K_LAZY_FLAGS against eager flag
+evaluation (`make test-flags`).
+
+ADD, SUB, CMP, ADDX, SUBX, NEG, NEGX and ADDQ/SUBQ in all sizes are run on
+every pair of a set of edge case operands, as are logical ops following an
+ADD or SUB (which clear V and C, but leave X as it was.) After each, the
+flags are consumed in every way the core may evaluate them differently: Scc
+on the compound conditions, a branch, MOVE from SR, and instructions that
+read X (ADDX, ROXL/ROXR) or modify the CCR in place. Everything is summed into a
+checksum, which is printed in hex when done, followed by the checksum of a
+loop of dependent flag producers and consumers.
+
+usage: flags.py <output.bin>
+"""
+import struct
+import sys
+
+from rom import Rom, SCRATCH, CC
+
+OPERANDS = [0x00000000, 0x00000001, 0x0000007F, 0x00000080, 0x000000FF,
+            0x00007FFF, 0x00008000, 0x0000FFFF, 0x7FFFFFFF, 0x80000000,
+            0xFFFFFFFF, 0x12345678, 0xEDCBA987]
+OPERAND_TABLE = 0x1E000
+
+# ops on d2 (a copy of d1), with d0 as source where there is one
+OPS = []
+for size in range(3):
+    OPS += [[0xD400 | (size << 6)],                     # add.s d0,d2
+            [0x9400 | (size << 6)],                     # sub.s d0,d2
+            [0xB400 | (size << 6)],                     # cmp.s d0,d2
+            [0xD500 | (size << 6)],                     # addx.s d0,d2
+            [0x9500 | (size << 6)],                     # subx.s d0,d2
+            [0x4402 | (size << 6)],                     # neg.s d2
+            [0x4002 | (size << 6)]]                     # negx.s d2
+OPS += [[0x5282],                                       # addq.l #1,d2
+        [0x5382],                                       # subq.l #1,d2
+        [0x5002],                                       # addq.b #8,d2
+        [0x5742],                                       # subq.w #3,d2
+        [0xD480, 0xE292],                               # add.l d0,d2; roxr.l #1,d2
+        [0x9440, 0xE352],                               # sub.w d0,d2; roxl.w #1,d2
+        [0xD400, 0x003C, 0x0004],                       # add.b d0,d2; ori #$04,ccr
+        [0x9480, 0x023C, 0x001B],                       # sub.l d0,d2; andi #$1b,ccr
+        [0xD440, 0xD580],                               # add.w d0,d2; addx.l d0,d2
+        [0xD480, 0x6902, 0x5286],                       # add.l d0,d2; bvs.s *+4; addq.l #1,d6
+        [0xD480, 0xC480],                               # add.l d0,d2; and.l d0,d2
+        [0x9440, 0x8440],                               # sub.w d0,d2; or.w d0,d2
+        [0xD400, 0xB102],                               # add.b d0,d2; eor.b d0,d2
+        [0x9480, 0x4682, 0xE292],                       # sub.l d0,d2; not.l d2; roxr.l #1,d2
+        [0xD480, 0x0242, 0xF0F0, 0xD580],               # add.l d0,d2; andi.w #$f0f0,d2; addx.l d0,d2
+        [0x9400, 0x0002, 0x005A, 0xE312]]               # sub.b d0,d2; ori.b #$5a,d2; roxl.b #1,d2
+
+# conditions stored with Scc after each op
+CONDITIONS = ['hi', 'ls', 'cs', 'vs', 'ge', 'lt', 'gt', 'le']
+
+
+def mix(rom, reg):
+    """Adds a data register into the checksum in d6."""
+    rom.emit(0xE79E)                                    # rol.l #3,d6
+    rom.emit(0xDC80 | reg)                              # add.l dN,d6
+
+
+rom = Rom()
+rom.uart_init()
+rom.moveq(0, 6)
+
+# every op on every pair of operands
+rom.lea(OPERAND_TABLE, 2)
+rom.moveq(len(OPERANDS) - 1, 4)
+outer = rom.here()
+rom.emit(0x201A)                                        # move.l (a2)+,d0
+rom.lea(OPERAND_TABLE, 3)
+rom.moveq(len(OPERANDS) - 1, 5)
+inner = rom.here()
+rom.emit(0x221B)                                        # move.l (a3)+,d1
+
+for op in OPS:
+    rom.emit(0x2401)                                    # move.l d1,d2
+    rom.emit(*op)
+
+    rom.lea(SCRATCH, 4)
+    for cond in CONDITIONS:
+        rom.emit(0x50DC | (CC[cond] << 8))              # scc (a4)+
+    rom.emit(0x40C7)                                    # move sr,d7
+
+    for offset in range(0, len(CONDITIONS), 4):
+        rom.emit(0x2639)                                # move.l SCRATCH+offset,d3
+        rom.long(SCRATCH + offset)
+        mix(rom, 3)
+    mix(rom, 7)
+    mix(rom, 2)
+
+rom.dbcc('f', 5, inner)
+rom.dbcc('f', 4, outer)
+rom.print_hex(6)
+
+# a long chain of dependent producers and consumers
+rom.moveq(0, 6)
+rom.emit(0x203C); rom.long(0x12345678)                  # move.l #$12345678,d0
+rom.emit(0x223C); rom.long(0x9ABCDEF0)                  # move.l #$9abcdef0,d1
+rom.emit(0x3A3C, 0x3FFF)                                # move.w #$3fff,d5
+loop = rom.here()
+rom.emit(0xD280)                                        # add.l d0,d1
+rom.emit(0x40C7, 0xDC87)                                # move sr,d7; add.l d7,d6
+rom.emit(0x9041)                                        # sub.w d1,d0
+rom.emit(0x55C2, 0xDC02)                                # scs d2; add.b d2,d6
+rom.emit(0xD181)                                        # addx.l d1,d0
+rom.emit(0x40C7, 0xDC87)                                # move sr,d7; add.l d7,d6
+rom.emit(0x5701)                                        # subq.b #3,d1
+rom.emit(0x6902, 0x5286)                                # bvs.s *+4; addq.l #1,d6
+rom.emit(0x0600, 0x0077)                                # addi.b #$77,d0
+rom.emit(0x2600)                                        # move.l d0,d3
+rom.emit(0xE291, 0xDC81)                                # roxr.l #1,d1; add.l d1,d6
+rom.emit(0x9280)                                        # sub.l d0,d1
+rom.emit(0x6D02, 0x5486)                                # blt.s *+4; addq.l #2,d6
+rom.emit(0x4A43)                                        # tst.w d3
+rom.emit(0x6502, 0x5686)                                # bcs.s *+4; addq.l #3,d6
+rom.emit(0x0441, 0x1234)                                # subi.w #$1234,d1
+rom.emit(0x6202, 0x5886)                                # bhi.s *+4; addq.l #4,d6
+rom.emit(0xEB98)                                        # rol.l #5,d0
+rom.dbcc('f', 5, loop)
+rom.print_hex(6)
+
+rom.print_newline()
+rom.halt()
+
+rom.place(OPERAND_TABLE, b''.join(struct.pack('>I', value) for value in OPERANDS))
+rom.save(sys.argv[1])
@@ -0,0 +1,200 @@
+"""
+DBcc loop shapes, for checking that M68K_DBCC_FAST_FORWARD gives the same
+results as running every iteration (`make test-loops`).
+
+The shape to run is picked by the first byte received on UART A (see
+tests/loops.scenarios). The DUART's timer interrupts every few hundred
+cycles throughout, so timeslices end in the middle of loops; the interrupt
+handler counts ticks. When the loop is done, the registers, the tick count
+and the SR are printed in hex.
+
+usage: loops.py <output.bin>
+"""
+import struct
+import sys
+
+from rom import Rom, DUART, SCRATCH
+
+ISR = 0x300
+TICKS = 0x60000
+ZEROS = 0x1E000
+BUFFER = 0x70000
+
+rom = Rom()
+rom.uart_init()
+
+# timer at X1/16, interrupting on every terminal count
+rom.emit(0x137C, 0x0070, 0x0004)                        # move.b #$70,ACR(a1)
+rom.emit(0x137C, 0x0000, 0x0006)                        # move.b #$00,CTUR(a1)
+rom.emit(0x137C, 0x0020, 0x0007)                        # move.b #$20,CTLR(a1)
+rom.emit(0x137C, 0x0008, 0x0005)                        # move.b #$08,IMR(a1)
+rom.emit(0x4A29, 0x000E)                                # tst.b START(a1)
+rom.emit(0x46FC, 0x2000)                                # move #$2000,sr
+
+# wait for the shape to run, then start it with all other registers clear
+wait = rom.here()
+rom.emit(0x0829, 0x0000, 0x0001)                        # btst #0,SRA(a1)
+rom.branch('eq', wait)
+rom.emit(0x1029, 0x0003)                                # move.b RHRA(a1),d0
+rom.emit(0x4CF9, 0x7CFE)                                # movem.l ZEROS,d1-d7/a2-a6
+rom.long(ZEROS)
+
+shapes = []
+done = []
+
+
+def shape(letter):
+    """Starts the code for a shape, run when the given letter is received."""
+    rom.emit(0x0C00, ord(letter))                       # cmpi.b #letter,d0
+    skip = rom.forward('ne')
+    shapes.append(skip)
+
+
+def end_shape():
+    """Ends the code for a shape; the next one's check follows it."""
+    done.append(rom.forward('t'))
+    rom.resolve(shapes[-1])
+
+
+# DBF around a body that does nothing
+shape('a')
+rom.emit(0x303C, 40000)                                 # move.w #40000,d0
+loop = rom.here()
+rom.emit(0x4E71, 0x4E71)                                # nop; nop
+rom.dbcc('f', 0, loop)
+end_shape()
+
+# ADDQ/SUBQ to data and address registers (which set flags, or don't)
+shape('b')
+rom.emit(0x323C, 5000)                                  # move.w #5000,d1
+loop = rom.here()
+rom.emit(0x5682)                                        # addq.l #3,d2
+rom.emit(0x534A)                                        # subq.w #1,a2
+rom.emit(0x5F87)                                        # subq.l #7,d7
+rom.emit(0x504B)                                        # addq.w #8,a3
+rom.dbcc('f', 1, loop)
+end_shape()
+
+# LEA (d16,An),An, forwards and backwards, mixed with ADDQ to An
+shape('c')
+rom.emit(0x323C, 30000)                                 # move.w #30000,d1
+loop = rom.here()
+rom.emit(0x47EB, 0xFFFA)                                # lea -6(a3),a3
+rom.emit(0x49EC, 1234)                                  # lea 1234(a4),a4
+rom.emit(0x544D)                                        # addq.w #2,a5
+rom.dbcc('f', 1, loop)
+end_shape()
+
+# DBNE with the condition true from the start: one pass only
+shape('d')
+rom.emit(0x3A3C, 1000)                                  # move.w #1000,d5
+rom.moveq(1, 4)                                         # (Z clear)
+loop = rom.here()
+rom.emit(0x4E71)                                        # nop
+rom.dbcc('ne', 5, loop)
+end_shape()
+
+# DBNE with the condition false throughout, and a body that keeps it so
+shape('e')
+rom.emit(0x3A3C, 3000)                                  # move.w #3000,d5
+rom.moveq(0, 4)                                         # (Z set)
+loop = rom.here()
+rom.emit(0x4E71, 0x524E)                                # nop; addq.w #1,a6
+rom.dbcc('ne', 5, loop)
+end_shape()
+
+# DBEQ whose body sets flags, ending the loop before the counter does
+shape('f')
+rom.emit(0x243C); rom.long(2500)                        # move.l #2500,d2
+rom.emit(0x3A3C, 9000)                                  # move.w #9000,d5
+loop = rom.here()
+rom.emit(0x5382)                                        # subq.l #1,d2
+rom.dbcc('eq', 5, loop)
+end_shape()
+
+# DBVS whose body overflows after a few iterations
+shape('g')
+rom.emit(0x243C); rom.long(0x7FFFFFF0)                  # move.l #$7ffffff0,d2
+rom.emit(0x3A3C, 100)                                   # move.w #100,d5
+loop = rom.here()
+rom.emit(0x5282)                                        # addq.l #1,d2
+rom.dbcc('vs', 5, loop)
+end_shape()
+
+# DBF whose body sets flags, with data in the counter's upper word
+shape('h')
+rom.emit(0x2E3C); rom.long(0x12340100)                  # move.l #$12340100,d7
+loop = rom.here()
+rom.emit(0x5E86)                                        # addq.l #7,d6
+rom.dbcc('f', 7, loop)
+end_shape()
+
+# counter at 0: one pass, then it wraps to $ffff and the loop ends
+shape('i')
+rom.emit(0x223C); rom.long(0xABCD0000)                  # move.l #$abcd0000,d1
+loop = rom.here()
+rom.emit(0x5282)                                        # addq.l #1,d2
+rom.dbcc('f', 1, loop)
+end_shape()
+
+# counter at $ffff: 65536 passes
+shape('j')
+rom.emit(0x223C); rom.long(0x0000FFFF)                  # move.l #$0000ffff,d1
+loop = rom.here()
+rom.emit(0x5282, 0x4E71)                                # addq.l #1,d2; nop
+rom.dbcc('f', 1, loop)
+end_shape()
+
+# a body that can't be skipped, as it writes memory
+shape('k')
+rom.lea(BUFFER, 3)
+rom.emit(0x383C, 2000)                                  # move.w #2000,d4
+loop = rom.here()
+rom.emit(0x26C2, 0x5282)                                # move.l d2,(a3)+; addq.l #1,d2
+rom.dbcc('f', 4, loop)
+end_shape()
+
+# long loops back to back, with bodies of odd lengths, so that the timer
+# interrupts land at many different points in them
+shape('l')
+rom.moveq(9, 5)
+outer = rom.here()
+rom.emit(0x323C, 0x7FFF)                                # move.w #$7fff,d1
+loop = rom.here()
+rom.emit(0x5A82, 0x45EA, 0x0003)                        # addq.l #5,d2; lea 3(a2),a2
+rom.dbcc('f', 1, loop)
+rom.emit(0x343C, 777)                                   # move.w #777,d2
+loop = rom.here()
+rom.emit(0x4E71, 0x4E71, 0x4E71)                        # nop; nop; nop
+rom.dbcc('f', 2, loop)
+rom.dbcc('f', 5, outer)
+end_shape()
+
+# an unknown shape prints the registers as they are
+for branch in done:
+    rom.resolve(branch)
+
+rom.emit(0x40F9); rom.long(SCRATCH + 0x38)              # move sr,SCRATCH+$38
+rom.emit(0x46FC, 0x2700)                                # move #$2700,sr
+rom.emit(0x48F9, 0x7CFF); rom.long(SCRATCH)             # movem.l d0-d7/a2-a6,SCRATCH
+rom.emit(0x23F9); rom.long(TICKS)                       # move.l TICKS,SCRATCH+$34
+rom.long(SCRATCH + 0x34)
+rom.emit(0x4279); rom.long(SCRATCH + 0x3A)              # clr.w SCRATCH+$3a
+
+rom.lea(SCRATCH, 2)
+rom.moveq(14, 5)
+dump = rom.here()
+rom.emit(0x2C1A)                                        # move.l (a2)+,d6
+rom.print_hex(6)
+rom.dbcc('f', 5, dump)
+rom.print_newline()
+rom.halt()
+
+# timer interrupt handler
+rom.vectors[26] = ISR
+rom.place(ISR, struct.pack('>7H',
+                           0x4A39, DUART >> 16, 0x000F, # tst.b STOP
+                           0x52B9, TICKS >> 16, TICKS & 0xFFFF, # addq.l #1,TICKS
+                           0x4E73))                     # rte
+rom.place(ZEROS, bytes(64))
+rom.save(sys.argv[1])
@@ -0,0 +1,141 @@
+"""
+Builds test ROMs for the emulator. The 68008 code is written out as opcode
+words by hand (no assembler is needed to run the tests), and placed in a ROM
+image laid out like the real one: the reset vectors point at the code at
+ORG, and every other exception halts the CPU.
+
+Tests report their results by printing them in hex on UART A, so they can
+be checked with the emulator's `--batch` mode.
+"""
+import struct
+
+# layout of the ROM image
+ROM_SIZE = 0x20000
+ORG = 0x400
+HALT = 0x380
+HEX_DIGITS = 0x1FF00
+
+# initial stack pointer (top of RAM), and scratch RAM for tests to use
+STACK = 0x80000
+SCRATCH = 0x61000
+
+# DUART base address, and the offsets of channel A's registers
+DUART = 0x20000
+DUART_SRA = 0x01
+DUART_CRA = 0x02
+DUART_THRA = 0x03
+
+# condition codes, as used by Bcc, DBcc and Scc
+CC = {'t': 0, 'f': 1, 'hi': 2, 'ls': 3, 'cc': 4, 'cs': 5, 'ne': 6, 'eq': 7,
+      'vc': 8, 'vs': 9, 'pl': 10, 'mi': 11, 'ge': 12, 'lt': 13, 'gt': 14,
+      'le': 15}
+
+
+class Rom:
+    def __init__(self):
+        self.code = []
+        self.data = {}
+        self.vectors = {}
+
+    def here(self):
+        """Address of the next word of code."""
+        return ORG + 2 * len(self.code)
+
+    def emit(self, *words):
+        for word in words:
+            self.code.append(word & 0xFFFF)
+
+    def long(self, value):
+        """Emits a long immediate or absolute address."""
+        self.emit(value >> 16, value)
+
+    def branch(self, cond, target):
+        """Bcc.W (or BRA for 't') to the given address."""
+        self.emit(0x6000 | (CC[cond] << 8))
+        self.emit(target - self.here())
+
+    def forward(self, cond):
+        """Bcc.W to a label that isn't known yet; returns the branch, to be
+        passed to resolve() once it is."""
+        self.emit(0x6000 | (CC[cond] << 8), 0)
+        return len(self.code) - 1
+
+    def resolve(self, branch, target=None):
+        """Points a forward branch at the given address, or the next word."""
+        if target is None:
+            target = self.here()
+        self.code[branch] = (target - (ORG + 2 * branch)) & 0xFFFF
+
+    def dbcc(self, cond, reg, target):
+        """DBcc Dn to the given address."""
+        self.emit(0x50C8 | (CC[cond] << 8) | reg)
+        self.emit(target - self.here())
+
+    def moveq(self, value, reg):
+        self.emit(0x7000 | (reg << 9) | (value & 0xFF))
+
+    def lea(self, address, reg):
+        """LEA address.L,An."""
+        self.emit(0x41F9 | (reg << 9))
+        self.long(address)
+
+    def place(self, address, data):
+        """Puts data into the ROM at the given address, outside the code."""
+        self.data[address] = bytes(data)
+
+    def uart_init(self):
+        """Points a1 at the DUART, and enables channel A's transmitter and
+        receiver; the DUART otherwise keeps its reset settings (9600 8N1)."""
+        self.lea(DUART, 1)
+        self.emit(0x137C, 0x0005, DUART_CRA)            # move.b #$05,CRA(a1)
+
+    def uart_put(self, reg):
+        """Sends the low byte of a data register on channel A, once the
+        transmitter is ready. Needs a1 from uart_init()."""
+        wait = self.here()
+        self.emit(0x0829, 0x0002, DUART_SRA)            # btst #2,SRA(a1)
+        self.branch('eq', wait)
+        self.emit(0x1340 | reg, DUART_THRA)             # move.b dN,THRA(a1)
+
+    def print_hex(self, reg):
+        """Prints a data register as 8 hex digits, followed by a space.
+        Clobbers d3, d4 and a0; the register is rotated back to where it
+        started."""
+        self.lea(HEX_DIGITS, 0)
+        self.moveq(7, 4)
+        loop = self.here()
+        self.emit(0xE998 | reg)                         # rol.l #4,dN
+        self.emit(0x1600 | reg)                         # move.b dN,d3
+        self.emit(0x0243, 0x000F)                       # andi.w #$f,d3
+        self.emit(0x1630, 0x3000)                       # move.b 0(a0,d3.w),d3
+        self.uart_put(3)
+        self.dbcc('f', 4, loop)
+        self.moveq(ord(' '), 3)
+        self.uart_put(3)
+
+    def print_newline(self):
+        """Prints CR LF. Clobbers d3."""
+        for char in '\r\n':
+            self.moveq(ord(char), 3)
+            self.uart_put(3)
+
+    def halt(self):
+        self.emit(0x4E72, 0x2700)                       # stop #$2700
+
+    def save(self, path):
+        rom = bytearray(b'\xff' * ROM_SIZE)
+
+        struct.pack_into('>II', rom, 0, STACK, ORG)
+        for vector in range(2, 64):
+            struct.pack_into('>I', rom, vector * 4, self.vectors.get(vector, HALT))
+        struct.pack_into('>HH', rom, HALT, 0x4E72, 0x2700)
+
+        for i, word in enumerate(self.code):
+            struct.pack_into('>H', rom, ORG + 2 * i, word)
+
+        self.place(HEX_DIGITS, b'0123456789ABCDEF')
+        for address, data in self.data.items():
+            rom[address:address + len(data)] = data
+
+        with open(path, 'wb') as out:
+            out.write(rom)
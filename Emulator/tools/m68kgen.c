@@ -0,0 +1,314 @@
+/* ======================================================================== */
+/* ========================= OPCODE TABLE GENERATOR ======================= */
+/* ======================================================================== */
+/*
+ * Runs the opcode table builders from m68kops.c and m68kdasm.c on the build
+ * host, and writes their output (including the compact dispatch tables) as C
+ * source; with M68K_GENERATED_TABLES on, the emulator includes that instead
+ * of building the tables at startup.
+ *
+ * usage: m68kgen <m68kops.c> <m68kdasm.c> <output directory>
+ *
+ * The handlers in the tables only exist as pointers once built, so to get
+ * their names back, the opcode table entries are read out of the source files
+ * as well; they're listed there in the same order as in the table.
+ *
+ * The length of every instruction (for the translator in m68kjit.c) comes from
+ * running the disassembler over each opcode, with made up extension words.
+ */
+
+#undef M68K_GENERATED_TABLES
+#define M68K_GENERATED_TABLES 0
+
+#include "m68kdasm.c"
+#include "m68kops.c"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+
+#define MAX_HANDLERS 4096
+#define MAX_NAME     64
+
+typedef struct
+{
+	void (*handler)(void);
+	char name[MAX_NAME];
+} handler_name;
+
+static handler_name g_op_names[MAX_HANDLERS];
+static handler_name g_dasm_names[MAX_HANDLERS];
+
+/* Instruction the disassembler is given to find its length: the opcode word is
+ * at address 0, followed by extension words that all read as the same value. */
+static unsigned int g_length_opcode;
+static unsigned int g_length_extension;
+
+/* The handlers get linked in, so the tables can be built; these are the bus
+ * callbacks they refer to, which never get called here. */
+unsigned int m68k_read_memory_8(unsigned int address) { (void)address; return 0; }
+unsigned int m68k_read_memory_16(unsigned int address) { (void)address; return 0; }
+unsigned int m68k_read_memory_32(unsigned int address) { (void)address; return 0; }
+unsigned int m68k_read_disassembler_16(unsigned int address) { return address ? g_length_extension : g_length_opcode; }
+unsigned int m68k_read_disassembler_32(unsigned int address) { (void)address; return (g_length_extension << 16) | g_length_extension; }
+void m68k_write_memory_8(unsigned int address, unsigned int value) { (void)address; (void)value; }
+void m68k_write_memory_16(unsigned int address, unsigned int value) { (void)address; (void)value; }
+void m68k_write_memory_32(unsigned int address, unsigned int value) { (void)address; (void)value; }
+void m68k_reset_called(void) { }
+
+/* Reads the handler names of all opcode table entries in a source file, which
+ * are the lines that start with "{" followed by the given prefix. */
+static int read_names(const char* path, const char* prefix, handler_name* names)
+{
+	char line[256];
+	int count = 0;
+	FILE* file = fopen(path, "r");
+
+	if(file == NULL)
+	{
+		perror(path);
+		exit(1);
+	}
+
+	while(fgets(line, sizeof(line), file) != NULL)
+	{
+		char* p = line;
+		int len = 0;
+
+		while(*p == ' ' || *p == '\t')
+			p++;
+		if(*p++ != '{' || strncmp(p, prefix, strlen(prefix)) != 0)
+			continue;
+
+		if(count == MAX_HANDLERS)
+		{
+			fprintf(stderr, "%s: too many opcode table entries\n", path);
+			exit(1);
+		}
+
+		while((isalnum((unsigned char)p[len]) || p[len] == '_') && len < MAX_NAME - 1)
+			len++;
+		memcpy(names[count].name, p, len);
+		names[count].name[len] = 0;
+		count++;
+	}
+
+	fclose(file);
+	return count;
+}
+
+/* Looks up the name of a handler, starting with the last one found, since
+ * neighbouring opcodes tend to share handlers. */
+static const char* find_name(handler_name* names, int count, void (*handler)(void))
+{
+	static int last = 0;
+	int i;
+
+	for(i = 0; i < count; i++)
+	{
+		int index = (last + i) % count;
+		if(names[index].handler == handler)
+		{
+			last = index;
+			return names[index].name;
+		}
+	}
+
+	fprintf(stderr, "no name for handler %p\n", (void*)handler);
+	exit(1);
+}
+
+static FILE* open_output(const char* dir, const char* name)
+{
+	char path[1024];
+	FILE* file;
+
+	snprintf(path, sizeof(path), "%s/%s", dir, name);
+	file = fopen(path, "w");
+	if(file == NULL)
+	{
+		perror(path);
+		exit(1);
+	}
+
+	fprintf(file, "/* Generated by tools/m68kgen.c; do not edit. */\n\n");
+	return file;
+}
+
+/* Length in bytes of an instruction on the given disassembler CPU type, or 0
+ * if it depends on the extension words (the 68020's full format indexed
+ * addressing modes); the 68000 and 68010 only have the brief format. */
+static unsigned int instruction_length(unsigned int opcode, unsigned int cpu_type)
+{
+	char dasm[128];
+	unsigned int length;
+
+	g_length_opcode = opcode;
+	g_length_extension = 0x0000;
+	length = m68k_disassemble(dasm, 0, cpu_type);
+
+	if(cpu_type != M68K_CPU_TYPE_68000 && cpu_type != M68K_CPU_TYPE_68010)
+	{
+		g_length_extension = 0xffff;
+		if(m68k_disassemble(dasm, 0, cpu_type) != length)
+			return 0;
+	}
+	return length;
+}
+
+static void write_handlers(FILE* file, const char* decl, void (**table)(void),
+							handler_name* names, int count)
+{
+	int i;
+
+	fprintf(file, "%s =\n{\n", decl);
+	for(i = 0; i < 0x10000; i++)
+	{
+		if((i & 7) == 0)
+			fprintf(file, "\t/* %04x */", i);
+		fprintf(file, " %s,", find_name(names, count, table[i]));
+		if((i & 7) == 7)
+			fprintf(file, "\n");
+	}
+	fprintf(file, "};\n");
+}
+
+int main(int argc, char** argv)
+{
+	FILE* file;
+	int op_count;
+	int dasm_count;
+	int i;
+	int k;
+
+	if(argc != 4)
+	{
+		fprintf(stderr, "usage: %s <m68kops.c> <m68kdasm.c> <output directory>\n", argv[0]);
+		return 1;
+	}
+
+	/* pair up names and handlers; the disassembler's table gets sorted when
+	 * it's built, so this has to happen first */
+	op_count = read_names(argv[1], "m68k_op_", g_op_names);
+	for(i = 0; m68k_opcode_handler_table[i].opcode_handler != 0; i++)
+		if(i < op_count)
+			g_op_names[i].handler = m68k_opcode_handler_table[i].opcode_handler;
+	if(i != op_count)
+	{
+		fprintf(stderr, "%s: found %d names for %d opcode handlers\n", argv[1], op_count, i);
+		return 1;
+	}
+
+	dasm_count = read_names(argv[2], "d68", g_dasm_names);
+	for(i = 0; g_opcode_info[i].opcode_handler != 0; i++)
+		if(i < dasm_count)
+			g_dasm_names[i].handler = g_opcode_info[i].opcode_handler;
+	if(i != dasm_count)
+	{
+		fprintf(stderr, "%s: found %d names for %d opcode handlers\n", argv[2], dasm_count, i);
+		return 1;
+	}
+
+	/* neither list has the illegal instruction handlers */
+	g_op_names[op_count].handler = m68k_op_illegal;
+	strcpy(g_op_names[op_count++].name, "m68k_op_illegal");
+	g_dasm_names[dasm_count].handler = d68000_illegal;
+	strcpy(g_dasm_names[dasm_count++].name, "d68000_illegal");
+
+	m68ki_build_opcode_table();
+	build_opcode_table();
+	g_initialized = 1;
+
+	/* emulator jump and cycle tables */
+	file = open_output(argv[3], "m68kopstab.h");
+	write_handlers(file, "void (*const m68ki_instruction_jump_table[0x10000])(void)",
+				   m68ki_instruction_jump_table, g_op_names, op_count);
+
+	fprintf(file, "\nconst unsigned char m68ki_cycles[NUM_CPU_TYPES][0x10000] =\n{\n");
+	for(k = 0; k < NUM_CPU_TYPES; k++)
+	{
+		fprintf(file, "\t{\n");
+		for(i = 0; i < 0x10000; i++)
+		{
+			if((i & 15) == 0)
+				fprintf(file, "\t\t/* %04x */", i);
+			fprintf(file, " %2d,", m68ki_cycles[k][i]);
+			if((i & 15) == 15)
+				fprintf(file, "\n");
+		}
+		fprintf(file, "\t},\n");
+	}
+	fprintf(file, "};\n");
+
+	/* instruction lengths, for the same CPU types as the cycle tables */
+	fprintf(file, "\nconst unsigned char m68ki_instruction_lengths[NUM_CPU_TYPES][0x10000] =\n{\n");
+	for(k = 0; k < NUM_CPU_TYPES; k++)
+	{
+		static const unsigned int dasm_types[NUM_CPU_TYPES] =
+		{
+			M68K_CPU_TYPE_68000, M68K_CPU_TYPE_68010, M68K_CPU_TYPE_68EC020
+		};
+
+		fprintf(file, "\t{\n");
+		for(i = 0; i < 0x10000; i++)
+		{
+			if((i & 15) == 0)
+				fprintf(file, "\t\t/* %04x */", i);
+			fprintf(file, " %2u,", instruction_length(i, dasm_types[k]));
+			if((i & 15) == 15)
+				fprintf(file, "\n");
+		}
+		fprintf(file, "\t},\n");
+	}
+	fprintf(file, "};\n");
+
+	/* compact dispatch tables */
+	fprintf(file, "\nconst m68ki_opcode_entry m68ki_opcode_entries[%u] =\n{\n", m68ki_opcode_entry_count);
+	for(i = 0; i < (int)m68ki_opcode_entry_count; i++)
+		fprintf(file, "\t{%s, {%d, %d, %d}},\n",
+				find_name(g_op_names, op_count, m68ki_opcode_entries[i].handler),
+				m68ki_opcode_entries[i].cycles[0], m68ki_opcode_entries[i].cycles[1],
+				m68ki_opcode_entries[i].cycles[2]);
+	fprintf(file, "};\n");
+
+	fprintf(file, "\nconst unsigned short m68ki_opcode_blocks[%u][64] =\n{\n", m68ki_opcode_block_count);
+	for(i = 0; i < (int)m68ki_opcode_block_count; i++)
+	{
+		fprintf(file, "\t{");
+		for(k = 0; k < 64; k++)
+			fprintf(file, "%s%d,", (k & 15) == 0 ? "\n\t\t" : " ", m68ki_opcode_blocks[i][k]);
+		fprintf(file, "\n\t},\n");
+	}
+	fprintf(file, "};\n");
+
+	fprintf(file, "\nconst unsigned short m68ki_opcode_block_map[0x400] =\n{\n");
+	for(i = 0; i < 0x400; i++)
+	{
+		if((i & 15) == 0)
+			fprintf(file, "\t/* %04x */", i << 6);
+		fprintf(file, " %3d,", m68ki_opcode_block_map[i]);
+		if((i & 15) == 15)
+			fprintf(file, "\n");
+	}
+	fprintf(file, "};\n");
+
+	if(fclose(file) != 0)
+	{
+		perror("m68kopstab.h");
+		return 1;
+	}
+
+	/* disassembler jump table */
+	file = open_output(argv[3], "m68kdasmtab.h");
+	write_handlers(file, "static void (*const g_instruction_table[0x10000])(void)",
+				   g_instruction_table, g_dasm_names, dasm_count);
+
+	if(fclose(file) != 0)
+	{
+		perror("m68kdasmtab.h");
+		return 1;
+	}
+
+	return 0;
+}